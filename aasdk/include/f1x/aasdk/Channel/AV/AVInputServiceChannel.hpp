@@ -20,7 +20,7 @@
 
 #include <f1x/aasdk/Messenger/MessageId.hpp>
 #include <f1x/aasdk/Messenger/Timestamp.hpp>
-#include <f1x/aasdk/Channel/ServiceChannel.hpp>
+#include <f1x/aasdk/Channel/TypedServiceChannel.hpp>
 #include <f1x/aasdk/Channel/AV/IAVInputServiceChannel.hpp>
 
 namespace f1x
@@ -32,12 +32,19 @@ namespace channel
 namespace av
 {
 
-class AVInputServiceChannel: public IAVInputServiceChannel, public ServiceChannel, public std::enable_shared_from_this<AVInputServiceChannel>
+class AVInputServiceChannel: public IAVInputServiceChannel,
+                             public TypedServiceChannel<AVInputServiceChannel, IAVInputServiceChannelEventHandler,
+                                                        proto::messages::AVChannelSetupRequest,
+                                                        proto::messages::AVInputOpenRequest,
+                                                        proto::messages::AVMediaAckIndication,
+                                                        proto::messages::ChannelOpenRequest>,
+                             public std::enable_shared_from_this<AVInputServiceChannel>
 {
 public:
     AVInputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger);
 
     void receive(IAVInputServiceChannelEventHandler::Pointer eventHandler) override;
+    void subscribe(IAVInputServiceChannelEventHandler::Pointer eventHandler) override;
     void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) override;
     void sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise) override;
     void sendAVInputOpenResponse(const proto::messages::AVInputOpenResponse& response, SendPromise::Pointer promise) override;
@@ -45,12 +52,10 @@ public:
     messenger::ChannelId getId() const override;
 
 private:
+    friend TypedServiceChannel;
     using std::enable_shared_from_this<AVInputServiceChannel>::shared_from_this;
-    void messageHandler(messenger::Message::Pointer message, IAVInputServiceChannelEventHandler::Pointer eventHandler);
-    void handleAVChannelSetupRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler);
-    void handleAVInputOpenRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler);
-    void handleAVMediaAckIndication(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler);
-    void handleChannelOpenRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler);
+
+    static const MessageHandlers<4> cMessageHandlers;
 };
 
 }
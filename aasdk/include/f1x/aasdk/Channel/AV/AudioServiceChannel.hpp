@@ -19,7 +19,7 @@
 #pragma once
 
 #include <f1x/aasdk/Messenger/MessageId.hpp>
-#include <f1x/aasdk/Channel/ServiceChannel.hpp>
+#include <f1x/aasdk/Channel/TypedServiceChannel.hpp>
 #include <f1x/aasdk/Channel/AV/IAudioServiceChannel.hpp>
 
 namespace f1x
@@ -31,25 +31,37 @@ namespace channel
 namespace av
 {
 
-class AudioServiceChannel: public IAudioServiceChannel, public ServiceChannel, public std::enable_shared_from_this<AudioServiceChannel>
+class AudioServiceChannel: public IAudioServiceChannel,
+                           public TypedServiceChannel<AudioServiceChannel, IAudioServiceChannelEventHandler,
+                                                      proto::messages::AVChannelSetupRequest,
+                                                      proto::messages::AVChannelStartIndication,
+                                                      proto::messages::AVChannelStopIndication,
+                                                      proto::messages::ChannelOpenRequest>,
+                           public std::enable_shared_from_this<AudioServiceChannel>
 {
 public:
     AudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger,  messenger::ChannelId channelId);
 
     void receive(IAudioServiceChannelEventHandler::Pointer eventHandler) override;
+    void subscribe(IAudioServiceChannelEventHandler::Pointer eventHandler) override;
     void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) override;
     void sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise) override;
     void sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication, SendPromise::Pointer promise) override;
+    void sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication) override;
     messenger::ChannelId getId() const override;
 
 private:
+    friend TypedServiceChannel;
     using std::enable_shared_from_this<AudioServiceChannel>::shared_from_this;
     void messageHandler(messenger::Message::Pointer message, IAudioServiceChannelEventHandler::Pointer eventHandler);
-    void handleAVChannelSetupRequest(const common::DataConstBuffer& payload, IAudioServiceChannelEventHandler::Pointer eventHandler);
-    void handleStartIndication(const common::DataConstBuffer& payload, IAudioServiceChannelEventHandler::Pointer eventHandler);
-    void handleStopIndication(const common::DataConstBuffer& payload, IAudioServiceChannelEventHandler::Pointer eventHandler);
-    void handleChannelOpenRequest(const common::DataConstBuffer& payload, IAudioServiceChannelEventHandler::Pointer eventHandler);
-    void handleAVMediaWithTimestampIndication(const common::DataConstBuffer& payload, IAudioServiceChannelEventHandler::Pointer eventHandler);
+    void fragmentHandler(messenger::Message::Pointer message, IAudioServiceChannelEventHandler::Pointer eventHandler);
+    void handleAVMediaWithTimestampIndication(messenger::Message::Pointer message, size_t offset, IAudioServiceChannelEventHandler::Pointer eventHandler);
+
+    bool mediaFragmentInProgress_;
+    messenger::Timestamp::ValueType fragmentTimestamp_;
+    messenger::Message::Pointer fragmentedMessage_;
+
+    static const MessageHandlers<4> cMessageHandlers;
 };
 
 }
@@ -45,6 +45,7 @@ public:
     virtual ~IAVInputServiceChannel() = default;
 
     virtual void receive(IAVInputServiceChannelEventHandler::Pointer eventHandler) = 0;
+    virtual void subscribe(IAVInputServiceChannelEventHandler::Pointer eventHandler) = 0;
     virtual void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendAVMediaWithTimestampIndication(messenger::Timestamp::ValueType, const common::Data& data, SendPromise::Pointer promise) = 0;
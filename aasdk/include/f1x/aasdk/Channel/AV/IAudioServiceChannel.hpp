@@ -44,9 +44,11 @@ public:
     virtual ~IAudioServiceChannel() = default;
 
     virtual void receive(IAudioServiceChannelEventHandler::Pointer eventHandler) = 0;
+    virtual void subscribe(IAudioServiceChannelEventHandler::Pointer eventHandler) = 0;
     virtual void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication, SendPromise::Pointer promise) = 0;
+    virtual void sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication) = 0;
     virtual messenger::ChannelId getId() const = 0;
 };
 
@@ -45,10 +45,12 @@ public:
     virtual ~IVideoServiceChannel() = default;
 
     virtual void receive(IVideoServiceChannelEventHandler::Pointer eventHandler) = 0;
+    virtual void subscribe(IVideoServiceChannelEventHandler::Pointer eventHandler) = 0;
     virtual void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendVideoFocusIndication(const proto::messages::VideoFocusIndication& indication, SendPromise::Pointer promise) = 0;
     virtual void sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication, SendPromise::Pointer promise) = 0;
+    virtual void sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication) = 0;
     virtual messenger::ChannelId getId() const = 0;
 };
 
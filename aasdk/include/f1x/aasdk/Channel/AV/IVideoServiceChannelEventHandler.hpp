@@ -24,6 +24,8 @@
 #include <aasdk_proto/VideoFocusRequestMessage.pb.h>
 #include <aasdk_proto/AVChannelStopIndicationMessage.pb.h>
 #include <f1x/aasdk/Messenger/Timestamp.hpp>
+#include <f1x/aasdk/Messenger/MessageBuffer.hpp>
+#include <f1x/aasdk/Messenger/FrameType.hpp>
 #include <f1x/aasdk/Common/Data.hpp>
 #include <f1x/aasdk/Error/Error.hpp>
 
@@ -50,6 +52,21 @@ public:
     virtual void onAVChannelStopIndication(const proto::messages::AVChannelStopIndication& indication) = 0;
     virtual void onAVMediaWithTimestampIndication(messenger::Timestamp::ValueType, const common::DataConstBuffer& buffer) = 0;
     virtual void onAVMediaIndication(const common::DataConstBuffer& buffer) = 0;
+    // Variants holding the received message, so the media can be queued by the output without copying.
+    // By default they hand the bytes to the variants above, which have to consume them before returning.
+    virtual void onAVMediaWithTimestampBuffer(messenger::Timestamp::ValueType timestamp, messenger::MessageBuffer buffer)
+    {
+        this->onAVMediaWithTimestampIndication(timestamp, buffer.getData());
+    }
+
+    virtual void onAVMediaBuffer(messenger::MessageBuffer buffer)
+    {
+        this->onAVMediaIndication(buffer.getData());
+    }
+
+    // Part of AV media delivered by a streaming channel before the whole message arrived.
+    // Fragments come as FIRST, any number of MIDDLE and LAST, all with timestamp of the media.
+    virtual void onAVMediaFragment(messenger::FrameType fragmentType, messenger::Timestamp::ValueType timestamp, const common::DataConstBuffer& buffer) = 0;
     virtual void onVideoFocusRequest(const proto::messages::VideoFocusRequest& request) = 0;
     virtual void onChannelError(const error::Error& e) = 0;
 };
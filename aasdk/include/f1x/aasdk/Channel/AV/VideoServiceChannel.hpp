@@ -18,7 +18,7 @@
 
 #pragma once
 
-#include <f1x/aasdk/Channel/ServiceChannel.hpp>
+#include <f1x/aasdk/Channel/TypedServiceChannel.hpp>
 #include <f1x/aasdk/Channel/AV/IVideoServiceChannel.hpp>
 
 namespace f1x
@@ -30,27 +30,39 @@ namespace channel
 namespace av
 {
 
-class VideoServiceChannel: public IVideoServiceChannel, public ServiceChannel, public std::enable_shared_from_this<VideoServiceChannel>
+class VideoServiceChannel: public IVideoServiceChannel,
+                           public TypedServiceChannel<VideoServiceChannel, IVideoServiceChannelEventHandler,
+                                                      proto::messages::AVChannelSetupRequest,
+                                                      proto::messages::AVChannelStartIndication,
+                                                      proto::messages::AVChannelStopIndication,
+                                                      proto::messages::ChannelOpenRequest,
+                                                      proto::messages::VideoFocusRequest>,
+                           public std::enable_shared_from_this<VideoServiceChannel>
 {
 public:
     VideoServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger);
 
     void receive(IVideoServiceChannelEventHandler::Pointer eventHandler) override;
+    void subscribe(IVideoServiceChannelEventHandler::Pointer eventHandler) override;
     void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) override;
     void sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise) override;
     void sendVideoFocusIndication(const proto::messages::VideoFocusIndication& indication, SendPromise::Pointer promise) override;
     void sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication, SendPromise::Pointer promise) override;
+    void sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication) override;
     messenger::ChannelId getId() const override;
 
 private:
+    friend TypedServiceChannel;
     using std::enable_shared_from_this<VideoServiceChannel>::shared_from_this;
     void messageHandler(messenger::Message::Pointer message, IVideoServiceChannelEventHandler::Pointer eventHandler);
-    void handleAVChannelSetupRequest(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler);
-    void handleStartIndication(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler);
-    void handleStopIndication(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler);
-    void handleChannelOpenRequest(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler);
-    void handleVideoFocusRequest(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler);
-    void handleAVMediaWithTimestampIndication(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler);
+    void fragmentHandler(messenger::Message::Pointer message, IVideoServiceChannelEventHandler::Pointer eventHandler);
+    void handleAVMediaWithTimestampIndication(messenger::Message::Pointer message, size_t offset, IVideoServiceChannelEventHandler::Pointer eventHandler);
+
+    bool mediaFragmentInProgress_;
+    messenger::Timestamp::ValueType fragmentTimestamp_;
+    messenger::Message::Pointer fragmentedMessage_;
+
+    static const MessageHandlers<5> cMessageHandlers;
 };
 
 }
@@ -18,7 +18,7 @@
 
 #pragma once
 
-#include <f1x/aasdk/Channel/ServiceChannel.hpp>
+#include <f1x/aasdk/Channel/TypedServiceChannel.hpp>
 #include <f1x/aasdk/Channel/Bluetooth/IBluetoothServiceChannel.hpp>
 
 namespace f1x
@@ -30,21 +30,26 @@ namespace channel
 namespace bluetooth
 {
 
-class BluetoothServiceChannel: public IBluetoothServiceChannel, public ServiceChannel, public std::enable_shared_from_this<BluetoothServiceChannel>
+class BluetoothServiceChannel: public IBluetoothServiceChannel,
+                               public TypedServiceChannel<BluetoothServiceChannel, IBluetoothServiceChannelEventHandler,
+                                                          proto::messages::ChannelOpenRequest,
+                                                          proto::messages::BluetoothPairingRequest>,
+                               public std::enable_shared_from_this<BluetoothServiceChannel>
 {
 public:
     BluetoothServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger);
 
     void receive(IBluetoothServiceChannelEventHandler::Pointer eventHandler) override;
+    void subscribe(IBluetoothServiceChannelEventHandler::Pointer eventHandler) override;
     messenger::ChannelId getId() const override;
     void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) override;
     void sendBluetoothPairingResponse(const proto::messages::BluetoothPairingResponse& response, SendPromise::Pointer promise) override;
 
 private:
+    friend TypedServiceChannel;
     using std::enable_shared_from_this<BluetoothServiceChannel>::shared_from_this;
-    void messageHandler(messenger::Message::Pointer message, IBluetoothServiceChannelEventHandler::Pointer eventHandler);
-    void handleChannelOpenRequest(const common::DataConstBuffer& payload, IBluetoothServiceChannelEventHandler::Pointer eventHandler);
-    void handleBluetoothPairingRequest(const common::DataConstBuffer& payload, IBluetoothServiceChannelEventHandler::Pointer eventHandler);
+
+    static const MessageHandlers<2> cMessageHandlers;
 };
 
 }
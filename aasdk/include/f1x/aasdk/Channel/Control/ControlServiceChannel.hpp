@@ -20,7 +20,7 @@
 
 #include <boost/asio.hpp>
 #include <f1x/aasdk/Messenger/IMessenger.hpp>
-#include <f1x/aasdk/Channel/ServiceChannel.hpp>
+#include <f1x/aasdk/Channel/TypedServiceChannel.hpp>
 #include <f1x/aasdk/Channel/Control/IControlServiceChannel.hpp>
 
 namespace f1x
@@ -32,12 +32,22 @@ namespace channel
 namespace control
 {
 
-class ControlServiceChannel: public IControlServiceChannel, public ServiceChannel, public std::enable_shared_from_this<ControlServiceChannel>
+class ControlServiceChannel: public IControlServiceChannel,
+                             public TypedServiceChannel<ControlServiceChannel, IControlServiceChannelEventHandler,
+                                                        proto::messages::ServiceDiscoveryRequest,
+                                                        proto::messages::AudioFocusRequest,
+                                                        proto::messages::ShutdownRequest,
+                                                        proto::messages::ShutdownResponse,
+                                                        proto::messages::NavigationFocusRequest,
+                                                        proto::messages::PingRequest,
+                                                        proto::messages::PingResponse>,
+                             public std::enable_shared_from_this<ControlServiceChannel>
 {
 public:
     ControlServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger);
 
     void receive(IControlServiceChannelEventHandler::Pointer eventHandler) override;
+    void subscribe(IControlServiceChannelEventHandler::Pointer eventHandler) override;
 
     void sendVersionRequest(SendPromise::Pointer promise) override;
     void sendHandshake(common::Data handshakeBuffer, SendPromise::Pointer promise) override;
@@ -51,17 +61,13 @@ public:
     void sendPingResponse(const proto::messages::PingResponse& response, SendPromise::Pointer promise) override;
 
 private:
+    friend TypedServiceChannel;
     using std::enable_shared_from_this<ControlServiceChannel>::shared_from_this;
-    void messageHandler(messenger::Message::Pointer message, IControlServiceChannelEventHandler::Pointer eventHandler);
 
     void handleVersionResponse(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
-    void handleServiceDiscoveryRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
-    void handleAudioFocusRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
-    void handleShutdownRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
-    void handleShutdownResponse(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
-    void handleNavigationFocusRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
-    void handlePingRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
-    void handlePingResponse(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
+    void handleHandshake(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler);
+
+    static const MessageHandlers<9> cMessageHandlers;
 };
 
 }
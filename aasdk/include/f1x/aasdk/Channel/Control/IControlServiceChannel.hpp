@@ -48,6 +48,7 @@ public:
     virtual ~IControlServiceChannel() = default;
 
     virtual void receive(IControlServiceChannelEventHandler::Pointer eventHandler) = 0;
+    virtual void subscribe(IControlServiceChannelEventHandler::Pointer eventHandler) = 0;
 
     virtual void sendVersionRequest(SendPromise::Pointer promise) = 0;
     virtual void sendHandshake(common::Data handshakeBuffer, SendPromise::Pointer promise) = 0;
@@ -45,8 +45,10 @@ public:
     virtual ~IInputServiceChannel() = default;
 
     virtual void receive(IInputServiceChannelEventHandler::Pointer eventHandler) = 0;
+    virtual void subscribe(IInputServiceChannelEventHandler::Pointer eventHandler) = 0;
     virtual void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendInputEventIndication(const proto::messages::InputEventIndication& indication, SendPromise::Pointer promise) = 0;
+    virtual void sendInputEventIndication(const proto::messages::InputEventIndication& indication) = 0;
     virtual void sendBindingResponse(const proto::messages::BindingResponse& response, SendPromise::Pointer promise) = 0;
     virtual messenger::ChannelId getId() const = 0;
 };
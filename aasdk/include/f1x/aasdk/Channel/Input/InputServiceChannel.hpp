@@ -18,7 +18,7 @@
 
 #pragma once
 
-#include <f1x/aasdk/Channel/ServiceChannel.hpp>
+#include <f1x/aasdk/Channel/TypedServiceChannel.hpp>
 #include <f1x/aasdk/Channel/Input/IInputServiceChannel.hpp>
 
 namespace f1x
@@ -30,22 +30,28 @@ namespace channel
 namespace input
 {
 
-class InputServiceChannel: public IInputServiceChannel, public ServiceChannel, public std::enable_shared_from_this<InputServiceChannel>
+class InputServiceChannel: public IInputServiceChannel,
+                           public TypedServiceChannel<InputServiceChannel, IInputServiceChannelEventHandler,
+                                                      proto::messages::BindingRequest,
+                                                      proto::messages::ChannelOpenRequest>,
+                           public std::enable_shared_from_this<InputServiceChannel>
 {
  public:
     InputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger);
 
     void receive(IInputServiceChannelEventHandler::Pointer eventHandler) override;
+    void subscribe(IInputServiceChannelEventHandler::Pointer eventHandler) override;
     void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) override;
     void sendInputEventIndication(const proto::messages::InputEventIndication& indication, SendPromise::Pointer promise) override;
+    void sendInputEventIndication(const proto::messages::InputEventIndication& indication) override;
     void sendBindingResponse(const proto::messages::BindingResponse& response, SendPromise::Pointer promise) override;
     messenger::ChannelId getId() const override;
 
 private:
+    friend TypedServiceChannel;
     using std::enable_shared_from_this<InputServiceChannel>::shared_from_this;
-    void messageHandler(messenger::Message::Pointer message, IInputServiceChannelEventHandler::Pointer eventHandler);
-    void handleBindingRequest(const common::DataConstBuffer& payload, IInputServiceChannelEventHandler::Pointer eventHandler);
-    void handleChannelOpenRequest(const common::DataConstBuffer& payload, IInputServiceChannelEventHandler::Pointer eventHandler);
+
+    static const MessageHandlers<2> cMessageHandlers;
 };
 
 }
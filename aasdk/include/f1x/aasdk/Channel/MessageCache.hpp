@@ -0,0 +1,105 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/Common/Data.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+
+// Parse targets of the messages received by a channel. Every message of a type is parsed into the same
+// instance; ParseFromArray() clears it but keeps the memory of its strings, sub-messages and repeated fields,
+// so once each type has been seen parsing does not allocate anymore. Used only on the channel strand.
+template<typename... MessageTypes>
+class MessageCache: boost::noncopyable
+{
+public:
+    // Returns the cached message to the cache, or deletes a temporary one.
+    class Releaser
+    {
+    public:
+        explicit Releaser(bool* inUse = nullptr)
+            : inUse_(inUse)
+        {
+
+        }
+
+        template<typename MessageType>
+        void operator()(const MessageType* message) const
+        {
+            if(inUse_ != nullptr)
+            {
+                *inUse_ = false;
+            }
+            else
+            {
+                delete message;
+            }
+        }
+
+    private:
+        bool* inUse_;
+    };
+
+    template<typename MessageType>
+    using Pointer = std::unique_ptr<const MessageType, Releaser>;
+
+    // Empty pointer if the payload cannot be parsed. While the returned message is alive, a nested parse
+    // of the same type (a handler receiving the next message in place) gets a temporary instance.
+    template<typename MessageType>
+    Pointer<MessageType> parse(const common::DataConstBuffer& payload)
+    {
+        auto& entry = std::get<Entry<MessageType>>(entries_);
+
+        if(entry.inUse)
+        {
+            std::unique_ptr<MessageType> message(new MessageType());
+            return Pointer<MessageType>(message->ParseFromArray(payload.cdata, payload.size) ? message.release() : nullptr, Releaser());
+        }
+
+        if(!entry.message.ParseFromArray(payload.cdata, payload.size))
+        {
+            return Pointer<MessageType>(nullptr, Releaser());
+        }
+
+        entry.inUse = true;
+        return Pointer<MessageType>(&entry.message, Releaser(&entry.inUse));
+    }
+
+private:
+    template<typename MessageType>
+    struct Entry
+    {
+        MessageType message;
+        bool inUse = false;
+    };
+
+    std::tuple<Entry<MessageTypes>...> entries_;
+};
+
+}
+}
+}
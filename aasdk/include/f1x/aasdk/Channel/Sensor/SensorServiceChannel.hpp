@@ -18,7 +18,7 @@
 
 #pragma once
 
-#include <f1x/aasdk/Channel/ServiceChannel.hpp>
+#include <f1x/aasdk/Channel/TypedServiceChannel.hpp>
 #include <f1x/aasdk/Channel/Sensor/ISensorServiceChannel.hpp>
 
 namespace f1x
@@ -30,22 +30,28 @@ namespace channel
 namespace sensor
 {
 
-class SensorServiceChannel: public ISensorServiceChannel, public ServiceChannel, public std::enable_shared_from_this<SensorServiceChannel>
+class SensorServiceChannel: public ISensorServiceChannel,
+                            public TypedServiceChannel<SensorServiceChannel, ISensorServiceChannelEventHandler,
+                                                       proto::messages::SensorStartRequestMessage,
+                                                       proto::messages::ChannelOpenRequest>,
+                            public std::enable_shared_from_this<SensorServiceChannel>
 {
 public:
     SensorServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger);
 
     void receive(ISensorServiceChannelEventHandler::Pointer eventHandler) override;
+    void subscribe(ISensorServiceChannelEventHandler::Pointer eventHandler) override;
     messenger::ChannelId getId() const override;
     void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) override;
     void sendSensorEventIndication(const proto::messages::SensorEventIndication& indication, SendPromise::Pointer promise) override;
+    void sendSensorEventIndication(const proto::messages::SensorEventIndication& indication) override;
     void sendSensorStartResponse(const proto::messages::SensorStartResponseMessage& response, SendPromise::Pointer promise) override;
 
 private:
+    friend TypedServiceChannel;
     using std::enable_shared_from_this<SensorServiceChannel>::shared_from_this;
-    void messageHandler(messenger::Message::Pointer message, ISensorServiceChannelEventHandler::Pointer eventHandler);
-    void handleSensorStartRequest(const common::DataConstBuffer& payload, ISensorServiceChannelEventHandler::Pointer eventHandler);
-    void handleChannelOpenRequest(const common::DataConstBuffer& payload, ISensorServiceChannelEventHandler::Pointer eventHandler);
+
+    static const MessageHandlers<2> cMessageHandlers;
 };
 
 }
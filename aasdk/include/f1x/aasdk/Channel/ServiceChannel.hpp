@@ -38,10 +38,13 @@ protected:
 
     virtual ~ServiceChannel() = default;
     void send(messenger::Message::Pointer message, SendPromise::Pointer promise);
+    void send(messenger::Message::Pointer message);
+    void subscribe(messenger::ChannelSubscription::MessageHandler messageHandler, messenger::ChannelSubscription::ErrorHandler errorHandler);
 
     boost::asio::io_service::strand& strand_;
     messenger::IMessenger::Pointer messenger_;
     messenger::ChannelId channelId_;
+    bool subscribed_;
 };
 
 }
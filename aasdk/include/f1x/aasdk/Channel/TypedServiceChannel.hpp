@@ -0,0 +1,138 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <f1x/aasdk/Messenger/MessageId.hpp>
+#include <f1x/aasdk/Channel/ServiceChannel.hpp>
+#include <f1x/aasdk/Channel/MessageCache.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+
+// Receive path shared by the service channels. A channel declares the messages it handles in a constant
+// table, ChannelType::cMessageHandlers, mapping message ids to payload handlers. Protobuf messages are
+// handled by parse<MessageType, &EventHandlerType::method>, which parses into the channel MessageCache
+// and calls the event handler, so a new message costs one table entry.
+// ChannelType may provide its own messageHandler() (e.g. to handle fragments) which calls dispatch().
+template<typename ChannelType, typename EventHandlerType, typename... MessageTypes>
+class TypedServiceChannel: public ServiceChannel
+{
+protected:
+    typedef std::shared_ptr<EventHandlerType> EventHandlerPointer;
+    typedef void(ChannelType::*PayloadHandler)(const common::DataConstBuffer& payload, EventHandlerPointer eventHandler);
+
+    struct MessageHandlerEntry
+    {
+        uint16_t messageId;
+        PayloadHandler handler;
+    };
+
+    template<size_t MessageHandlersCount>
+    using MessageHandlers = std::array<MessageHandlerEntry, MessageHandlersCount>;
+
+    TypedServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, messenger::ChannelId channelId)
+        : ServiceChannel(strand, std::move(messenger), channelId)
+    {
+
+    }
+
+    void receiveMessage(EventHandlerPointer eventHandler)
+    {
+        auto self = this->getChannel().shared_from_this();
+        auto receivePromise = messenger::ReceivePromise::defer(strand_);
+        receivePromise->then([self, eventHandler](messenger::Message::Pointer message) mutable {
+                                 self->messageHandler(std::move(message), std::move(eventHandler));
+                             },
+                             [eventHandler](const error::Error& e) {
+                                 eventHandler->onChannelError(e);
+                             });
+
+        messenger_->enqueueReceive(channelId_, std::move(receivePromise));
+    }
+
+    void subscribeMessages(EventHandlerPointer eventHandler)
+    {
+        auto self = this->getChannel().shared_from_this();
+        ServiceChannel::subscribe([self, eventHandler](messenger::Message::Pointer message) {
+                                      self->messageHandler(std::move(message), eventHandler);
+                                  },
+                                  [eventHandler](const error::Error& e) {
+                                      eventHandler->onChannelError(e);
+                                  });
+    }
+
+    void messageHandler(messenger::Message::Pointer message, EventHandlerPointer eventHandler)
+    {
+        this->dispatch(std::move(message), std::move(eventHandler));
+    }
+
+    void dispatch(messenger::Message::Pointer message, EventHandlerPointer eventHandler)
+    {
+        messenger::MessageId messageId(message->getPayload());
+        common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
+
+        // Linear scan, a channel handles at most a handful of message ids.
+        for(const auto& entry : ChannelType::cMessageHandlers)
+        {
+            if(entry.messageId == messageId.getId())
+            {
+                (this->getChannel().*entry.handler)(payload, std::move(eventHandler));
+                return;
+            }
+        }
+
+        AASDK_LOG(error) << "[" << messenger::channelIdToString(channelId_) << "] message not handled: " << messageId.getId();
+        if(!subscribed_)
+        {
+            this->getChannel().receive(std::move(eventHandler));
+        }
+    }
+
+    template<typename MessageType, void(EventHandlerType::*Method)(const MessageType&)>
+    void parse(const common::DataConstBuffer& payload, EventHandlerPointer eventHandler)
+    {
+        auto message = messageCache_.template parse<MessageType>(payload);
+        if(message != nullptr)
+        {
+            ((*eventHandler).*Method)(*message);
+        }
+        else
+        {
+            eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
+        }
+    }
+
+private:
+    ChannelType& getChannel()
+    {
+        return static_cast<ChannelType&>(*this);
+    }
+
+    MessageCache<MessageTypes...> messageCache_;
+};
+
+}
+}
+}
@@ -0,0 +1,179 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <stdint.h>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+struct DefaultInit {};
+static constexpr DefaultInit cDefaultInit{};
+
+// Vector of bytes which copies, moves and fills with memcpy, memmove and memset, so its cost does not depend
+// on the optimization level. Growing it with resize(size, cDefaultInit) leaves the new bytes uninitialized,
+// for buffers which are written right after. Every other way of growing it initializes the bytes like std::vector.
+class ByteBuffer
+{
+public:
+    typedef uint8_t value_type;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type* iterator;
+    typedef const value_type* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    ByteBuffer() noexcept;
+    explicit ByteBuffer(size_type size);
+    ByteBuffer(size_type size, value_type value);
+    ByteBuffer(size_type size, DefaultInit);
+    ByteBuffer(std::initializer_list<value_type> values);
+    ByteBuffer(const ByteBuffer& other);
+    ByteBuffer(ByteBuffer&& other) noexcept;
+    ~ByteBuffer();
+
+    template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+    ByteBuffer(InputIterator first, InputIterator last)
+        : ByteBuffer()
+    {
+        this->insert(this->end(), first, last);
+    }
+
+    ByteBuffer& operator=(const ByteBuffer& other);
+    ByteBuffer& operator=(ByteBuffer&& other) noexcept;
+    ByteBuffer& operator=(std::initializer_list<value_type> values);
+
+    iterator begin() noexcept { return data_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator cbegin() const noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+    const_iterator cend() const noexcept { return data_ + size_; }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+    pointer data() noexcept { return data_; }
+    const_pointer data() const noexcept { return data_; }
+    reference operator[](size_type index) { return data_[index]; }
+    const_reference operator[](size_type index) const { return data_[index]; }
+    reference at(size_type index);
+    const_reference at(size_type index) const;
+    reference front() { return data_[0]; }
+    const_reference front() const { return data_[0]; }
+    reference back() { return data_[size_ - 1]; }
+    const_reference back() const { return data_[size_ - 1]; }
+
+    void reserve(size_type capacity);
+    void shrink_to_fit();
+    void resize(size_type size);
+    void resize(size_type size, value_type value);
+    void resize(size_type size, DefaultInit);
+    void clear() noexcept { size_ = 0; }
+    void swap(ByteBuffer& other) noexcept;
+
+    void push_back(value_type value);
+    void pop_back() { --size_; }
+    void assign(size_type count, value_type value);
+
+    iterator insert(const_iterator position, value_type value);
+    iterator insert(const_iterator position, size_type count, value_type value);
+    iterator insert(const_iterator position, std::initializer_list<value_type> values);
+
+    template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last)
+    {
+        return this->insertRange(position, first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+    }
+
+    template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+    void assign(InputIterator first, InputIterator last)
+    {
+        this->clear();
+        this->insert(this->end(), first, last);
+    }
+
+    iterator erase(const_iterator position);
+    iterator erase(const_iterator first, const_iterator last);
+
+private:
+    // Opens a gap of count uninitialized bytes at position and returns its beginning.
+    iterator makeGap(const_iterator position, size_type count);
+    void reallocate(size_type capacity);
+    size_type getGrownCapacity(size_type size) const;
+
+    template<typename ForwardIterator>
+    iterator insertRange(const_iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+    {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        auto gap = this->makeGap(position, count);
+        std::copy(first, last, gap);
+        return gap;
+    }
+
+    template<typename InputIterator>
+    iterator insertRange(const_iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+    {
+        const auto offset = position - data_;
+        ByteBuffer values;
+
+        for(; first != last; ++first)
+        {
+            values.push_back(*first);
+        }
+
+        return this->insertRange(data_ + offset, values.cbegin(), values.cend(), std::forward_iterator_tag());
+    }
+
+    value_type* data_;
+    size_type size_;
+    size_type capacity_;
+};
+
+bool operator==(const ByteBuffer& left, const ByteBuffer& right);
+bool operator!=(const ByteBuffer& left, const ByteBuffer& right);
+bool operator<(const ByteBuffer& left, const ByteBuffer& right);
+
+inline void swap(ByteBuffer& left, ByteBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+}
+}
+}
@@ -21,7 +21,9 @@
 #include <vector>
 #include <string>
 #include <cstddef>
+#include <cstring>
 #include <stdint.h>
+#include <f1x/aasdk/Common/ByteBuffer.hpp>
 
 namespace f1x
 {
@@ -30,7 +32,8 @@ namespace aasdk
 namespace common
 {
 
-typedef std::vector<uint8_t> Data;
+// Use resize(size, cDefaultInit) to grow the buffer without zero-filling bytes which are written right after.
+typedef ByteBuffer Data;
 
 static constexpr size_t cStaticDataSize = 30 * 1024 * 1024;
 
@@ -65,7 +68,7 @@ template<typename DataType>
 void copy(DataType& data, const DataBuffer& buffer)
 {
     size_t offset = data.size();
-    data.resize(data.size() + buffer.size);
+    data.resize(data.size() + buffer.size, cDefaultInit);
     memcpy(&data[offset], buffer.data, buffer.size);
 }
 
@@ -73,7 +76,7 @@ template<typename DataType>
 void copy(DataType& data, const DataConstBuffer& buffer)
 {
     size_t offset = data.size();
-    data.resize(data.size() + buffer.size);
+    data.resize(data.size() + buffer.size, cDefaultInit);
     memcpy(&data[offset], buffer.cdata, buffer.size);
 }
 
@@ -0,0 +1,109 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+// Acquisition, contention, wait and hold time statistics of named locks.
+// Filled by ProfiledMutex only when aasdk is built with AASDK_LOCK_PROFILER.
+class LockProfiler: boost::noncopyable
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // Bucket 0 counts durations below 1 us, bucket i durations in [2^(i-1), 2^i) us, the last one everything longer.
+    static constexpr size_t cBucketsCount = 16;
+    typedef std::array<size_t, cBucketsCount> Histogram;
+
+    struct Statistics
+    {
+        std::string name;
+        size_t acquisitionsCount;
+        size_t contendedCount;
+        Clock::duration totalWaitTime;
+        Clock::duration maxWaitTime;
+        Clock::duration totalHoldTime;
+        Clock::duration maxHoldTime;
+        Histogram waitHistogram;
+        Histogram holdHistogram;
+    };
+
+    // Counters shared by all mutexes constructed with the same name.
+    class Lock: boost::noncopyable
+    {
+    public:
+        explicit Lock(std::string name);
+
+        void acquired(Clock::duration waitTime, bool contended);
+        void released(Clock::duration holdTime);
+        Statistics getStatistics() const;
+        void reset();
+
+    private:
+        typedef std::array<std::atomic<size_t>, cBucketsCount> AtomicHistogram;
+
+        static void record(AtomicHistogram& histogram, std::atomic<Clock::rep>& total, std::atomic<Clock::rep>& max, Clock::duration duration);
+        static Histogram load(const AtomicHistogram& histogram);
+
+        std::string name_;
+        std::atomic<size_t> acquisitionsCount_;
+        std::atomic<size_t> contendedCount_;
+        std::atomic<Clock::rep> totalWaitTime_;
+        std::atomic<Clock::rep> maxWaitTime_;
+        std::atomic<Clock::rep> totalHoldTime_;
+        std::atomic<Clock::rep> maxHoldTime_;
+        AtomicHistogram waitHistogram_;
+        AtomicHistogram holdHistogram_;
+    };
+
+    static LockProfiler& getInstance();
+
+    Lock& getLock(const std::string& name);
+    std::vector<Statistics> getStatistics() const;
+    void dump() const;
+    void reset();
+
+    static size_t getBucket(Clock::duration duration);
+    static bool isEnabled();
+
+private:
+    LockProfiler() = default;
+
+    std::map<std::string, std::unique_ptr<Lock>> locks_;
+    mutable std::mutex mutex_;
+};
+
+}
+}
+}
@@ -0,0 +1,101 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+class MemoryReservation;
+
+// Accounts the large buffers of all components against one limit shared by the process.
+// A component asks for the size it would like to have and is granted less once the budget
+// is exhausted, but never less than the minimum it needs to work.
+class MemoryBudget: boost::noncopyable
+{
+public:
+    struct Statistics
+    {
+        std::string name;
+        size_t reservationsCount;
+        size_t currentSize;
+        size_t peakSize;
+    };
+
+    static MemoryBudget& getInstance();
+
+    MemoryReservation reserve(const std::string& component, size_t desiredSize, size_t minimumSize);
+    void setLimit(size_t limit);
+    size_t getLimit() const;
+    Statistics getTotalStatistics() const;
+    std::vector<Statistics> getStatistics() const;
+    void dump() const;
+
+    static constexpr size_t cUnlimited = std::numeric_limits<size_t>::max();
+
+private:
+    friend class MemoryReservation;
+
+    MemoryBudget();
+    void resize(Statistics& account, size_t currentSize, size_t newSize);
+
+    Statistics total_;
+    std::map<std::string, std::unique_ptr<Statistics>> accounts_;
+    size_t limit_;
+    mutable std::mutex mutex_;
+};
+
+// Size granted to a component by the MemoryBudget, given back when the reservation is destroyed.
+class MemoryReservation
+{
+public:
+    MemoryReservation();
+    MemoryReservation(MemoryReservation&& other);
+    MemoryReservation& operator=(MemoryReservation&& other);
+    ~MemoryReservation();
+
+    size_t getSize() const;
+    // Accounts a buffer which had to grow beyond the granted size, even above the limit.
+    void resize(size_t size);
+
+private:
+    friend class MemoryBudget;
+
+    MemoryReservation(MemoryBudget& budget, MemoryBudget::Statistics& account, size_t size);
+    void release();
+
+    MemoryBudget* budget_;
+    MemoryBudget::Statistics* account_;
+    size_t size_;
+};
+
+}
+}
+}
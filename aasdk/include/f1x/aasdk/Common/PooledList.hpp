@@ -0,0 +1,115 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <iterator>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+// std::list which keeps the nodes of erased elements and reuses them for new ones. Elements are moved
+// between the list and the spare nodes by splice(), so iterators of queued elements stay valid exactly
+// as in std::list and a queue reserved for its usual depth allocates nothing in steady state.
+// An erased element is reset to a default constructed value, which releases what it held.
+template<typename ValueType, typename Allocator = std::allocator<ValueType>>
+class PooledList
+{
+public:
+    typedef std::list<ValueType, Allocator> List;
+    typedef typename List::iterator iterator;
+    typedef typename List::const_iterator const_iterator;
+
+    explicit PooledList(size_t reservedCount = 0, const Allocator& allocator = Allocator())
+        : list_(allocator)
+        , spareNodes_(allocator)
+    {
+        this->reserve(reservedCount);
+    }
+
+    void reserve(size_t count)
+    {
+        while(list_.size() + spareNodes_.size() < count)
+        {
+            spareNodes_.emplace_back();
+        }
+    }
+
+    template<typename... Args>
+    iterator emplace_back(Args&&... args)
+    {
+        if(spareNodes_.empty())
+        {
+            list_.emplace_back(std::forward<Args>(args)...);
+        }
+        else
+        {
+            spareNodes_.front() = ValueType(std::forward<Args>(args)...);
+            list_.splice(list_.end(), spareNodes_, spareNodes_.begin());
+        }
+
+        return std::prev(list_.end());
+    }
+
+    iterator erase(iterator element)
+    {
+        auto next = std::next(element);
+        *element = ValueType();
+        spareNodes_.splice(spareNodes_.end(), list_, element);
+        return next;
+    }
+
+    void pop_front()
+    {
+        this->erase(list_.begin());
+    }
+
+    void clear()
+    {
+        for(auto& element : list_)
+        {
+            element = ValueType();
+        }
+
+        spareNodes_.splice(spareNodes_.end(), list_);
+    }
+
+    iterator begin() { return list_.begin(); }
+    iterator end() { return list_.end(); }
+    const_iterator begin() const { return list_.begin(); }
+    const_iterator end() const { return list_.end(); }
+    ValueType& front() { return list_.front(); }
+    const ValueType& front() const { return list_.front(); }
+    size_t size() const { return list_.size(); }
+    bool empty() const { return list_.empty(); }
+    size_t getCapacity() const { return list_.size() + spareNodes_.size(); }
+
+private:
+    List list_;
+    List spareNodes_;
+};
+
+}
+}
+}
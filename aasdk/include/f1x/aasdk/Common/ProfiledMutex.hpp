@@ -0,0 +1,99 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/Common/LockProfiler.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+#ifdef AASDK_LOCK_PROFILER
+// Mutex of a hot path which records every acquisition in the LockProfiler under its name.
+// An uncontended lock costs two clock reads, a contended one three.
+template<typename MutexType>
+class ProfiledMutex: boost::noncopyable
+{
+public:
+    explicit ProfiledMutex(const char* name)
+        : profile_(LockProfiler::getInstance().getLock(name))
+    {
+
+    }
+
+    void lock()
+    {
+        if(mutex_.try_lock())
+        {
+            lockedAt_ = LockProfiler::Clock::now();
+            profile_.acquired(LockProfiler::Clock::duration::zero(), false);
+        }
+        else
+        {
+            const auto begin = LockProfiler::Clock::now();
+            mutex_.lock();
+            lockedAt_ = LockProfiler::Clock::now();
+            profile_.acquired(lockedAt_ - begin, true);
+        }
+    }
+
+    bool try_lock()
+    {
+        if(mutex_.try_lock())
+        {
+            lockedAt_ = LockProfiler::Clock::now();
+            profile_.acquired(LockProfiler::Clock::duration::zero(), false);
+            return true;
+        }
+
+        return false;
+    }
+
+    void unlock()
+    {
+        const auto holdTime = LockProfiler::Clock::now() - lockedAt_;
+        mutex_.unlock();
+        profile_.released(holdTime);
+    }
+
+private:
+    MutexType mutex_;
+    LockProfiler::Lock& profile_;
+    LockProfiler::Clock::time_point lockedAt_;
+};
+#else
+// Mutex of a hot path. The name is used only when aasdk is built with AASDK_LOCK_PROFILER.
+template<typename MutexType>
+class ProfiledMutex: public MutexType
+{
+public:
+    explicit ProfiledMutex(const char*)
+    {
+
+    }
+};
+#endif
+
+}
+}
+}
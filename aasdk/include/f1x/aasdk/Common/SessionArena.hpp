@@ -0,0 +1,168 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/Common/ProfiledMutex.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+// Memory for the objects of one session. Small blocks are carved from pages and recycled through
+// per size class free lists, so a session does not spread its allocations over the global heap.
+// Pages are freed all at once with the arena, that is when the last object allocated from it is gone.
+// Larger blocks, such as the messenger and its streams, are bump allocated from the pages as well
+// and reused only by blocks of the same size. Blocks larger than cMaxLargeBlockSize are taken from the global heap.
+class SessionArena: boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<SessionArena> Pointer;
+
+    struct Statistics
+    {
+        size_t pagesCount;
+        size_t allocatedBlocksCount;
+        size_t largeAllocationsCount;
+    };
+
+    SessionArena();
+    ~SessionArena();
+
+    void* allocate(size_t size);
+    void deallocate(void* block, size_t size);
+    Statistics getStatistics() const;
+
+    static constexpr size_t cPageSize = 256 * 1024;
+    static constexpr size_t cMaxBlockSize = 8 * 1024;
+    static constexpr size_t cMaxLargeBlockSize = cPageSize / 2;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct LargeFreeBlock
+    {
+        LargeFreeBlock* next;
+        size_t size;
+    };
+
+    struct PageHeader
+    {
+        alignas(std::max_align_t) PageHeader* next;
+    };
+
+    static size_t getSizeClass(size_t size);
+    static size_t getBlockSize(size_t sizeClass);
+    static size_t getLargeBlockSize(size_t size);
+    void* allocateLarge(size_t size);
+    void* allocateFromPage(size_t blockSize);
+
+    static constexpr size_t cMinBlockSize = 16;
+    static constexpr size_t cSizeClassesCount = 10;
+
+    PageHeader* pages_;
+    uint8_t* pageCursor_;
+    size_t pageRemainingSize_;
+    std::array<FreeBlock*, cSizeClassesCount> freeBlocks_;
+    LargeFreeBlock* largeFreeBlocks_;
+    Statistics statistics_;
+    // Blocks are given back from whichever thread destroys the object, so the arena locks even in single threaded builds.
+    mutable ProfiledMutex<std::mutex> mutex_;
+};
+
+// Standard allocator on top of a session arena. Copies share the arena and keep it alive,
+// so containers and std::allocate_shared control blocks may safely outlive their creator.
+template<typename ValueType>
+class SessionArenaAllocator
+{
+public:
+    typedef ValueType value_type;
+
+    SessionArenaAllocator(SessionArena::Pointer arena)
+        : arena_(std::move(arena))
+    {
+
+    }
+
+    template<typename OtherType>
+    SessionArenaAllocator(const SessionArenaAllocator<OtherType>& other)
+        : arena_(other.getArena())
+    {
+
+    }
+
+    ValueType* allocate(size_t count)
+    {
+        static_assert(alignof(ValueType) <= alignof(std::max_align_t), "over-aligned types are not supported");
+        return static_cast<ValueType*>(arena_->allocate(count * sizeof(ValueType)));
+    }
+
+    void deallocate(ValueType* block, size_t count)
+    {
+        arena_->deallocate(block, count * sizeof(ValueType));
+    }
+
+    const SessionArena::Pointer& getArena() const
+    {
+        return arena_;
+    }
+
+private:
+    SessionArena::Pointer arena_;
+};
+
+template<typename LeftType, typename RightType>
+bool operator==(const SessionArenaAllocator<LeftType>& left, const SessionArenaAllocator<RightType>& right)
+{
+    return left.getArena() == right.getArena();
+}
+
+template<typename LeftType, typename RightType>
+bool operator!=(const SessionArenaAllocator<LeftType>& left, const SessionArenaAllocator<RightType>& right)
+{
+    return !(left == right);
+}
+
+// std::make_shared which places the object together with its reference count in the arena.
+// Without an arena the global heap is used.
+template<typename ValueType, typename... Args>
+std::shared_ptr<ValueType> allocateShared(const SessionArena::Pointer& arena, Args&&... args)
+{
+    if(arena == nullptr)
+    {
+        return std::make_shared<ValueType>(std::forward<Args>(args)...);
+    }
+
+    return std::allocate_shared<ValueType>(SessionArenaAllocator<ValueType>(arena), std::forward<Args>(args)...);
+}
+
+}
+}
+}
@@ -0,0 +1,73 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+class NullMutex
+{
+public:
+    void lock()
+    {
+
+    }
+
+    bool try_lock()
+    {
+        return true;
+    }
+
+    void unlock()
+    {
+
+    }
+};
+
+template<typename MutexType, size_t IOThreadsCount>
+struct ThreadingPolicy
+{
+    typedef MutexType Mutex;
+    static constexpr size_t cIOThreadsCount = IOThreadsCount;
+};
+
+typedef ThreadingPolicy<std::mutex, 4> MultiThreadedPolicy;
+// Everything touching aasdk objects runs on a single io_service thread, so locks of objects used only by handlers
+// are compiled out. Other threads (USB event handling, UI) may still post into the io_service.
+// MessagePool and SessionArena are released from output threads as well and keep std::mutex regardless of the policy.
+typedef ThreadingPolicy<NullMutex, 1> SingleThreadedPolicy;
+
+#ifdef AASDK_SINGLE_THREADED
+typedef SingleThreadedPolicy DefaultThreadingPolicy;
+#else
+typedef MultiThreadedPolicy DefaultThreadingPolicy;
+#endif
+
+typedef DefaultThreadingPolicy::Mutex Mutex;
+
+}
+}
+}
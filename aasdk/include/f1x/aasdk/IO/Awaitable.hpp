@@ -0,0 +1,226 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#ifdef AASDK_COROUTINES
+
+#include <coroutine>
+#include <optional>
+#include <f1x/aasdk/IO/Promise.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Continuation of a coroutine suspended in co_await. It is a member of the awaiter, so it lives in the coroutine frame
+// and costs no allocation; the promise handlers refer to it through References, which only count themselves.
+// When the last Reference is dropped without resuming, the promise was dropped unsettled and the coroutine frame
+// is destroyed with it, just like a continuation chain is released together with the handlers that hold it.
+class Continuation: boost::noncopyable
+{
+public:
+    class Reference
+    {
+    public:
+        explicit Reference(Continuation& continuation)
+            : continuation_(&continuation)
+        {
+            ++continuation_->referencesCount_;
+        }
+
+        Reference(const Reference& other)
+            : continuation_(other.continuation_)
+        {
+            if(continuation_ != nullptr)
+            {
+                ++continuation_->referencesCount_;
+            }
+        }
+
+        Reference(Reference&& other) noexcept
+            : continuation_(other.continuation_)
+        {
+            other.continuation_ = nullptr;
+        }
+
+        ~Reference()
+        {
+            if(continuation_ != nullptr && --continuation_->referencesCount_ == 0)
+            {
+                continuation_->handle_.destroy();
+            }
+        }
+
+        Reference& operator=(const Reference&) = delete;
+
+        // Gives up the reference before resuming, as the resumed coroutine may end and free the continuation.
+        Continuation& release()
+        {
+            auto continuation = continuation_;
+            continuation_ = nullptr;
+            return *continuation;
+        }
+
+    private:
+        Continuation* continuation_;
+    };
+
+    Continuation()
+        : referencesCount_(0)
+    {
+
+    }
+
+    void suspend(std::coroutine_handle<> handle)
+    {
+        handle_ = handle;
+    }
+
+    void resume()
+    {
+        handle_.resume();
+    }
+
+    void resume(const error::Error& e)
+    {
+        error_.emplace(e);
+        handle_.resume();
+    }
+
+    void rethrow() const
+    {
+        if(error_.has_value())
+        {
+            throw *error_;
+        }
+    }
+
+private:
+    std::coroutine_handle<> handle_;
+    size_t referencesCount_;
+    std::optional<error::Error> error_;
+};
+
+// Suspends the awaiting coroutine until the promise handed to the operation is settled.
+// The coroutine is resumed through the promise, i.e. on the given strand; a rejection is rethrown from co_await.
+template<typename ResolveArgumentType>
+class Awaitable: boost::noncopyable
+{
+public:
+    typedef Promise<ResolveArgumentType> PromiseType;
+    typedef PromiseHandler<void(typename PromiseType::Pointer)> Operation;
+
+    Awaitable(boost::asio::io_service::strand& strand, Operation operation)
+        : strand_(strand)
+        , operation_(std::move(operation))
+    {
+
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        continuation_.suspend(handle);
+
+        auto promise = PromiseType::defer(strand_);
+        promise->then([this, reference = Continuation::Reference(continuation_)](ResolveArgumentType argument) mutable {
+                auto& continuation = reference.release();
+                argument_.emplace(std::move(argument));
+                continuation.resume();
+            },
+            [reference = Continuation::Reference(continuation_)](const error::Error& e) mutable {
+                reference.release().resume(e);
+            });
+
+        // The operation may settle or drop the promise in place, which ends the lifetime of this awaitable.
+        auto operation = std::move(operation_);
+        operation(std::move(promise));
+    }
+
+    ResolveArgumentType await_resume()
+    {
+        continuation_.rethrow();
+        return std::move(*argument_);
+    }
+
+private:
+    boost::asio::io_service::strand& strand_;
+    Operation operation_;
+    Continuation continuation_;
+    std::optional<ResolveArgumentType> argument_;
+};
+
+template<>
+class Awaitable<void>: boost::noncopyable
+{
+public:
+    typedef Promise<void> PromiseType;
+    typedef PromiseHandler<void(PromiseType::Pointer)> Operation;
+
+    Awaitable(boost::asio::io_service::strand& strand, Operation operation)
+        : strand_(strand)
+        , operation_(std::move(operation))
+    {
+
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        continuation_.suspend(handle);
+
+        auto promise = PromiseType::defer(strand_);
+        promise->then([reference = Continuation::Reference(continuation_)]() mutable {
+                reference.release().resume();
+            },
+            [reference = Continuation::Reference(continuation_)](const error::Error& e) mutable {
+                reference.release().resume(e);
+            });
+
+        auto operation = std::move(operation_);
+        operation(std::move(promise));
+    }
+
+    void await_resume()
+    {
+        continuation_.rethrow();
+    }
+
+private:
+    boost::asio::io_service::strand& strand_;
+    Operation operation_;
+    Continuation continuation_;
+};
+
+}
+}
+}
+
+#endif
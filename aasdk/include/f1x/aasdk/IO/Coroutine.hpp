@@ -0,0 +1,83 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#ifdef AASDK_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <f1x/aasdk/IO/PromisePool.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Return type of fire-and-forget coroutines. The coroutine starts immediately, frees its frame when it finishes
+// (or when an awaited promise is dropped unsettled) and must report its outcome itself, usually through an io::Promise,
+// so exceptions must not escape it.
+class Coroutine
+{
+public:
+    struct promise_type
+    {
+        static void* operator new(size_t size)
+        {
+            return PromisePool::allocate(size);
+        }
+
+        static void operator delete(void* frame, size_t size)
+        {
+            PromisePool::deallocate(frame, size);
+        }
+
+        Coroutine get_return_object() noexcept
+        {
+            return Coroutine();
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,50 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Continuations a message went through on its way to the receiver. A continuation resolved on the strand
+// which is already running is executed inline by IOContextWrapper and counted apart from the posted ones.
+class HopCounter
+{
+public:
+    HopCounter();
+
+    void addPosted();
+    void addInline();
+    size_t getPostedCount() const;
+    size_t getInlineCount() const;
+    void reset();
+
+private:
+    size_t postedCount_;
+    size_t inlineCount_;
+};
+
+}
+}
+}
@@ -20,6 +20,8 @@
 
 #include <boost/asio.hpp>
 #include <mutex>
+#include <f1x/aasdk/IO/HopCounter.hpp>
+#include <f1x/aasdk/IO/StallDetector.hpp>
 
 namespace f1x
 {
@@ -35,38 +37,72 @@ public:
     explicit IOContextWrapper(boost::asio::io_service& ioService);
     explicit IOContextWrapper(boost::asio::io_service::strand& strand);
 
+    // Handlers are timed by the StallDetector and reported under the tag, or under their type name if none is given.
     template<typename CompletionHandlerType>
-    void post(CompletionHandlerType&& handler)
+    void post(CompletionHandlerType&& handler, const char* tag = nullptr)
     {
         if(ioService_ != nullptr)
         {
-            ioService_->post(std::move(handler));
+            ioService_->post(StallDetector::wrap(std::move(handler), tag));
         }
         else if(strand_ != nullptr)
         {
-            strand_->post(std::move(handler));
+            strand_->post(StallDetector::wrap(std::move(handler), tag));
         }
     }
 
     template<typename CompletionHandlerType>
-    void dispatch(CompletionHandlerType&& handler)
+    void dispatch(CompletionHandlerType&& handler, const char* tag = nullptr)
     {
         if(ioService_ != nullptr)
         {
-            ioService_->dispatch(std::move(handler));
+            ioService_->dispatch(StallDetector::wrap(std::move(handler), tag));
         }
         else if(strand_ != nullptr)
         {
-            strand_->dispatch(std::move(handler));
+            strand_->dispatch(StallDetector::wrap(std::move(handler), tag));
         }
     }
 
+    // Runs the handler in place when the wrapped strand is already running in the calling thread, otherwise posts it.
+    // Either way is counted by the hop counter, if set, before the handler can release it.
+    template<typename CompletionHandlerType>
+    void execute(CompletionHandlerType&& handler, const char* tag = nullptr)
+    {
+        if(strand_ != nullptr && strand_->running_in_this_thread() && getInlineDepth() < cMaxInlineDepth)
+        {
+            if(hopCounter_ != nullptr)
+            {
+                hopCounter_->addInline();
+            }
+
+            ++getInlineDepth();
+            handler();
+            --getInlineDepth();
+        }
+        else
+        {
+            if(hopCounter_ != nullptr)
+            {
+                hopCounter_->addPosted();
+            }
+
+            this->post(std::move(handler), tag);
+        }
+    }
+
+    void setHopCounter(HopCounter* hopCounter);
     void reset();
     bool isActive() const;
 
+    static constexpr size_t cMaxInlineDepth = 16;
+
 private:
+    static size_t& getInlineDepth();
+
     boost::asio::io_service* ioService_;
     boost::asio::io_service::strand* strand_;
+    HopCounter* hopCounter_;
 };
 
 }
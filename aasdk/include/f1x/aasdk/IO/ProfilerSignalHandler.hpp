@@ -0,0 +1,56 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Dumps the memory budget and the statistics of the running stall detector every time the process receives the signal,
+// and with profilersEnabled also those of the promise and lock profilers.
+class ProfilerSignalHandler: public std::enable_shared_from_this<ProfilerSignalHandler>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<ProfilerSignalHandler> Pointer;
+
+    ProfilerSignalHandler(boost::asio::io_service& ioService, int signalNumber, bool profilersEnabled);
+
+    void start();
+    void stop();
+
+private:
+    using std::enable_shared_from_this<ProfilerSignalHandler>::shared_from_this;
+
+    void signalHandler(const boost::system::error_code& error);
+    void dumpProfilers();
+
+    boost::asio::signal_set signalSet_;
+    bool profilersEnabled_;
+};
+
+}
+}
+}
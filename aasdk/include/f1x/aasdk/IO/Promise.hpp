@@ -18,13 +18,17 @@
 
 #pragma once
 
-#include <functional>
+#include <memory>
 #include <boost/asio.hpp>
 #if BOOST_VERSION >= 106600
 #include <boost/noncopyable.hpp>
 #endif
 #include <f1x/aasdk/Error/Error.hpp>
 #include <f1x/aasdk/IO/IOContextWrapper.hpp>
+#include <f1x/aasdk/IO/PromiseHandler.hpp>
+#include <f1x/aasdk/IO/PromisePool.hpp>
+#include <f1x/aasdk/IO/PromiseProfiler.hpp>
+#include <f1x/aasdk/IO/PromiseState.hpp>
 
 namespace f1x
 {
@@ -39,18 +43,26 @@ class Promise: boost::noncopyable
 public:
     typedef ResolveArgumentType ValueType;
     typedef ErrorArgumentType ErrorType;
-    typedef std::function<void(ResolveArgumentType)> ResolveHandler;
-    typedef std::function<void(ErrorArgumentType)> RejectHandler;
+    typedef PromiseHandler<void(ResolveArgumentType)> ResolveHandler;
+    typedef PromiseHandler<void(ErrorArgumentType)> RejectHandler;
     typedef std::shared_ptr<Promise> Pointer;
 
-    static Pointer defer(boost::asio::io_service& ioService)
+    static Pointer defer(boost::asio::io_service& ioService, PromiseSite site = PromiseSite())
     {
-        return std::make_shared<Promise>(ioService);
+        auto promise = std::allocate_shared<Promise>(PromiseAllocator<Promise>(), ioService);
+#ifdef AASDK_PROMISE_PROFILER
+        promise->record_.start(site);
+#endif
+        return promise;
     }
 
-    static Pointer defer(boost::asio::io_service::strand& strand)
+    static Pointer defer(boost::asio::io_service::strand& strand, PromiseSite site = PromiseSite())
     {
-        return std::make_shared<Promise>(strand);
+        auto promise = std::allocate_shared<Promise>(PromiseAllocator<Promise>(), strand);
+#ifdef AASDK_PROMISE_PROFILER
+        promise->record_.start(site);
+#endif
+        return promise;
     }
 
     Promise(boost::asio::io_service& ioService)
@@ -67,52 +79,72 @@ public:
 
     void then(ResolveHandler resolveHandler, RejectHandler rejectHandler = RejectHandler())
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        if(state_.beginThen())
+        {
+            resolveHandler_ = std::move(resolveHandler);
+            rejectHandler_ = std::move(rejectHandler);
+            state_.endThen();
+        }
+    }
 
-        resolveHandler_ = std::move(resolveHandler);
-        rejectHandler_ = std::move(rejectHandler);
+    // Counts whether settling the promise runs its handler inline or posts it. The counter has to outlive settling only.
+    void setHopCounter(HopCounter* hopCounter)
+    {
+        ioContextWrapper_.setHopCounter(hopCounter);
     }
 
     void resolve(ResolveArgumentType argument)
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
-
-        if(resolveHandler_ != nullptr && this->isPending())
+#ifdef AASDK_PROMISE_PROFILER
+        record_.resolve();
+#endif
+        if(state_.settle())
         {
-            ioContextWrapper_.post([argument = std::move(argument), resolveHandler = std::move(resolveHandler_)]() mutable {
-                resolveHandler(std::move(argument));
-            });
+            rejectHandler_ = RejectHandler();
+
+            if(resolveHandler_ != nullptr)
+            {
+                const auto tag = resolveHandler_.getTypeName();
+                auto handler = [argument = std::move(argument), resolveHandler = std::move(resolveHandler_)]() mutable {
+                    resolveHandler(std::move(argument));
+                };
+
+                IOContextWrapper ioContextWrapper(ioContextWrapper_);
+                ioContextWrapper.execute(std::move(handler), tag);
+            }
         }
-
-        ioContextWrapper_.reset();
-        rejectHandler_ = RejectHandler();
     }
 
     void reject(ErrorArgumentType error)
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
-
-        if(rejectHandler_ != nullptr && this->isPending())
+#ifdef AASDK_PROMISE_PROFILER
+        record_.reject();
+#endif
+        if(state_.settle())
         {
-            ioContextWrapper_.post([error = std::move(error), rejectHandler = std::move(rejectHandler_)]() mutable {
-                rejectHandler(std::move(error));
-            });
+            resolveHandler_ = ResolveHandler();
+
+            if(rejectHandler_ != nullptr)
+            {
+                const auto tag = rejectHandler_.getTypeName();
+                auto handler = [error = std::move(error), rejectHandler = std::move(rejectHandler_)]() mutable {
+                    rejectHandler(std::move(error));
+                };
+
+                IOContextWrapper ioContextWrapper(ioContextWrapper_);
+                ioContextWrapper.execute(std::move(handler), tag);
+            }
         }
-
-        ioContextWrapper_.reset();
-        resolveHandler_ = ResolveHandler();
     }
 
 private:
-    bool isPending() const
-    {
-        return ioContextWrapper_.isActive();
-    }
-
     ResolveHandler resolveHandler_;
     RejectHandler rejectHandler_;
     IOContextWrapper ioContextWrapper_;
-    std::mutex mutex_;
+    PromiseState state_;
+#ifdef AASDK_PROMISE_PROFILER
+    PromiseProfiler::Record record_;
+#endif
 };
 
 template<typename ErrorArgumentType>
@@ -120,18 +152,26 @@ class Promise<void, ErrorArgumentType>: boost::noncopyable
 {
 public:
     typedef ErrorArgumentType ErrorType;
-    typedef std::function<void()> ResolveHandler;
-    typedef std::function<void(ErrorArgumentType)> RejectHandler;
+    typedef PromiseHandler<void()> ResolveHandler;
+    typedef PromiseHandler<void(ErrorArgumentType)> RejectHandler;
     typedef std::shared_ptr<Promise> Pointer;
 
-    static Pointer defer(boost::asio::io_service& ioService)
+    static Pointer defer(boost::asio::io_service& ioService, PromiseSite site = PromiseSite())
     {
-        return std::make_shared<Promise>(ioService);
+        auto promise = std::allocate_shared<Promise>(PromiseAllocator<Promise>(), ioService);
+#ifdef AASDK_PROMISE_PROFILER
+        promise->record_.start(site);
+#endif
+        return promise;
     }
 
-    static Pointer defer(boost::asio::io_service::strand& strand)
+    static Pointer defer(boost::asio::io_service::strand& strand, PromiseSite site = PromiseSite())
     {
-        return std::make_shared<Promise>(strand);
+        auto promise = std::allocate_shared<Promise>(PromiseAllocator<Promise>(), strand);
+#ifdef AASDK_PROMISE_PROFILER
+        promise->record_.start(site);
+#endif
+        return promise;
     }
 
     Promise(boost::asio::io_service& ioService)
@@ -148,70 +188,97 @@ public:
 
     void then(ResolveHandler resolveHandler, RejectHandler rejectHandler = RejectHandler())
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        if(state_.beginThen())
+        {
+            resolveHandler_ = std::move(resolveHandler);
+            rejectHandler_ = std::move(rejectHandler);
+            state_.endThen();
+        }
+    }
 
-        resolveHandler_ = std::move(resolveHandler);
-        rejectHandler_ = std::move(rejectHandler);
+    void setHopCounter(HopCounter* hopCounter)
+    {
+        ioContextWrapper_.setHopCounter(hopCounter);
     }
 
     void resolve()
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
-
-        if(resolveHandler_ != nullptr && this->isPending())
+#ifdef AASDK_PROMISE_PROFILER
+        record_.resolve();
+#endif
+        if(state_.settle())
         {
-            ioContextWrapper_.post([resolveHandler = std::move(resolveHandler_)]() mutable {
-                resolveHandler();
-            });
+            rejectHandler_ = RejectHandler();
+
+            if(resolveHandler_ != nullptr)
+            {
+                const auto tag = resolveHandler_.getTypeName();
+                auto handler = [resolveHandler = std::move(resolveHandler_)]() mutable {
+                    resolveHandler();
+                };
+
+                IOContextWrapper ioContextWrapper(ioContextWrapper_);
+                ioContextWrapper.execute(std::move(handler), tag);
+            }
         }
-
-        ioContextWrapper_.reset();
-        rejectHandler_ = RejectHandler();
     }
 
     void reject(ErrorArgumentType error)
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
-
-        if(rejectHandler_ != nullptr && this->isPending())
+#ifdef AASDK_PROMISE_PROFILER
+        record_.reject();
+#endif
+        if(state_.settle())
         {
-            ioContextWrapper_.post([error = std::move(error), rejectHandler = std::move(rejectHandler_)]() mutable {
-                rejectHandler(std::move(error));
-            });
+            resolveHandler_ = ResolveHandler();
+
+            if(rejectHandler_ != nullptr)
+            {
+                const auto tag = rejectHandler_.getTypeName();
+                auto handler = [error = std::move(error), rejectHandler = std::move(rejectHandler_)]() mutable {
+                    rejectHandler(std::move(error));
+                };
+
+                IOContextWrapper ioContextWrapper(ioContextWrapper_);
+                ioContextWrapper.execute(std::move(handler), tag);
+            }
         }
-
-        ioContextWrapper_.reset();
-        resolveHandler_ = ResolveHandler();
     }
 
 private:
-    bool isPending() const
-    {
-        return ioContextWrapper_.isActive();
-    }
-
     ResolveHandler resolveHandler_;
     RejectHandler rejectHandler_;
     IOContextWrapper ioContextWrapper_;
-    std::mutex mutex_;
+    PromiseState state_;
+#ifdef AASDK_PROMISE_PROFILER
+    PromiseProfiler::Record record_;
+#endif
 };
 
 template<>
 class Promise<void, void>: boost::noncopyable
 {
 public:
-    typedef std::function<void()> ResolveHandler;
-    typedef std::function<void()> RejectHandler;
+    typedef PromiseHandler<void()> ResolveHandler;
+    typedef PromiseHandler<void()> RejectHandler;
     typedef std::shared_ptr<Promise> Pointer;
 
-    static Pointer defer(boost::asio::io_service& ioService)
+    static Pointer defer(boost::asio::io_service& ioService, PromiseSite site = PromiseSite())
     {
-        return std::make_shared<Promise>(ioService);
+        auto promise = std::allocate_shared<Promise>(PromiseAllocator<Promise>(), ioService);
+#ifdef AASDK_PROMISE_PROFILER
+        promise->record_.start(site);
+#endif
+        return promise;
     }
 
-    static Pointer defer(boost::asio::io_service::strand& strand)
+    static Pointer defer(boost::asio::io_service::strand& strand, PromiseSite site = PromiseSite())
     {
-        return std::make_shared<Promise>(strand);
+        auto promise = std::allocate_shared<Promise>(PromiseAllocator<Promise>(), strand);
+#ifdef AASDK_PROMISE_PROFILER
+        promise->record_.start(site);
+#endif
+        return promise;
     }
 
     Promise(boost::asio::io_service& ioService)
@@ -228,52 +295,71 @@ public:
 
     void then(ResolveHandler resolveHandler, RejectHandler rejectHandler = RejectHandler())
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        if(state_.beginThen())
+        {
+            resolveHandler_ = std::move(resolveHandler);
+            rejectHandler_ = std::move(rejectHandler);
+            state_.endThen();
+        }
+    }
 
-        resolveHandler_ = std::move(resolveHandler);
-        rejectHandler_ = std::move(rejectHandler);
+    void setHopCounter(HopCounter* hopCounter)
+    {
+        ioContextWrapper_.setHopCounter(hopCounter);
     }
 
     void resolve()
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
-
-        if(resolveHandler_ != nullptr && this->isPending())
+#ifdef AASDK_PROMISE_PROFILER
+        record_.resolve();
+#endif
+        if(state_.settle())
         {
-            ioContextWrapper_.post([resolveHandler = std::move(resolveHandler_)]() mutable {
-                resolveHandler();
-            });
+            rejectHandler_ = RejectHandler();
+
+            if(resolveHandler_ != nullptr)
+            {
+                const auto tag = resolveHandler_.getTypeName();
+                auto handler = [resolveHandler = std::move(resolveHandler_)]() mutable {
+                    resolveHandler();
+                };
+
+                IOContextWrapper ioContextWrapper(ioContextWrapper_);
+                ioContextWrapper.execute(std::move(handler), tag);
+            }
         }
-
-        ioContextWrapper_.reset();
-        rejectHandler_ = RejectHandler();
     }
 
     void reject()
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
-
-        if(rejectHandler_ != nullptr && this->isPending())
+#ifdef AASDK_PROMISE_PROFILER
+        record_.reject();
+#endif
+        if(state_.settle())
         {
-            ioContextWrapper_.post([rejectHandler = std::move(rejectHandler_)]() mutable {
-                rejectHandler();
-            });
+            resolveHandler_ = ResolveHandler();
+
+            if(rejectHandler_ != nullptr)
+            {
+                const auto tag = rejectHandler_.getTypeName();
+                auto handler = [rejectHandler = std::move(rejectHandler_)]() mutable {
+                    rejectHandler();
+                };
+
+                IOContextWrapper ioContextWrapper(ioContextWrapper_);
+                ioContextWrapper.execute(std::move(handler), tag);
+            }
         }
-
-        ioContextWrapper_.reset();
-        resolveHandler_ = ResolveHandler();
     }
 
 private:
-    bool isPending() const
-    {
-        return ioContextWrapper_.isActive();
-    }
-
     ResolveHandler resolveHandler_;
     RejectHandler rejectHandler_;
     IOContextWrapper ioContextWrapper_;
-    std::mutex mutex_;
+    PromiseState state_;
+#ifdef AASDK_PROMISE_PROFILER
+    PromiseProfiler::Record record_;
+#endif
 };
 
 template<typename ResolveArgumentType>
@@ -281,18 +367,26 @@ class Promise<ResolveArgumentType, void>: boost::noncopyable
 {
 public:
     typedef ResolveArgumentType ValueType;
-    typedef std::function<void(ResolveArgumentType)> ResolveHandler;
-    typedef std::function<void(void)> RejectHandler;
+    typedef PromiseHandler<void(ResolveArgumentType)> ResolveHandler;
+    typedef PromiseHandler<void()> RejectHandler;
     typedef std::shared_ptr<Promise> Pointer;
 
-    static Pointer defer(boost::asio::io_service& ioService)
+    static Pointer defer(boost::asio::io_service& ioService, PromiseSite site = PromiseSite())
     {
-        return std::make_shared<Promise>(ioService);
+        auto promise = std::allocate_shared<Promise>(PromiseAllocator<Promise>(), ioService);
+#ifdef AASDK_PROMISE_PROFILER
+        promise->record_.start(site);
+#endif
+        return promise;
     }
 
-    static Pointer defer(boost::asio::io_service::strand& strand)
+    static Pointer defer(boost::asio::io_service::strand& strand, PromiseSite site = PromiseSite())
     {
-        return std::make_shared<Promise>(strand);
+        auto promise = std::allocate_shared<Promise>(PromiseAllocator<Promise>(), strand);
+#ifdef AASDK_PROMISE_PROFILER
+        promise->record_.start(site);
+#endif
+        return promise;
     }
 
     Promise(boost::asio::io_service& ioService)
@@ -309,55 +403,73 @@ public:
 
     void then(ResolveHandler resolveHandler, RejectHandler rejectHandler = RejectHandler())
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        if(state_.beginThen())
+        {
+            resolveHandler_ = std::move(resolveHandler);
+            rejectHandler_ = std::move(rejectHandler);
+            state_.endThen();
+        }
+    }
 
-        resolveHandler_ = std::move(resolveHandler);
-        rejectHandler_ = std::move(rejectHandler);
+    void setHopCounter(HopCounter* hopCounter)
+    {
+        ioContextWrapper_.setHopCounter(hopCounter);
     }
 
     void resolve(ResolveArgumentType argument)
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
-
-        if(resolveHandler_ != nullptr && this->isPending())
+#ifdef AASDK_PROMISE_PROFILER
+        record_.resolve();
+#endif
+        if(state_.settle())
         {
-            ioContextWrapper_.post([argument = std::move(argument), resolveHandler = std::move(resolveHandler_)]() mutable {
-                resolveHandler(std::move(argument));
-            });
+            rejectHandler_ = RejectHandler();
+
+            if(resolveHandler_ != nullptr)
+            {
+                const auto tag = resolveHandler_.getTypeName();
+                auto handler = [argument = std::move(argument), resolveHandler = std::move(resolveHandler_)]() mutable {
+                    resolveHandler(std::move(argument));
+                };
+
+                IOContextWrapper ioContextWrapper(ioContextWrapper_);
+                ioContextWrapper.execute(std::move(handler), tag);
+            }
         }
-
-        ioContextWrapper_.reset();
-        rejectHandler_ = RejectHandler();
     }
 
     void reject()
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
-
-        if(rejectHandler_ != nullptr && this->isPending())
+#ifdef AASDK_PROMISE_PROFILER
+        record_.reject();
+#endif
+        if(state_.settle())
         {
-            ioContextWrapper_.post([rejectHandler = std::move(rejectHandler_)]() mutable {
-                rejectHandler();
-            });
+            resolveHandler_ = ResolveHandler();
+
+            if(rejectHandler_ != nullptr)
+            {
+                const auto tag = rejectHandler_.getTypeName();
+                auto handler = [rejectHandler = std::move(rejectHandler_)]() mutable {
+                    rejectHandler();
+                };
+
+                IOContextWrapper ioContextWrapper(ioContextWrapper_);
+                ioContextWrapper.execute(std::move(handler), tag);
+            }
         }
-
-        ioContextWrapper_.reset();
-        resolveHandler_ = ResolveHandler();
     }
 
 private:
-    bool isPending() const
-    {
-        return ioContextWrapper_.isActive();
-    }
-
     ResolveHandler resolveHandler_;
     RejectHandler rejectHandler_;
     IOContextWrapper ioContextWrapper_;
-    std::mutex mutex_;
+    PromiseState state_;
+#ifdef AASDK_PROMISE_PROFILER
+    PromiseProfiler::Record record_;
+#endif
 };
 
-
 }
 }
 }
@@ -0,0 +1,271 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+template<typename SignatureType>
+class PromiseHandler;
+
+// Type-erased, copyable callable like std::function, but functors up to cInlineStorageSize bytes
+// (lambdas capturing a few pointers, std::bind of a member function with a shared_ptr) are stored in place.
+template<typename... ArgumentsTypes>
+class PromiseHandler<void(ArgumentsTypes...)>
+{
+public:
+    static constexpr size_t cInlineStorageSize = 48;
+
+    PromiseHandler()
+        : invoker_(nullptr)
+        , manager_(nullptr)
+    {
+
+    }
+
+    PromiseHandler(std::nullptr_t)
+        : PromiseHandler()
+    {
+
+    }
+
+    template<typename FunctorType, typename = typename std::enable_if<!std::is_same<typename std::decay<FunctorType>::type, PromiseHandler>::value>::type>
+    PromiseHandler(FunctorType&& functor)
+        : invoker_(&invoke<typename std::decay<FunctorType>::type>)
+        , manager_(&manage<typename std::decay<FunctorType>::type>)
+    {
+        typedef typename std::decay<FunctorType>::type StoredFunctorType;
+        construct<StoredFunctorType>(&storage_, std::forward<FunctorType>(functor), InPlace<StoredFunctorType>());
+    }
+
+    PromiseHandler(const PromiseHandler& other)
+        : invoker_(other.invoker_)
+        , manager_(other.manager_)
+    {
+        if(manager_ != nullptr)
+        {
+            manager_(Operation::COPY, &storage_, const_cast<StorageType*>(&other.storage_));
+        }
+    }
+
+    PromiseHandler(PromiseHandler&& other) noexcept
+        : invoker_(other.invoker_)
+        , manager_(other.manager_)
+    {
+        if(manager_ != nullptr)
+        {
+            manager_(Operation::MOVE, &storage_, &other.storage_);
+            other.invoker_ = nullptr;
+            other.manager_ = nullptr;
+        }
+    }
+
+    ~PromiseHandler()
+    {
+        this->clear();
+    }
+
+    PromiseHandler& operator=(const PromiseHandler& other)
+    {
+        if(this != &other)
+        {
+            PromiseHandler copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    PromiseHandler& operator=(PromiseHandler&& other) noexcept
+    {
+        if(this != &other)
+        {
+            this->clear();
+
+            if(other.manager_ != nullptr)
+            {
+                other.manager_(Operation::MOVE, &storage_, &other.storage_);
+                invoker_ = other.invoker_;
+                manager_ = other.manager_;
+                other.invoker_ = nullptr;
+                other.manager_ = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    void operator()(ArgumentsTypes... arguments)
+    {
+        invoker_(&storage_, std::forward<ArgumentsTypes>(arguments)...);
+    }
+
+    explicit operator bool() const
+    {
+        return invoker_ != nullptr;
+    }
+
+    friend bool operator==(const PromiseHandler& handler, std::nullptr_t)
+    {
+        return handler.invoker_ == nullptr;
+    }
+
+    friend bool operator!=(const PromiseHandler& handler, std::nullptr_t)
+    {
+        return handler.invoker_ != nullptr;
+    }
+
+    // Mangled name of the stored functor type, used to tag the handler in diagnostics.
+    const char* getTypeName() const
+    {
+        return manager_ != nullptr ? manager_(Operation::TYPE_NAME, nullptr, nullptr) : nullptr;
+    }
+
+    template<typename FunctorType>
+    static constexpr bool isStoredInPlace()
+    {
+        return sizeof(FunctorType) <= cInlineStorageSize && alignof(FunctorType) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible<FunctorType>::value;
+    }
+
+private:
+    typedef typename std::aligned_storage<cInlineStorageSize, alignof(std::max_align_t)>::type StorageType;
+
+    enum class Operation
+    {
+        COPY,
+        MOVE,
+        DESTROY,
+        TYPE_NAME
+    };
+
+    typedef void(*Invoker)(StorageType*, ArgumentsTypes&&...);
+    typedef const char*(*Manager)(Operation, StorageType*, StorageType*);
+
+    void clear()
+    {
+        if(manager_ != nullptr)
+        {
+            manager_(Operation::DESTROY, &storage_, nullptr);
+            invoker_ = nullptr;
+            manager_ = nullptr;
+        }
+    }
+
+    template<typename FunctorType>
+    using InPlace = std::integral_constant<bool, isStoredInPlace<FunctorType>()>;
+
+    template<typename FunctorType>
+    static FunctorType& getFunctor(StorageType* storage, std::true_type)
+    {
+        return *reinterpret_cast<FunctorType*>(storage);
+    }
+
+    template<typename FunctorType>
+    static FunctorType& getFunctor(StorageType* storage, std::false_type)
+    {
+        return **reinterpret_cast<FunctorType**>(storage);
+    }
+
+    template<typename FunctorType, typename InitializerType>
+    static void construct(StorageType* storage, InitializerType&& initializer, std::true_type)
+    {
+        new(storage) FunctorType(std::forward<InitializerType>(initializer));
+    }
+
+    template<typename FunctorType, typename InitializerType>
+    static void construct(StorageType* storage, InitializerType&& initializer, std::false_type)
+    {
+        new(storage) FunctorType*(new FunctorType(std::forward<InitializerType>(initializer)));
+    }
+
+    template<typename FunctorType>
+    static void move(StorageType* destination, StorageType* source, std::true_type)
+    {
+        auto& functor = getFunctor<FunctorType>(source, std::true_type());
+        new(destination) FunctorType(std::move(functor));
+        functor.~FunctorType();
+    }
+
+    template<typename FunctorType>
+    static void move(StorageType* destination, StorageType* source, std::false_type)
+    {
+        new(destination) FunctorType*(*reinterpret_cast<FunctorType**>(source));
+    }
+
+    template<typename FunctorType>
+    static void destroy(StorageType* storage, std::true_type)
+    {
+        getFunctor<FunctorType>(storage, std::true_type()).~FunctorType();
+    }
+
+    template<typename FunctorType>
+    static void destroy(StorageType* storage, std::false_type)
+    {
+        delete *reinterpret_cast<FunctorType**>(storage);
+    }
+
+    template<typename FunctorType>
+    static void invoke(StorageType* storage, ArgumentsTypes&&... arguments)
+    {
+        getFunctor<FunctorType>(storage, InPlace<FunctorType>())(std::forward<ArgumentsTypes>(arguments)...);
+    }
+
+    template<typename FunctorType>
+    static const char* manage(Operation operation, StorageType* destination, StorageType* source)
+    {
+        switch(operation)
+        {
+        case Operation::COPY:
+            construct<FunctorType>(destination, getFunctor<FunctorType>(source, InPlace<FunctorType>()), InPlace<FunctorType>());
+            break;
+
+        case Operation::MOVE:
+            move<FunctorType>(destination, source, InPlace<FunctorType>());
+            break;
+
+        case Operation::DESTROY:
+            destroy<FunctorType>(destination, InPlace<FunctorType>());
+            break;
+
+        case Operation::TYPE_NAME:
+            return typeid(FunctorType).name();
+        }
+
+        return nullptr;
+    }
+
+    Invoker invoker_;
+    Manager manager_;
+    StorageType storage_;
+};
+
+}
+}
+}
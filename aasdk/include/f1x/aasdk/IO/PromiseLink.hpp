@@ -39,7 +39,7 @@ public:
 
     PromiseLink(typename Promise<DestinationResolveArgumentType>::Pointer promise, TransformFunctor transformFunctor)
         : promise_(std::move(promise))
-        , transformFunctor_(std::make_shared<TransformFunctor>(std::move(transformFunctor)))
+        , transformFunctor_(std::move(transformFunctor))
     {
 
     }
@@ -47,8 +47,9 @@ public:
     static void forward(Promise<SourceResolveArgumentType>& source, typename Promise<DestinationResolveArgumentType>::Pointer destination,
                         TransformFunctor transformFunctor = [](SourceResolveArgumentType&& argument) { return std::move(argument); })
     {
-        auto link = std::make_shared<PromiseLink<SourceResolveArgumentType, DestinationResolveArgumentType>>(std::forward<typename Promise<DestinationResolveArgumentType>::Pointer>(destination),
-                                                                                                             std::forward<TransformFunctor>(transformFunctor));
+        auto link = std::allocate_shared<PromiseLink<SourceResolveArgumentType, DestinationResolveArgumentType>>(PromiseAllocator<PromiseLink>(),
+                                                                                                                 std::forward<typename Promise<DestinationResolveArgumentType>::Pointer>(destination),
+                                                                                                                 std::forward<TransformFunctor>(transformFunctor));
         source.then(link->getResolveHandler(), link->getRejectHandler());
     }
 
@@ -59,8 +60,8 @@ private:
     {
         if(transformFunctor_ != nullptr)
         {
-            promise_->resolve((*transformFunctor_)(std::move(argument)));
-            transformFunctor_.reset();
+            promise_->resolve(transformFunctor_(std::move(argument)));
+            transformFunctor_ = nullptr;
         }
     }
 
@@ -80,7 +81,7 @@ private:
     }
 
     typename Promise<DestinationResolveArgumentType>::Pointer promise_;
-    std::shared_ptr<TransformFunctor> transformFunctor_;
+    TransformFunctor transformFunctor_;
 };
 
 template<>
@@ -97,7 +98,7 @@ public:
 
     static void forward(Promise<void>& source, typename Promise<void>::Pointer destination)
     {
-        auto link = std::make_shared<PromiseLink<void, void>>(std::forward<typename Promise<void>::Pointer>(destination));
+        auto link = std::allocate_shared<PromiseLink<void, void>>(PromiseAllocator<PromiseLink>(), std::forward<typename Promise<void>::Pointer>(destination));
         source.then(link->getResolveHandler(), link->getRejectHandler());
     }
 
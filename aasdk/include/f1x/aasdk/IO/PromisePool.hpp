@@ -0,0 +1,89 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Per-thread free list of fixed size blocks for promises and their control blocks.
+// A block released in another thread than it was taken from joins that thread's list.
+class PromisePool
+{
+public:
+    struct Statistics
+    {
+        size_t hits;
+        size_t misses;
+        size_t freeBlocks;
+    };
+
+    static void* allocate(size_t size);
+    static void deallocate(void* block, size_t size);
+    static Statistics getStatistics();
+
+    static constexpr size_t cBlockSize = 256;
+    static constexpr size_t cMaxFreeBlocks = 256;
+};
+
+template<typename ValueType>
+class PromiseAllocator
+{
+public:
+    typedef ValueType value_type;
+
+    PromiseAllocator() = default;
+
+    template<typename OtherValueType>
+    PromiseAllocator(const PromiseAllocator<OtherValueType>&)
+    {
+
+    }
+
+    ValueType* allocate(size_t count)
+    {
+        return static_cast<ValueType*>(PromisePool::allocate(count * sizeof(ValueType)));
+    }
+
+    void deallocate(ValueType* pointer, size_t count)
+    {
+        PromisePool::deallocate(pointer, count * sizeof(ValueType));
+    }
+};
+
+template<typename ValueType, typename OtherValueType>
+bool operator==(const PromiseAllocator<ValueType>&, const PromiseAllocator<OtherValueType>&)
+{
+    return true;
+}
+
+template<typename ValueType, typename OtherValueType>
+bool operator!=(const PromiseAllocator<ValueType>&, const PromiseAllocator<OtherValueType>&)
+{
+    return false;
+}
+
+}
+}
+}
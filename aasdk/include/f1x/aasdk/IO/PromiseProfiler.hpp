@@ -0,0 +1,124 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Call site of Promise::defer(). It is captured only when aasdk is built with AASDK_PROMISE_PROFILER,
+// otherwise it is an empty argument that disappears with the inlined defer().
+struct PromiseSite
+{
+#ifdef AASDK_PROMISE_PROFILER
+    PromiseSite(const char* _file = __builtin_FILE(), int _line = __builtin_LINE());
+
+    const char* file;
+    int line;
+#endif
+};
+
+// Lifetime and latency statistics of promises, grouped by the site that deferred them.
+// Promises carry a Record only when aasdk is built with AASDK_PROMISE_PROFILER.
+class PromiseProfiler: boost::noncopyable
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Statistics
+    {
+        const char* file;
+        int line;
+        size_t createdCount;
+        size_t resolvedCount;
+        size_t rejectedCount;
+        size_t destroyedPendingCount;
+        size_t pendingCount;
+        Clock::duration totalSettleTime;
+        Clock::duration maxSettleTime;
+    };
+
+    struct PendingPromise
+    {
+        const char* file;
+        int line;
+        Clock::duration age;
+    };
+
+    class Record: boost::noncopyable
+    {
+    public:
+        Record();
+        ~Record();
+
+        void start(const PromiseSite& site);
+        void resolve();
+        void reject();
+
+    private:
+        friend class PromiseProfiler;
+
+        const char* file_;
+        int line_;
+        Clock::time_point createdAt_;
+        bool pending_;
+        Record* previous_;
+        Record* next_;
+    };
+
+    static PromiseProfiler& getInstance();
+
+    std::vector<Statistics> getStatistics() const;
+    std::vector<PendingPromise> getPendingPromises() const;
+    void dump() const;
+    void reset();
+
+    static bool isEnabled();
+
+private:
+    PromiseProfiler();
+
+    void start(Record& record);
+    void settle(Record& record, bool resolved);
+    void destroy(Record& record);
+    void unlink(Record& record);
+    Statistics& getSiteStatistics(const Record& record);
+
+    struct SiteCompare
+    {
+        bool operator()(const std::pair<const char*, int>& lhs, const std::pair<const char*, int>& rhs) const;
+    };
+
+    std::map<std::pair<const char*, int>, Statistics, SiteCompare> statistics_;
+    Record* pendingRecords_;
+    mutable std::mutex mutex_;
+};
+
+}
+}
+}
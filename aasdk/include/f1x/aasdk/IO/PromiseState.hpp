@@ -0,0 +1,60 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Single-shot state of a promise kept in one atomic word instead of a mutex.
+// then() claims the handler slots with beginThen()/endThen(), resolve() and reject() settle the promise once.
+class PromiseState
+{
+public:
+    PromiseState();
+
+    bool beginThen();
+    void endThen();
+
+    // Returns true when handlers were set before settling, i.e. the caller owns them now.
+    // Waits only while then() is storing handlers in another thread.
+    bool settle();
+    bool isSettled() const;
+
+private:
+    enum : uint8_t
+    {
+        PENDING,
+        THEN_IN_PROGRESS,
+        HANDLERS_SET,
+        SETTLED
+    };
+
+    std::atomic<uint8_t> state_;
+};
+
+}
+}
+}
@@ -0,0 +1,193 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+template<typename HandlerType>
+class MonitoredHandler;
+
+// Watchdog of io_service handlers. While running, every handler wrapped by wrap() costs two clock reads: its
+// execution time goes into a histogram and handlers longer than the threshold are logged with their tag.
+// IOContextWrapper and io::Strand wrap all handlers they are given. A sampling thread additionally
+// reports handlers which are still running past the threshold, so a handler that never returns is noticed too.
+class StallDetector: boost::noncopyable
+{
+private:
+    struct ThreadSlot;
+
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    static constexpr size_t cBucketsCount = 8;
+    // Upper bounds of the histogram buckets in milliseconds, the last bucket collects everything longer.
+    static constexpr std::array<uint32_t, cBucketsCount - 1> cBucketBounds{{1, 5, 10, 50, 100, 500, 1000}};
+
+    struct Statistics
+    {
+        std::array<size_t, cBucketsCount> histogram;
+        size_t handlersCount;
+        size_t stallsCount;
+        size_t ongoingStallsCount;
+        Clock::duration maxDuration;
+    };
+
+    // Measures the handler executed in its lifetime. Nested scopes (handlers run in place
+    // by an outer handler) are accounted to the outermost one.
+    class Scope: boost::noncopyable
+    {
+    public:
+        explicit Scope(const char* tag);
+        ~Scope();
+
+    private:
+        const char* tag_;
+        ThreadSlot* slot_;
+        Clock::time_point begin_;
+        bool active_;
+    };
+
+    // Handlers are reported under the tag, or under their type name if none is given.
+    template<typename HandlerType>
+    static MonitoredHandler<typename std::decay<HandlerType>::type> wrap(HandlerType&& handler, const char* tag = nullptr)
+    {
+        typedef typename std::decay<HandlerType>::type DecayedHandlerType;
+        return MonitoredHandler<DecayedHandlerType>(std::forward<HandlerType>(handler), tag != nullptr ? tag : typeid(DecayedHandlerType).name());
+    }
+
+    static StallDetector& getInstance();
+
+    void start(Clock::duration threshold, Clock::duration samplingInterval);
+    void stop();
+    bool isRunning() const;
+
+    Statistics getStatistics() const;
+    void dump() const;
+    void reset();
+
+private:
+    struct ThreadSlot
+    {
+        ThreadSlot();
+        ~ThreadSlot();
+
+        std::atomic<Clock::rep> startTime;
+        std::atomic<const char*> tag;
+        Clock::rep reportedStartTime;
+        size_t depth;
+        std::thread::id threadId;
+    };
+
+    StallDetector();
+
+    static ThreadSlot& getThreadSlot();
+    void registerSlot(ThreadSlot& slot);
+    void unregisterSlot(ThreadSlot& slot);
+    void finish(const char* tag, Clock::duration duration);
+    void sample();
+
+    std::atomic<bool> running_;
+    std::atomic<Clock::rep> threshold_;
+    Clock::duration samplingInterval_;
+    std::array<std::atomic<size_t>, cBucketsCount> histogram_;
+    std::atomic<size_t> handlersCount_;
+    std::atomic<size_t> stallsCount_;
+    std::atomic<size_t> ongoingStallsCount_;
+    std::atomic<Clock::rep> maxDuration_;
+
+    // The sampling thread runs next to the io_service workers, so plain std::mutex is used
+    // regardless of the threading policy.
+    std::vector<ThreadSlot*> slots_;
+    mutable std::mutex mutex_;
+    std::condition_variable samplerCondition_;
+    std::thread sampler_;
+};
+
+// Handler timed whenever it is invoked, whether posted, dispatched or passed as the completion handler
+// of an asynchronous operation. asio hooks are forwarded, so a wrapped strand handler or custom allocator keeps working.
+template<typename HandlerType>
+class MonitoredHandler
+{
+public:
+    MonitoredHandler(HandlerType handler, const char* tag)
+        : handler_(std::move(handler))
+        , tag_(tag)
+    {
+
+    }
+
+    template<typename... ArgumentsType>
+    void operator()(ArgumentsType&&... arguments)
+    {
+        StallDetector::Scope scope(tag_);
+        handler_(std::forward<ArgumentsType>(arguments)...);
+    }
+
+    template<typename FunctionType>
+    friend void asio_handler_invoke(FunctionType& function, MonitoredHandler* handler)
+    {
+        boost_asio_handler_invoke_helpers::invoke(function, handler->handler_);
+    }
+
+    template<typename FunctionType>
+    friend void asio_handler_invoke(const FunctionType& function, MonitoredHandler* handler)
+    {
+        boost_asio_handler_invoke_helpers::invoke(function, handler->handler_);
+    }
+
+    friend void* asio_handler_allocate(std::size_t size, MonitoredHandler* handler)
+    {
+        return boost_asio_handler_alloc_helpers::allocate(size, handler->handler_);
+    }
+
+    friend void asio_handler_deallocate(void* pointer, std::size_t size, MonitoredHandler* handler)
+    {
+        boost_asio_handler_alloc_helpers::deallocate(pointer, size, handler->handler_);
+    }
+
+    friend bool asio_handler_is_continuation(MonitoredHandler* handler)
+    {
+        return boost_asio_handler_cont_helpers::is_continuation(handler->handler_);
+    }
+
+private:
+    HandlerType handler_;
+    const char* tag_;
+};
+
+}
+}
+}
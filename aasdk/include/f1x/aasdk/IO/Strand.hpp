@@ -0,0 +1,59 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <boost/asio.hpp>
+#include <f1x/aasdk/IO/StallDetector.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Strand whose dispatch(), post() and wrap() time every handler with the StallDetector, reported under
+// the handler type name. Code holding it as a plain strand reference bypasses the timing.
+class Strand: public boost::asio::io_service::strand
+{
+public:
+    explicit Strand(boost::asio::io_service& ioService);
+
+    template<typename CompletionHandlerType>
+    void dispatch(CompletionHandlerType&& handler)
+    {
+        boost::asio::io_service::strand::dispatch(StallDetector::wrap(std::forward<CompletionHandlerType>(handler)));
+    }
+
+    template<typename CompletionHandlerType>
+    void post(CompletionHandlerType&& handler)
+    {
+        boost::asio::io_service::strand::post(StallDetector::wrap(std::forward<CompletionHandlerType>(handler)));
+    }
+
+    template<typename HandlerType>
+    auto wrap(HandlerType&& handler)
+    {
+        return boost::asio::io_service::strand::wrap(StallDetector::wrap(std::forward<HandlerType>(handler)));
+    }
+};
+
+}
+}
+}
@@ -18,9 +18,11 @@
 
 #pragma once
 
-#include <unordered_map>
-#include <queue>
+#include <array>
+#include <atomic>
+#include <deque>
 #include <f1x/aasdk/Messenger/Message.hpp>
+#include <f1x/aasdk/Messenger/ReceiveQueuePolicy.hpp>
 
 
 namespace f1x
@@ -33,14 +35,39 @@ namespace messenger
 class ChannelReceiveMessageQueue
 {
 public:
+    ChannelReceiveMessageQueue();
+
+    void setPolicy(ChannelId channelId, size_t capacity, ReceiveQueuePolicy policy);
     void push(Message::Pointer message);
     Message::Pointer pop(ChannelId channelId);
     bool empty(ChannelId channelId) const;
+    bool isBlocked() const;
+    size_t getSize(ChannelId channelId) const;
+    size_t getCapacity(ChannelId channelId) const;
+    ReceiveQueuePolicy getPolicy(ChannelId channelId) const;
+    size_t getDroppedCount(ChannelId channelId) const;
     void clear();
 
+    static constexpr size_t cDefaultCapacity = 256;
+
 private:
-    typedef std::queue<Message::Pointer> MessageQueue;
-    std::unordered_map<ChannelId, MessageQueue> queue_;
+    struct ChannelQueue
+    {
+        ChannelQueue();
+
+        std::deque<Message::Pointer> messages;
+        size_t capacity;
+        ReceiveQueuePolicy policy;
+        std::atomic<size_t> size;
+        std::atomic<size_t> dropped;
+    };
+
+    ChannelQueue& getChannelQueue(ChannelId channelId);
+    const ChannelQueue& getChannelQueue(ChannelId channelId) const;
+    bool isFull(const ChannelQueue& channelQueue) const;
+
+    std::array<ChannelQueue, 256> queue_;
+    size_t blockedChannelsCount_;
 };
 
 }
@@ -18,8 +18,8 @@
 
 #pragma once
 
-#include <queue>
-#include <unordered_map>
+#include <array>
+#include <f1x/aasdk/Common/PooledList.hpp>
 #include <f1x/aasdk/Messenger/IMessenger.hpp>
 
 namespace f1x
@@ -29,9 +29,13 @@ namespace aasdk
 namespace messenger
 {
 
+// Pending receive promises per channel. Each channel keeps the nodes of its popped promises,
+// so once a channel was used pushing and popping its promises does not allocate.
 class ChannelReceivePromiseQueue
 {
 public:
+    ChannelReceivePromiseQueue();
+
     void push(ChannelId channelId, ReceivePromise::Pointer promise);
     ReceivePromise::Pointer pop(ChannelId channelId);
     bool isPending(ChannelId channelId) const;
@@ -41,7 +45,8 @@ public:
     ReceivePromise::Pointer pop();
 
 private:
-    std::unordered_map<ChannelId, std::queue<ReceivePromise::Pointer>> queue_;
+    std::array<common::PooledList<ReceivePromise::Pointer>, 256> queue_;
+    size_t size_;
 };
 
 }
@@ -0,0 +1,79 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+#include <functional>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Error/Error.hpp>
+#include <f1x/aasdk/Messenger/Message.hpp>
+#include <f1x/aasdk/Messenger/HopProfiler.hpp>
+#include <f1x/aasdk/Messenger/ReceiveQueuePolicy.hpp>
+#include <f1x/aasdk/Common/ThreadingPolicy.hpp>
+#include <f1x/aasdk/Common/ProfiledMutex.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+// Persistent receiver of all messages of a channel. Messages are delivered in batches on the strand of the subscriber,
+// without re-arming a receive promise for every message.
+class ChannelSubscription: public std::enable_shared_from_this<ChannelSubscription>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<ChannelSubscription> Pointer;
+    typedef std::function<void(Message::Pointer)> MessageHandler;
+    typedef std::function<void(const error::Error&)> ErrorHandler;
+    typedef std::function<void()> DrainHandler;
+
+    ChannelSubscription(boost::asio::io_service::strand& strand, MessageHandler messageHandler, ErrorHandler errorHandler);
+
+    bool push(Message::Pointer message, size_t capacity, ReceiveQueuePolicy policy);
+    void reject(const error::Error& e);
+    bool cancel();
+    void setDrainHandler(DrainHandler drainHandler);
+    void setHopProfiler(HopProfiler::Pointer hopProfiler);
+
+    size_t getPendingCount() const;
+    size_t getDroppedCount() const;
+
+private:
+    using std::enable_shared_from_this<ChannelSubscription>::shared_from_this;
+    void deliver();
+
+    boost::asio::io_service::strand& strand_;
+    MessageHandler messageHandler_;
+    ErrorHandler errorHandler_;
+    DrainHandler drainHandler_;
+    HopProfiler::Pointer hopProfiler_;
+
+    std::vector<Message::Pointer> batch_;
+    size_t droppedCount_;
+    bool deliveryScheduled_;
+    bool blocked_;
+    bool active_;
+    mutable common::ProfiledMutex<common::Mutex> mutex_;
+};
+
+}
+}
+}
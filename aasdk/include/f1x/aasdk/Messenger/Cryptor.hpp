@@ -18,9 +18,10 @@
 
 #pragma once
 
-#include <mutex>
 #include <f1x/aasdk/Transport/ISSLWrapper.hpp>
 #include <f1x/aasdk/Messenger/ICryptor.hpp>
+#include <f1x/aasdk/Common/ThreadingPolicy.hpp>
+#include <f1x/aasdk/Common/ProfiledMutex.hpp>
 
 namespace f1x
 {
@@ -59,7 +60,7 @@ private:
 
     const static std::string cCertificate;
     const static std::string cPrivateKey;
-    mutable std::mutex mutex_;
+    mutable common::ProfiledMutex<common::Mutex> mutex_;
 };
 
 }
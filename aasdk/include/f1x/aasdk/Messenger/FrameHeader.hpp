@@ -42,6 +42,7 @@ public:
     EncryptionType getEncryptionType() const;
     MessageType getMessageType() const;
     common::Data getData() const;
+    size_t write(common::DataBuffer buffer) const;
 
     static constexpr size_t getSizeOf() { return 2; }
 
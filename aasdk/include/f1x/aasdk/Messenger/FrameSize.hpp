@@ -36,9 +36,12 @@ public:
     FrameSize(const common::DataConstBuffer& buffer);
 
     common::Data getData() const;
+    size_t write(common::DataBuffer buffer) const;
     size_t getSize() const;
+    size_t getTotalSize() const;
+    FrameSizeType getType() const;
 
-    static size_t getSizeOf(FrameSizeType type);
+    static constexpr size_t getSizeOf(FrameSizeType type) { return type == FrameSizeType::EXTENDED ? 6 : 2; }
 
 private:
     FrameSizeType frameSizeType_;
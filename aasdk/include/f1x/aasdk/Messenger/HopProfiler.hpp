@@ -0,0 +1,71 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/Messenger/Message.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+// Debug statistics of strand hops taken by received messages before they reach their channel, posted hops
+// apart from the continuations executed inline. Collected only when aasdk is built with AASDK_HOP_PROFILER,
+// otherwise record() is a no-op.
+class HopProfiler: boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<HopProfiler> Pointer;
+
+    struct Statistics
+    {
+        ChannelId channelId;
+        uint16_t messageId;
+        size_t messagesCount;
+        size_t postedHopsCount;
+        size_t inlineHopsCount;
+        size_t maxPostedHops;
+    };
+
+    void record(const Message& message);
+    void record(ChannelId channelId, uint16_t messageId, const io::HopCounter& hopCounter);
+    std::vector<Statistics> getStatistics() const;
+    void dump() const;
+    void reset();
+
+    static bool isEnabled();
+    static uint16_t getMessageId(const Message& message);
+
+private:
+    typedef std::pair<ChannelId, uint16_t> Key;
+
+    std::map<Key, Statistics> statistics_;
+    mutable std::mutex mutex_;
+};
+
+}
+}
+}
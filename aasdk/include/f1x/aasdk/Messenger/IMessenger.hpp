@@ -23,6 +23,7 @@
 #include <f1x/aasdk/Messenger/ICryptor.hpp>
 #include <f1x/aasdk/Messenger/Message.hpp>
 #include <f1x/aasdk/Messenger/Promise.hpp>
+#include <f1x/aasdk/Messenger/ChannelSubscription.hpp>
 
 namespace f1x
 {
@@ -38,9 +39,14 @@ public:
     virtual ~IMessenger() = default;
 
     typedef std::shared_ptr<IMessenger> Pointer;
+    typedef std::function<void(const error::Error&)> SendErrorHandler;
 
     virtual void enqueueReceive(ChannelId channelId, ReceivePromise::Pointer promise) = 0;
     virtual void enqueueSend(Message::Pointer message, SendPromise::Pointer promise) = 0;
+    virtual void enqueueSend(Message::Pointer message) = 0;
+    virtual void setSendErrorHandler(ChannelId channelId, SendErrorHandler errorHandler) = 0;
+    virtual void subscribe(ChannelId channelId, ChannelSubscription::Pointer subscription) = 0;
+    virtual void unsubscribe(ChannelId channelId) = 0;
     virtual void stop() = 0;
 };
 
@@ -22,10 +22,12 @@
 #include <memory>
 #include <google/protobuf/message.h>
 #include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/IO/HopCounter.hpp>
 #include <f1x/aasdk/Messenger/ChannelId.hpp>
 #include <f1x/aasdk/Messenger/EncryptionType.hpp>
 #include <f1x/aasdk/Messenger/MessageType.hpp>
 #include <f1x/aasdk/Messenger/MessageId.hpp>
+#include <f1x/aasdk/Messenger/FrameType.hpp>
 
 namespace f1x
 {
@@ -47,18 +49,35 @@ public:
     EncryptionType getEncryptionType() const;
     MessageType getType() const;
 
+    // Headroom left by MessageBuilder is dropped when the payload is accessed.
     common::Data& getPayload();
     const common::Data& getPayload() const;
+    // Payload preceded by getFrameHeadroom() bytes reserved for the frame header, used to frame the message in place.
+    common::Data& getFrameBuffer();
+    size_t getFrameHeadroom() const;
+    void setFrameHeadroom(size_t frameHeadroom);
     void insertPayload(const common::Data& payload);
     void insertPayload(const google::protobuf::Message& message);
     void insertPayload(const common::DataConstBuffer& buffer);
     void insertPayload(common::DataBuffer& buffer);
 
+    io::HopCounter& getHopCounter();
+    const io::HopCounter& getHopCounter() const;
+
+    // BULK for a complete message, FIRST/MIDDLE/LAST for a fragment delivered by a streaming channel.
+    void setFragmentType(FrameType fragmentType);
+    FrameType getFragmentType() const;
+
 private:
+    void dropFrameHeadroom() const;
+
     ChannelId channelId_;
     EncryptionType encryptionType_;
     MessageType type_;
-    common::Data payload_;
+    mutable common::Data payload_;
+    mutable size_t frameHeadroom_;
+    io::HopCounter hopCounter_;
+    FrameType fragmentType_;
 };
 
 }
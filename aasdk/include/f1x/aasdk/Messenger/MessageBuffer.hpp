@@ -0,0 +1,51 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/Messenger/Message.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+// Part of the payload of a received message together with the reference which keeps the message alive.
+// The bytes stay valid as long as any copy of the buffer is held, so they can be queued without copying.
+class MessageBuffer
+{
+public:
+    MessageBuffer();
+    MessageBuffer(Message::Pointer message, size_t offset);
+
+    common::DataConstBuffer getData() const;
+    size_t getSize() const;
+    const Message::Pointer& getMessage() const;
+    void release();
+
+private:
+    Message::Pointer message_;
+    size_t offset_;
+};
+
+}
+}
+}
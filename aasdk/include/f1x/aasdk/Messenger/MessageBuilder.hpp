@@ -0,0 +1,81 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <google/protobuf/message.h>
+#include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/Messenger/Message.hpp>
+#include <f1x/aasdk/Messenger/MessageId.hpp>
+#include <f1x/aasdk/Messenger/Timestamp.hpp>
+#include <f1x/aasdk/Messenger/FrameHeader.hpp>
+#include <f1x/aasdk/Messenger/FrameSize.hpp>
+#include <f1x/aasdk/Messenger/WireTemplate.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+// Builds an outgoing message with a single payload allocation. The id, timestamp and body are serialized in place.
+// Plain payload is preceded by headroom for the frame header, so MessageOutStream frames it without moving the payload.
+// Encrypted payload is copied by the cryptor anyway and gets no headroom.
+class MessageBuilder
+{
+public:
+    MessageBuilder(ChannelId channelId, EncryptionType encryptionType, MessageType type);
+
+    MessageBuilder& setId(MessageId id);
+    MessageBuilder& setTimestamp(Timestamp timestamp);
+    MessageBuilder& setPayload(const google::protobuf::Message& message);
+    MessageBuilder& setPayload(const common::DataConstBuffer& buffer);
+    // Frequent messages are encoded from their WireTemplate, other shapes fall back to protobuf.
+    MessageBuilder& setPayload(const proto::messages::AVMediaAckIndication& message);
+    MessageBuilder& setPayload(const proto::messages::InputEventIndication& message);
+    MessageBuilder& setPayload(const proto::messages::PingRequest& message);
+
+    size_t getPayloadSize() const;
+    Message::Pointer build() const;
+
+    // Header of a BULK frame, the only frame which can be sent in place.
+    static constexpr size_t cFrameHeadroom = FrameHeader::getSizeOf() + FrameSize::getSizeOf(FrameSizeType::SHORT);
+
+private:
+    template<typename MessageType>
+    MessageBuilder& setWirePayload(const MessageType& message);
+
+    ChannelId channelId_;
+    EncryptionType encryptionType_;
+    MessageType type_;
+    bool hasId_;
+    MessageId id_;
+    bool hasTimestamp_;
+    Timestamp timestamp_;
+    const google::protobuf::Message* protobufMessage_;
+    size_t protobufMessageSize_;
+    common::DataConstBuffer buffer_;
+    std::array<uint8_t, cMaxWireTemplateSize> wirePayload_;
+    size_t wirePayloadSize_;
+};
+
+}
+}
+}
@@ -34,6 +34,7 @@ public:
     MessageId(const common::Data& data);
 
     common::Data getData() const;
+    size_t write(common::DataBuffer buffer) const;
     static constexpr size_t getSizeOf() { return 2; }
     uint16_t getId() const;
 
@@ -18,11 +18,15 @@
 
 #pragma once
 
+#include <array>
+#include <bitset>
 #include <f1x/aasdk/Transport/ITransport.hpp>
 #include <f1x/aasdk/Messenger/IMessageInStream.hpp>
 #include <f1x/aasdk/Messenger/ICryptor.hpp>
 #include <f1x/aasdk/Messenger/FrameHeader.hpp>
 #include <f1x/aasdk/Messenger/FrameSize.hpp>
+#include <f1x/aasdk/Messenger/MessagePool.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -34,9 +38,11 @@ namespace messenger
 class MessageInStream: public IMessageInStream, public std::enable_shared_from_this<MessageInStream>, boost::noncopyable
 {
 public:
-    MessageInStream(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor);
+    MessageInStream(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor, MessagePool::Pointer messagePool);
 
     void startReceive(ReceivePromise::Pointer promise) override;
+    // Deliver FIRST/MIDDLE/LAST frames of the channel as fragments instead of reassembling them.
+    void setStreamingEnabled(ChannelId channelId, bool enabled);
 
 private:
     using std::enable_shared_from_this<MessageInStream>::shared_from_this;
@@ -44,14 +50,25 @@ private:
     void receiveFrameHeaderHandler(const common::DataConstBuffer& buffer);
     void receiveFrameSizeHandler(const common::DataConstBuffer& buffer);
     void receiveFramePayloadHandler(const common::DataConstBuffer& buffer);
+    void resolveMessage();
+    void rejectMessage(const error::Error& e);
+    bool isStreamingEnabled(ChannelId channelId) const;
 
-    boost::asio::io_service::strand strand_;
+    // Messages split into FIRST/MIDDLE/LAST frames may be interleaved with frames of other channels,
+    // so every channel keeps its own in-progress reassembly. Frame header carries channel id on one byte.
+    typedef std::array<Message::Pointer, 256> ReassemblyTable;
+
+    io::Strand strand_;
     transport::ITransport::Pointer transport_;
     ICryptor::Pointer cryptor_;
+    MessagePool::Pointer messagePool_;
+    // Keeps the stream alive while a message is being received, frame handlers capture only this.
+    std::shared_ptr<MessageInStream> self_;
     FrameType recentFrameType_;
     ReceivePromise::Pointer promise_;
     Message::Pointer message_;
-    Message::Pointer messageBig_;
+    ReassemblyTable reassemblyTable_;
+    std::bitset<256> streamingChannels_;
 };
 
 }
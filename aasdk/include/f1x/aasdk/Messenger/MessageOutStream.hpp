@@ -18,12 +18,14 @@
 
 #pragma once
 
+#include <deque>
 #include <f1x/aasdk/Common/Data.hpp>
 #include <f1x/aasdk/Transport/ITransport.hpp>
 #include <f1x/aasdk/Messenger/ICryptor.hpp>
 #include <f1x/aasdk/Messenger/IMessageOutStream.hpp>
 #include <f1x/aasdk/Messenger/FrameHeader.hpp>
 #include <f1x/aasdk/Messenger/FrameSize.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -38,26 +40,41 @@ public:
     MessageOutStream(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor);
 
     void stream(Message::Pointer message, SendPromise::Pointer promise) override;
+    void setWindowSize(size_t windowSize);
 
 private:
     using std::enable_shared_from_this<MessageOutStream>::shared_from_this;
 
-    void streamSplittedMessage();
-    common::Data compoundFrame(FrameType frameType, const common::DataConstBuffer& payloadBuffer);
+    struct PendingMessage
+    {
+        Message::Pointer message;
+        SendPromise::Pointer promise;
+        size_t offset;
+    };
+
+    void streamFrames();
+    void frameSentHandler(const SendPromise::Pointer& promise, bool lastFrame);
+    void frameSendErrorHandler(const SendPromise::Pointer& promise, const error::Error& e);
+    Pointer frameCompleted();
+    common::Data compoundFrame(Message& message, FrameType frameType, const common::DataConstBuffer& payloadBuffer);
     void streamEncryptedFrame(FrameType frameType, const common::DataConstBuffer& payloadBuffer);
     void streamPlainFrame(FrameType frameType, const common::DataConstBuffer& payloadBuffer);
     void setFrameSize(common::Data& data, FrameType frameType, size_t payloadSize, size_t totalSize);
-    void reset();
 
-    boost::asio::io_service::strand strand_;
+    io::Strand strand_;
     transport::ITransport::Pointer transport_;
     ICryptor::Pointer cryptor_;
-    Message::Pointer message_;
-    size_t offset_;
-    size_t remainingSize_;
-    SendPromise::Pointer promise_;
+    // Frames are encrypted and handed to the transport up to windowSize_ ahead of the wire.
+    // Transport completes sends in order, so message promises are resolved in order as well.
+    std::deque<PendingMessage> pendingMessages_;
+    size_t inFlightFramesCount_;
+    size_t windowSize_;
+    // Held while frames are in flight, transport handlers capture only this.
+    Pointer self_;
 
         static constexpr size_t cMaxFramePayloadSize = 0x4000;
+        static constexpr size_t cMaxEncryptionOverhead = 128;
+        static constexpr size_t cDefaultWindowSize = 4;
 };
 
 }
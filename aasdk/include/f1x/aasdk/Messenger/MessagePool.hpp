@@ -0,0 +1,89 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/Messenger/Message.hpp>
+#include <f1x/aasdk/Messenger/PayloadSizeClass.hpp>
+#include <f1x/aasdk/Common/ProfiledMutex.hpp>
+#include <f1x/aasdk/Common/SessionArena.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+// Recycles received messages and their payload buffers for the lifetime of one session.
+// Messages handed out by acquire() return to the pool when their last reference drops,
+// payload buffers are kept in size classes so their capacity is reused by later messages.
+// Given a session arena, messages and their reference counts are allocated from it.
+class MessagePool: public std::enable_shared_from_this<MessagePool>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<MessagePool> Pointer;
+
+    struct Statistics
+    {
+        size_t messageHits;
+        size_t messageMisses;
+        std::array<size_t, cPayloadSizeClassesCount> payloadHits;
+        std::array<size_t, cPayloadSizeClassesCount> payloadMisses;
+        size_t unpooledPayloads;
+    };
+
+    explicit MessagePool(common::SessionArena::Pointer arena = nullptr);
+    ~MessagePool();
+
+    Message::Pointer acquire(ChannelId channelId, EncryptionType encryptionType, MessageType type);
+    void reserve(Message& message, size_t size);
+    Statistics getStatistics() const;
+    void dump() const;
+
+    static size_t getPayloadCapacity(PayloadSizeClass sizeClass);
+
+private:
+    using std::enable_shared_from_this<MessagePool>::shared_from_this;
+    typedef std::vector<common::Data> PayloadFreeList;
+
+    static void release(std::weak_ptr<MessagePool> pool, common::SessionArena* arena, Message* message);
+    static void destroy(common::SessionArena* arena, Message* message);
+    void release(Message* message);
+
+    common::SessionArena::Pointer arena_;
+    std::vector<Message*> messages_;
+    std::array<PayloadFreeList, cPayloadSizeClassesCount> payloads_;
+    Statistics statistics_;
+    // Messages are released wherever their last reference drops, output threads included,
+    // so the pool locks even in single threaded builds.
+    mutable common::ProfiledMutex<std::mutex> mutex_;
+
+    static size_t getMaxPooledPayloads(PayloadSizeClass sizeClass);
+
+    static constexpr size_t cMaxPooledMessages = 64;
+};
+
+}
+}
+}
@@ -19,12 +19,15 @@
 #pragma once
 
 #include <boost/asio.hpp>
-#include <list>
+#include <array>
+#include <f1x/aasdk/Common/PooledList.hpp>
 #include <f1x/aasdk/Messenger/IMessenger.hpp>
 #include <f1x/aasdk/Messenger/IMessageInStream.hpp>
 #include <f1x/aasdk/Messenger/IMessageOutStream.hpp>
 #include <f1x/aasdk/Messenger/ChannelReceiveMessageQueue.hpp>
 #include <f1x/aasdk/Messenger/ChannelReceivePromiseQueue.hpp>
+#include <f1x/aasdk/Messenger/HopProfiler.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -39,25 +42,66 @@ public:
     Messenger(boost::asio::io_service& ioService, IMessageInStream::Pointer messageInStream, IMessageOutStream::Pointer messageOutStream);
     void enqueueReceive(ChannelId channelId, ReceivePromise::Pointer promise) override;
     void enqueueSend(Message::Pointer message, SendPromise::Pointer promise) override;
+    void enqueueSend(Message::Pointer message) override;
+    void setSendErrorHandler(ChannelId channelId, SendErrorHandler errorHandler) override;
+    void subscribe(ChannelId channelId, ChannelSubscription::Pointer subscription) override;
+    void unsubscribe(ChannelId channelId) override;
     void stop() override;
 
+    void setReceiveQueuePolicy(ChannelId channelId, size_t capacity, ReceiveQueuePolicy policy);
+    void setSendWindow(size_t sendWindow);
+    size_t getReceiveQueueSize(ChannelId channelId) const;
+    size_t getReceiveQueueDroppedCount(ChannelId channelId) const;
+    size_t getUnreportedSendErrorsCount() const;
+    HopProfiler::Pointer getHopProfiler() const;
+
 private:
     using std::enable_shared_from_this<Messenger>::shared_from_this;
-    typedef std::list<std::pair<Message::Pointer, SendPromise::Pointer>> ChannelSendQueue;
+    typedef common::PooledList<std::pair<Message::Pointer, SendPromise::Pointer>> ChannelSendQueue;
+    typedef std::array<ChannelSubscription::Pointer, 256> ChannelSubscriptions;
+    typedef std::array<SendErrorHandler, 256> ChannelSendErrorHandlers;
     void doSend();
+    void receiveFromInStream();
     void inStreamMessageHandler(Message::Pointer message);
-    void outStreamMessageHandler(ChannelSendQueue::iterator queueElement);
+    void deliverToSubscription(Message::Pointer message);
+    void resolveReceivePromise(ReceivePromise::Pointer promise, Message::Pointer message);
+    void subscriptionDrainHandler();
+    void cancelSubscription(const ChannelSubscription::Pointer& subscription);
+    void clearSubscriptions();
+    void outStreamMessageHandler(ChannelSendQueue::iterator queueElement, size_t sendGeneration);
+    void outStreamErrorHandler(size_t sendGeneration, const error::Error& e);
+    Pointer outStreamSendCompleted();
     void rejectReceivePromiseQueue(const error::Error& e);
     void rejectSendPromiseQueue(const error::Error& e);
 
-    boost::asio::io_service::strand receiveStrand_;
-    boost::asio::io_service::strand sendStrand_;
+    io::Strand receiveStrand_;
+    io::Strand sendStrand_;
     IMessageInStream::Pointer messageInStream_;
     IMessageOutStream::Pointer messageOutStream_;
 
     ChannelReceivePromiseQueue channelReceivePromiseQueue_;
     ChannelReceiveMessageQueue channelReceiveMessageQueue_;
     ChannelSendQueue channelSendPromiseQueue_;
+    ChannelSendErrorHandlers channelSendErrorHandlers_;
+    ChannelSubscriptions channelSubscriptions_;
+    HopProfiler::Pointer hopProfiler_;
+    size_t subscriptionsCount_;
+    size_t blockedSubscriptionsCount_;
+    bool inStreamReceiveInProgress_;
+    // Messages at the front of the send queue which are already handed to the out stream.
+    size_t inFlightSendsCount_;
+    size_t sendWindow_;
+    size_t sendGeneration_;
+    size_t outStreamSendsCount_;
+    // Promise-less sends which failed on a channel without a send error handler.
+    size_t unreportedSendErrorsCount_;
+    // Keep-alives held while the in stream or the out stream owes a completion. Handlers of the
+    // per-message chains capture only this, so no reference counting happens per message.
+    Pointer receiveSelf_;
+    Pointer sendSelf_;
+
+    static constexpr size_t cDefaultSendWindow = 4;
+    static constexpr size_t cDefaultSendQueueCapacity = 32;
 };
 
 }
@@ -36,8 +36,11 @@ public:
     Timestamp(const common::DataConstBuffer& buffer);
 
     common::Data getData() const;
+    size_t write(common::DataBuffer buffer) const;
     ValueType getValue() const;
 
+    static constexpr size_t getSizeOf() { return sizeof(ValueType); }
+
 private:
     ValueType stamp_;
 };
@@ -0,0 +1,144 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <aasdk_proto/AVMediaAckIndicationMessage.pb.h>
+#include <aasdk_proto/InputEventIndicationMessage.pb.h>
+#include <aasdk_proto/PingRequestMessage.pb.h>
+#include <f1x/aasdk/Common/Data.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+class WireFormat
+{
+public:
+    enum class WireType: uint8_t
+    {
+        VARINT = 0,
+        LENGTH_DELIMITED = 2
+    };
+
+    static constexpr size_t cMaxVarintSize = 10;
+
+    static constexpr uint8_t makeTag(uint8_t fieldNumber, WireType wireType)
+    {
+        return static_cast<uint8_t>((fieldNumber << 3) | static_cast<uint8_t>(wireType));
+    }
+
+    static constexpr size_t getVarintSize(uint64_t value)
+    {
+        size_t size = 1;
+
+        for(; value >= 0x80; value >>= 7)
+        {
+            ++size;
+        }
+
+        return size;
+    }
+
+    static uint8_t* writeVarint(uint64_t value, uint8_t* output)
+    {
+        for(; value >= 0x80; value >>= 7)
+        {
+            *output++ = static_cast<uint8_t>(value | 0x80);
+        }
+
+        *output++ = static_cast<uint8_t>(value);
+        return output;
+    }
+
+    // Signed fields and enums go on the wire as 64-bit two's complement, a negative value takes ten bytes.
+    static uint8_t* writeSignedVarint(int64_t value, uint8_t* output)
+    {
+        return writeVarint(static_cast<uint64_t>(value), output);
+    }
+};
+
+// Byte template of a frequent outgoing message shape. The tags are fixed at compile time and the field
+// values are patched in as varints, which produces the same bytes as SerializeToArray without protobuf.
+// matches() tells whether the message has the shape of the template, write() returns the count of written bytes.
+template<typename MessageType>
+class WireTemplate;
+
+template<>
+class WireTemplate<proto::messages::AVMediaAckIndication>
+{
+public:
+    static constexpr size_t cMaxSize = 2 + 2 * WireFormat::cMaxVarintSize;
+
+    static bool matches(const proto::messages::AVMediaAckIndication& message);
+    static size_t write(const proto::messages::AVMediaAckIndication& message, uint8_t* output);
+
+private:
+    static constexpr uint8_t cSessionTag = WireFormat::makeTag(1, WireFormat::WireType::VARINT);
+    static constexpr uint8_t cValueTag = WireFormat::makeTag(2, WireFormat::WireType::VARINT);
+};
+
+template<>
+class WireTemplate<proto::messages::PingRequest>
+{
+public:
+    static constexpr size_t cMaxSize = 1 + WireFormat::cMaxVarintSize;
+
+    static bool matches(const proto::messages::PingRequest& message);
+    static size_t write(const proto::messages::PingRequest& message, uint8_t* output);
+
+private:
+    static constexpr uint8_t cTimestampTag = WireFormat::makeTag(1, WireFormat::WireType::VARINT);
+};
+
+// Touch event with a single pointer, as reported by a touch screen.
+template<>
+class WireTemplate<proto::messages::InputEventIndication>
+{
+public:
+    static constexpr size_t cMaxSize = 1 + WireFormat::cMaxVarintSize    // timestamp
+                                       + 2                               // touch_event
+                                       + 2 + 3 * (1 + 5)                 // touch_location
+                                       + 1 + 5                           // action_index
+                                       + 1 + WireFormat::cMaxVarintSize; // touch_action
+
+    static bool matches(const proto::messages::InputEventIndication& message);
+    static size_t write(const proto::messages::InputEventIndication& message, uint8_t* output);
+
+private:
+    static constexpr uint8_t cTimestampTag = WireFormat::makeTag(1, WireFormat::WireType::VARINT);
+    static constexpr uint8_t cTouchEventTag = WireFormat::makeTag(3, WireFormat::WireType::LENGTH_DELIMITED);
+    static constexpr uint8_t cTouchLocationTag = WireFormat::makeTag(1, WireFormat::WireType::LENGTH_DELIMITED);
+    static constexpr uint8_t cXTag = WireFormat::makeTag(1, WireFormat::WireType::VARINT);
+    static constexpr uint8_t cYTag = WireFormat::makeTag(2, WireFormat::WireType::VARINT);
+    static constexpr uint8_t cPointerIdTag = WireFormat::makeTag(3, WireFormat::WireType::VARINT);
+    static constexpr uint8_t cActionIndexTag = WireFormat::makeTag(2, WireFormat::WireType::VARINT);
+    static constexpr uint8_t cTouchActionTag = WireFormat::makeTag(3, WireFormat::WireType::VARINT);
+
+    // Nested messages of the template are shorter than 128 bytes, so each length takes a single byte.
+    static_assert(cMaxSize - 1 - WireFormat::cMaxVarintSize - 2 < 0x80, "touch event length does not fit in one byte");
+};
+
+static constexpr size_t cMaxWireTemplateSize = WireTemplate<proto::messages::InputEventIndication>::cMaxSize;
+
+}
+}
+}
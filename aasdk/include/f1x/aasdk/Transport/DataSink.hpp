@@ -21,7 +21,7 @@
 #include <limits>
 #include <boost/circular_buffer.hpp>
 #include <f1x/aasdk/Common/Data.hpp>
-
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
 
 namespace f1x
 {
@@ -42,8 +42,12 @@ public:
     common::Data consume(common::Data::size_type size);
 
 private:
+    common::MemoryReservation reservation_;
     boost::circular_buffer<common::Data::value_type> data_;
     static constexpr common::Data::size_type cChunkSize = 16384;
+    // Received data is consumed by pending receive promises right away, the sink only has to
+    // hold what arrives ahead of them. It grows beyond the reservation when that is not enough.
+    static constexpr common::Data::size_type cDesiredCapacity = 1024 * 1024;
 };
 
 }
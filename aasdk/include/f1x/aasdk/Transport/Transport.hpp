@@ -18,11 +18,11 @@
 
 #pragma once
 
-#include <list>
-#include <queue>
 #include <boost/asio.hpp>
+#include <f1x/aasdk/Common/PooledList.hpp>
 #include <f1x/aasdk/Transport/ITransport.hpp>
 #include <f1x/aasdk/Transport/DataSink.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -40,24 +40,36 @@ public:
     void send(common::Data data, SendPromise::Pointer promise) override;
 
 protected:
-    typedef std::list<std::pair<size_t, ReceivePromise::Pointer>> ReceiveQueue;
-    typedef std::list<std::pair<common::Data, SendPromise::Pointer>> SendQueue;
+    typedef common::PooledList<std::pair<size_t, ReceivePromise::Pointer>> ReceiveQueue;
+    typedef common::PooledList<std::pair<common::Data, SendPromise::Pointer>> SendQueue;
+
+    typedef std::shared_ptr<Transport> Pointer;
 
     using std::enable_shared_from_this<Transport>::shared_from_this;
     void receiveHandler(size_t bytesTransferred);
+    void receiveErrorHandler(const error::Error& e);
     void distributeReceivedData();
     void rejectReceivePromises(const error::Error& e);
+    Pointer receiveCompleted();
+    Pointer sendCompleted();
 
     virtual void enqueueReceive(common::DataBuffer buffer) = 0;
     virtual void enqueueSend(SendQueue::iterator queueElement) = 0;
 
     DataSink receivedDataSink_;
 
-    boost::asio::io_service::strand receiveStrand_;
+    io::Strand receiveStrand_;
     ReceiveQueue receiveQueue_;
 
-    boost::asio::io_service::strand sendStrand_;
+    io::Strand sendStrand_;
     SendQueue sendQueue_;
+
+    // Keep-alives held while the receive or the send queue is not empty. Handlers of the
+    // reads and writes of the underlying device capture only this.
+    Pointer receiveSelf_;
+    Pointer sendSelf_;
+
+    static constexpr size_t cDefaultQueueCapacity = 16;
 };
 
 }
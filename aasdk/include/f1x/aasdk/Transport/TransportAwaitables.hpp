@@ -0,0 +1,51 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#ifdef AASDK_COROUTINES
+
+#include <f1x/aasdk/IO/Awaitable.hpp>
+#include <f1x/aasdk/Transport/ITransport.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+
+inline io::Awaitable<common::Data> asyncReceive(ITransport& transport, boost::asio::io_service::strand& strand, size_t size)
+{
+    return io::Awaitable<common::Data>(strand, [&transport, size](ITransport::ReceivePromise::Pointer promise) {
+        transport.receive(size, std::move(promise));
+    });
+}
+
+inline io::Awaitable<void> asyncSend(ITransport& transport, boost::asio::io_service::strand& strand, common::Data data)
+{
+    return io::Awaitable<void>(strand, [&transport, data = std::move(data)](ITransport::SendPromise::Pointer promise) mutable {
+        transport.send(std::move(data), std::move(promise));
+    });
+}
+
+}
+}
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include <f1x/aasdk/USB/IUSBEndpoint.hpp>
 #include <f1x/aasdk/USB/IUSBWrapper.hpp>
 #include <f1x/aasdk/USB/IAccessoryModeQuery.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -39,7 +40,7 @@ public:
     void cancel() override;
 
 protected:
-    boost::asio::io_service::strand strand_;
+    io::Strand strand_;
     IUSBEndpoint::Pointer usbEndpoint_;
     common::Data data_;
     Promise::Pointer promise_;
@@ -21,6 +21,8 @@
 #include <f1x/aasdk/USB/IUSBWrapper.hpp>
 #include <f1x/aasdk/USB/IAccessoryModeQueryFactory.hpp>
 #include <f1x/aasdk/USB/IAccessoryModeQueryChain.hpp>
+#include <f1x/aasdk/IO/Coroutine.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -44,6 +46,9 @@ public:
 private:
     using std::enable_shared_from_this<AccessoryModeQueryChain>::shared_from_this;
 
+#ifdef AASDK_COROUTINES
+    io::Coroutine run(IUSBEndpoint::Pointer usbEndpoint);
+#else
     void startQuery(AccessoryModeQueryType queryType, IUSBEndpoint::Pointer usbEndpoint, IAccessoryModeQuery::Promise::Pointer queryPromise);
 
     void protocolVersionQueryHandler(IUSBEndpoint::Pointer usbEndpoint);
@@ -54,9 +59,10 @@ private:
     void uriQueryHandler(IUSBEndpoint::Pointer usbEndpoint);
     void serialQueryHandler(IUSBEndpoint::Pointer usbEndpoint);
     void startQueryHandler(IUSBEndpoint::Pointer usbEndpoint);
+#endif
     
     IUSBWrapper& usbWrapper_;
-    boost::asio::io_service::strand strand_;
+    io::Strand strand_;
     IAccessoryModeQueryFactory& queryFactory_;
     DeviceHandle handle_;    
     Promise::Pointer promise_;
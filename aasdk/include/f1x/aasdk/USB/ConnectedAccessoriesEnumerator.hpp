@@ -22,6 +22,7 @@
 #include <f1x/aasdk/USB/IUSBWrapper.hpp>
 #include <f1x/aasdk/USB/IAccessoryModeQueryChainFactory.hpp>
 #include <f1x/aasdk/USB/IConnectedAccessoriesEnumerator.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -45,7 +46,7 @@ private:
     void reset();
 
     IUSBWrapper& usbWrapper_;
-    boost::asio::io_service::strand strand_;
+    io::Strand strand_;
     IAccessoryModeQueryChainFactory& queryChainFactory_;
     IAccessoryModeQueryChain::Pointer queryChain_;
     Promise::Pointer promise_;
@@ -23,6 +23,7 @@
 #include <boost/asio.hpp>
 #include <f1x/aasdk/USB/IUSBWrapper.hpp>
 #include <f1x/aasdk/USB/IUSBEndpoint.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -53,7 +54,7 @@ private:
     static void transferHandler(libusb_transfer *transfer);
 
     IUSBWrapper& usbWrapper_;
-    boost::asio::io_service::strand strand_;
+    io::Strand strand_;
     DeviceHandle handle_;
     uint8_t endpointAddress_;
     Transfers transfers_;
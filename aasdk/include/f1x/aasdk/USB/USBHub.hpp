@@ -22,6 +22,7 @@
 #include <list>
 #include <f1x/aasdk/USB/IUSBHub.hpp>
 #include <f1x/aasdk/USB/IAccessoryModeQueryChainFactory.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 
 namespace f1x
 {
@@ -48,7 +49,7 @@ private:
     static int hotplugEventsHandler(libusb_context* usbContext, libusb_device* device, libusb_hotplug_event event, void* uerData);
 
     IUSBWrapper& usbWrapper_;
-    boost::asio::io_service::strand strand_;
+    io::Strand strand_;
     IAccessoryModeQueryChainFactory& queryChainFactory_;
     Promise::Pointer hotplugPromise_;
     Pointer self_;
@@ -19,6 +19,7 @@
 #include <aasdk_proto/ControlMessageIdsEnum.pb.h>
 #include <aasdk_proto/AVChannelMessageIdsEnum.pb.h>
 #include <f1x/aasdk/Messenger/Timestamp.hpp>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
 #include <f1x/aasdk/Channel/AV/IAVInputServiceChannelEventHandler.hpp>
 #include <f1x/aasdk/Channel/AV/AVInputServiceChannel.hpp>
 #include <f1x/aasdk/Common/Log.hpp>
@@ -32,35 +33,45 @@ namespace channel
 namespace av
 {
 
+const AVInputServiceChannel::MessageHandlers<4> AVInputServiceChannel::cMessageHandlers{{
+    {proto::ids::AVChannelMessage::SETUP_REQUEST, &AVInputServiceChannel::parse<proto::messages::AVChannelSetupRequest, &IAVInputServiceChannelEventHandler::onAVChannelSetupRequest>},
+    {proto::ids::AVChannelMessage::AV_INPUT_OPEN_REQUEST, &AVInputServiceChannel::parse<proto::messages::AVInputOpenRequest, &IAVInputServiceChannelEventHandler::onAVInputOpenRequest>},
+    {proto::ids::AVChannelMessage::AV_MEDIA_ACK_INDICATION, &AVInputServiceChannel::parse<proto::messages::AVMediaAckIndication, &IAVInputServiceChannelEventHandler::onAVMediaAckIndication>},
+    {proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST, &AVInputServiceChannel::parse<proto::messages::ChannelOpenRequest, &IAVInputServiceChannelEventHandler::onChannelOpenRequest>}
+}};
+
 AVInputServiceChannel::AVInputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::AV_INPUT)
+    : TypedServiceChannel(strand, std::move(messenger), messenger::ChannelId::AV_INPUT)
 {
 
 }
 
 void AVInputServiceChannel::receive(IAVInputServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
-    receivePromise->then(std::bind(&AVInputServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
-                        std::bind(&IAVInputServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
+    this->receiveMessage(std::move(eventHandler));
+}
 
-    messenger_->enqueueReceive(channelId_, std::move(receivePromise));
+void AVInputServiceChannel::subscribe(IAVInputServiceChannelEventHandler::Pointer eventHandler)
+{
+    this->subscribeMessages(std::move(eventHandler));
 }
 
 void AVInputServiceChannel::sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL)
+                     .setId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void AVInputServiceChannel::sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::SETUP_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::AVChannelMessage::SETUP_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
@@ -70,105 +81,27 @@ messenger::ChannelId AVInputServiceChannel::getId() const
     return channelId_;
 }
 
-void AVInputServiceChannel::messageHandler(messenger::Message::Pointer message, IAVInputServiceChannelEventHandler::Pointer eventHandler)
-{
-    messenger::MessageId messageId(message->getPayload());
-    common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
-
-    switch(messageId.getId())
-    {
-    case proto::ids::AVChannelMessage::SETUP_REQUEST:
-        this->handleAVChannelSetupRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::AVChannelMessage::AV_INPUT_OPEN_REQUEST:
-        this->handleAVInputOpenRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::AVChannelMessage::AV_MEDIA_ACK_INDICATION:
-        this->handleAVMediaAckIndication(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST:
-        this->handleChannelOpenRequest(payload, std::move(eventHandler));
-        break;
-    default:
-        AASDK_LOG(error) << "[AVInputServiceChannel] message not handled: " << messageId.getId();
-        this->receive(std::move(eventHandler));
-        break;
-    }
-}
-
 void AVInputServiceChannel::sendAVInputOpenResponse(const proto::messages::AVInputOpenResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::AV_INPUT_OPEN_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::AVChannelMessage::AV_INPUT_OPEN_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void AVInputServiceChannel::sendAVMediaWithTimestampIndication(messenger::Timestamp::ValueType timestamp, const common::Data& data, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::AV_MEDIA_WITH_TIMESTAMP_INDICATION).getData());
-
-    auto timestampData = messenger::Timestamp(timestamp).getData();
-    message->insertPayload(std::move(timestampData));
-    message->insertPayload(data);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::AVChannelMessage::AV_MEDIA_WITH_TIMESTAMP_INDICATION)
+                     .setTimestamp(timestamp)
+                     .setPayload(common::DataConstBuffer(data))
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
-void AVInputServiceChannel::handleAVChannelSetupRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::AVChannelSetupRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onAVChannelSetupRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void AVInputServiceChannel::handleAVInputOpenRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::AVInputOpenRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onAVInputOpenRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void AVInputServiceChannel::handleAVMediaAckIndication(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::AVMediaAckIndication indication;
-    if(indication.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onAVMediaAckIndication(indication);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void AVInputServiceChannel::handleChannelOpenRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::ChannelOpenRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onChannelOpenRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
 }
 }
 }
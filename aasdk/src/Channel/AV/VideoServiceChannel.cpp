@@ -19,6 +19,7 @@
 #include <aasdk_proto/ControlMessageIdsEnum.pb.h>
 #include <aasdk_proto/AVChannelMessageIdsEnum.pb.h>
 #include <f1x/aasdk/Messenger/Timestamp.hpp>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
 #include <f1x/aasdk/Channel/AV/IVideoServiceChannelEventHandler.hpp>
 #include <f1x/aasdk/Channel/AV/VideoServiceChannel.hpp>
 #include <f1x/aasdk/Common/Log.hpp>
@@ -32,19 +33,30 @@ namespace channel
 namespace av
 {
 
+const VideoServiceChannel::MessageHandlers<5> VideoServiceChannel::cMessageHandlers{{
+    {proto::ids::AVChannelMessage::SETUP_REQUEST, &VideoServiceChannel::parse<proto::messages::AVChannelSetupRequest, &IVideoServiceChannelEventHandler::onAVChannelSetupRequest>},
+    {proto::ids::AVChannelMessage::START_INDICATION, &VideoServiceChannel::parse<proto::messages::AVChannelStartIndication, &IVideoServiceChannelEventHandler::onAVChannelStartIndication>},
+    {proto::ids::AVChannelMessage::STOP_INDICATION, &VideoServiceChannel::parse<proto::messages::AVChannelStopIndication, &IVideoServiceChannelEventHandler::onAVChannelStopIndication>},
+    {proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST, &VideoServiceChannel::parse<proto::messages::ChannelOpenRequest, &IVideoServiceChannelEventHandler::onChannelOpenRequest>},
+    {proto::ids::AVChannelMessage::VIDEO_FOCUS_REQUEST, &VideoServiceChannel::parse<proto::messages::VideoFocusRequest, &IVideoServiceChannelEventHandler::onVideoFocusRequest>}
+}};
+
 VideoServiceChannel::VideoServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::VIDEO)
+    : TypedServiceChannel(strand, std::move(messenger), messenger::ChannelId::VIDEO)
+    , mediaFragmentInProgress_(false)
+    , fragmentTimestamp_(0)
 {
 
 }
 
 void VideoServiceChannel::receive(IVideoServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
-    receivePromise->then(std::bind(&VideoServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
-                        std::bind(&IVideoServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
+    this->receiveMessage(std::move(eventHandler));
+}
 
-    messenger_->enqueueReceive(channelId_, std::move(receivePromise));
+void VideoServiceChannel::subscribe(IVideoServiceChannelEventHandler::Pointer eventHandler)
+{
+    this->subscribeMessages(std::move(eventHandler));
 }
 
 messenger::ChannelId VideoServiceChannel::getId() const
@@ -54,146 +66,145 @@ messenger::ChannelId VideoServiceChannel::getId() const
 
 void VideoServiceChannel::sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL)
+                     .setId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void VideoServiceChannel::sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::SETUP_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::AVChannelMessage::SETUP_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void VideoServiceChannel::sendVideoFocusIndication(const proto::messages::VideoFocusIndication& indication, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::VIDEO_FOCUS_INDICATION).getData());
-    message->insertPayload(indication);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::AVChannelMessage::VIDEO_FOCUS_INDICATION)
+                     .setPayload(indication)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void VideoServiceChannel::sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::AV_MEDIA_ACK_INDICATION).getData());
-    message->insertPayload(indication);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::AVChannelMessage::AV_MEDIA_ACK_INDICATION)
+                     .setPayload(indication)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
-void VideoServiceChannel::messageHandler(messenger::Message::Pointer message, IVideoServiceChannelEventHandler::Pointer eventHandler)
+void VideoServiceChannel::sendAVMediaAckIndication(const proto::messages::AVMediaAckIndication& indication)
 {
-    messenger::MessageId messageId(message->getPayload());
-    common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::AVChannelMessage::AV_MEDIA_ACK_INDICATION)
+                     .setPayload(indication)
+                     .build());
 
-    switch(messageId.getId())
-    {
-    case proto::ids::AVChannelMessage::SETUP_REQUEST:
-        this->handleAVChannelSetupRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::AVChannelMessage::START_INDICATION:
-        this->handleStartIndication(payload, std::move(eventHandler));
-        break;
-    case proto::ids::AVChannelMessage::STOP_INDICATION:
-        this->handleStopIndication(payload, std::move(eventHandler));
-        break;
-    case proto::ids::AVChannelMessage::AV_MEDIA_WITH_TIMESTAMP_INDICATION:
-        this->handleAVMediaWithTimestampIndication(payload, std::move(eventHandler));
-        break;
-    case proto::ids::AVChannelMessage::AV_MEDIA_INDICATION:
-        eventHandler->onAVMediaIndication(payload);
-        break;
-    case proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST:
-        this->handleChannelOpenRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::AVChannelMessage::VIDEO_FOCUS_REQUEST:
-        this->handleVideoFocusRequest(payload, std::move(eventHandler));
-        break;
-    default:
-        AASDK_LOG(error) << "[VideoServiceChannel] message not handled: " << messageId.getId();
-        this->receive(std::move(eventHandler));
-        break;
-    }
+    this->send(std::move(message));
 }
 
-void VideoServiceChannel::handleAVChannelSetupRequest(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler)
+void VideoServiceChannel::messageHandler(messenger::Message::Pointer message, IVideoServiceChannelEventHandler::Pointer eventHandler)
 {
-    proto::messages::AVChannelSetupRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
+    if(message->getFragmentType() != messenger::FrameType::BULK)
     {
-        eventHandler->onAVChannelSetupRequest(request);
+        this->fragmentHandler(std::move(message), std::move(eventHandler));
+        return;
     }
-    else
+
+    // Media skips the handlers table, it is handed over together with the message holding it.
+    messenger::MessageId messageId(message->getPayload());
+
+    if(messageId.getId() == proto::ids::AVChannelMessage::AV_MEDIA_WITH_TIMESTAMP_INDICATION)
     {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
+        this->handleAVMediaWithTimestampIndication(std::move(message), messageId.getSizeOf(), std::move(eventHandler));
     }
-}
-
-void VideoServiceChannel::handleStartIndication(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::AVChannelStartIndication indication;
-    if(indication.ParseFromArray(payload.cdata, payload.size))
+    else if(messageId.getId() == proto::ids::AVChannelMessage::AV_MEDIA_INDICATION)
     {
-        eventHandler->onAVChannelStartIndication(indication);
+        eventHandler->onAVMediaBuffer(messenger::MessageBuffer(std::move(message), messageId.getSizeOf()));
     }
     else
     {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
+        this->dispatch(std::move(message), std::move(eventHandler));
     }
 }
 
-void VideoServiceChannel::handleStopIndication(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler)
+void VideoServiceChannel::fragmentHandler(messenger::Message::Pointer message, IVideoServiceChannelEventHandler::Pointer eventHandler)
 {
-    proto::messages::AVChannelStopIndication indication;
-    if(indication.ParseFromArray(payload.cdata, payload.size))
+    const auto fragmentType = message->getFragmentType();
+
+    if(fragmentType == messenger::FrameType::FIRST)
     {
-        eventHandler->onAVChannelStopIndication(indication);
+        mediaFragmentInProgress_ = false;
+        fragmentedMessage_.reset();
+
+        messenger::MessageId messageId(message->getPayload());
+        common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
+
+        if(messageId.getId() == proto::ids::AVChannelMessage::AV_MEDIA_WITH_TIMESTAMP_INDICATION && payload.size >= sizeof(messenger::Timestamp::ValueType))
+        {
+            mediaFragmentInProgress_ = true;
+            fragmentTimestamp_ = messenger::Timestamp(payload).getValue();
+            eventHandler->onAVMediaFragment(fragmentType, fragmentTimestamp_, common::DataConstBuffer(payload.cdata, payload.size, sizeof(messenger::Timestamp::ValueType)));
+            return;
+        }
+        else if(messageId.getId() == proto::ids::AVChannelMessage::AV_MEDIA_INDICATION)
+        {
+            mediaFragmentInProgress_ = true;
+            fragmentTimestamp_ = 0;
+            eventHandler->onAVMediaFragment(fragmentType, fragmentTimestamp_, payload);
+            return;
+        }
+
+        // Only media is streamed, anything else is reassembled here and handled as a whole.
+        fragmentedMessage_ = std::move(message);
     }
-    else
+    else if(mediaFragmentInProgress_)
     {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
+        mediaFragmentInProgress_ = fragmentType != messenger::FrameType::LAST;
+        eventHandler->onAVMediaFragment(fragmentType, fragmentTimestamp_, common::DataConstBuffer(message->getPayload()));
+        return;
     }
-}
-
-void VideoServiceChannel::handleChannelOpenRequest(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::ChannelOpenRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
+    else if(fragmentedMessage_ != nullptr)
     {
-        eventHandler->onChannelOpenRequest(request);
+        fragmentedMessage_->insertPayload(common::DataConstBuffer(message->getPayload()));
+
+        if(fragmentType == messenger::FrameType::LAST)
+        {
+            fragmentedMessage_->setFragmentType(messenger::FrameType::BULK);
+            this->messageHandler(std::move(fragmentedMessage_), std::move(eventHandler));
+            return;
+        }
     }
     else
     {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
+        AASDK_LOG(error) << "[VideoServiceChannel] dropping fragment without beginning.";
     }
-}
 
-void VideoServiceChannel::handleVideoFocusRequest(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::VideoFocusRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onVideoFocusRequest(request);
-    }
-    else
+    if(!subscribed_)
     {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
+        this->receive(std::move(eventHandler));
     }
 }
 
-void VideoServiceChannel::handleAVMediaWithTimestampIndication(const common::DataConstBuffer& payload, IVideoServiceChannelEventHandler::Pointer eventHandler)
+void VideoServiceChannel::handleAVMediaWithTimestampIndication(messenger::Message::Pointer message, size_t offset, IVideoServiceChannelEventHandler::Pointer eventHandler)
 {
+    common::DataConstBuffer payload(message->getPayload(), offset);
+
     if(payload.size >= sizeof(messenger::Timestamp::ValueType))
     {
         messenger::Timestamp timestamp(payload);
-        eventHandler->onAVMediaWithTimestampIndication(timestamp.getValue(), common::DataConstBuffer(payload.cdata, payload.size, sizeof(messenger::Timestamp::ValueType)));
+        eventHandler->onAVMediaWithTimestampBuffer(timestamp.getValue(), messenger::MessageBuffer(std::move(message), offset + sizeof(messenger::Timestamp::ValueType)));
     }
     else
     {
@@ -19,6 +19,7 @@
 #include <aasdk_proto/ControlMessageIdsEnum.pb.h>
 #include <aasdk_proto/BluetoothChannelMessageIdsEnum.pb.h>
 #include <aasdk_proto/BluetoothPairingRequestMessage.pb.h>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
 #include <f1x/aasdk/Channel/Bluetooth/IBluetoothServiceChannelEventHandler.hpp>
 #include <f1x/aasdk/Channel/Bluetooth/BluetoothServiceChannel.hpp>
 #include <f1x/aasdk/Common/Log.hpp>
@@ -32,19 +33,25 @@ namespace channel
 namespace bluetooth
 {
 
+const BluetoothServiceChannel::MessageHandlers<2> BluetoothServiceChannel::cMessageHandlers{{
+    {proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST, &BluetoothServiceChannel::parse<proto::messages::ChannelOpenRequest, &IBluetoothServiceChannelEventHandler::onChannelOpenRequest>},
+    {proto::ids::BluetoothChannelMessage::PAIRING_REQUEST, &BluetoothServiceChannel::parse<proto::messages::BluetoothPairingRequest, &IBluetoothServiceChannelEventHandler::onBluetoothPairingRequest>}
+}};
+
 BluetoothServiceChannel::BluetoothServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::BLUETOOTH)
+    : TypedServiceChannel(strand, std::move(messenger), messenger::ChannelId::BLUETOOTH)
 {
 
 }
 
 void BluetoothServiceChannel::receive(IBluetoothServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
-    receivePromise->then(std::bind(&BluetoothServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
-                        std::bind(&IBluetoothServiceChannelEventHandler::onChannelError, eventHandler,std::placeholders::_1));
+    this->receiveMessage(std::move(eventHandler));
+}
 
-    messenger_->enqueueReceive(channelId_, std::move(receivePromise));
+void BluetoothServiceChannel::subscribe(IBluetoothServiceChannelEventHandler::Pointer eventHandler)
+{
+    this->subscribeMessages(std::move(eventHandler));
 }
 
 messenger::ChannelId BluetoothServiceChannel::getId() const
@@ -54,68 +61,24 @@ messenger::ChannelId BluetoothServiceChannel::getId() const
 
 void BluetoothServiceChannel::sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL)
+                     .setId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void BluetoothServiceChannel::sendBluetoothPairingResponse(const proto::messages::BluetoothPairingResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::BluetoothChannelMessage::PAIRING_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::BluetoothChannelMessage::PAIRING_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
-void BluetoothServiceChannel::messageHandler(messenger::Message::Pointer message, IBluetoothServiceChannelEventHandler::Pointer eventHandler)
-{
-    messenger::MessageId messageId(message->getPayload());
-    common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
-
-    switch(messageId.getId())
-    {
-    case proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST:
-        this->handleChannelOpenRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::BluetoothChannelMessage::PAIRING_REQUEST:
-        this->handleBluetoothPairingRequest(payload, std::move(eventHandler));
-        break;
-    default:
-        AASDK_LOG(error) << "[BluetoothServiceChannel] message not handled: " << messageId.getId();
-        this->receive(std::move(eventHandler));
-        break;
-    }
-}
-
-void BluetoothServiceChannel::handleChannelOpenRequest(const common::DataConstBuffer& payload, IBluetoothServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::ChannelOpenRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onChannelOpenRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void BluetoothServiceChannel::handleBluetoothPairingRequest(const common::DataConstBuffer& payload, IBluetoothServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::BluetoothPairingRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onBluetoothPairingRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
 }
 }
 }
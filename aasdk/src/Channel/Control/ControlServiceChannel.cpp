@@ -20,6 +20,7 @@
 #include <aasdk_proto/ControlMessageIdsEnum.pb.h>
 #include <f1x/aasdk/Version.hpp>
 #include <f1x/aasdk/IO/PromiseLink.hpp>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
 #include <f1x/aasdk/Channel/Control/ControlServiceChannel.hpp>
 #include <f1x/aasdk/Channel/Control/IControlServiceChannelEventHandler.hpp>
 #include <f1x/aasdk/Common/Log.hpp>
@@ -33,154 +34,139 @@ namespace channel
 namespace control
 {
 
+const ControlServiceChannel::MessageHandlers<9> ControlServiceChannel::cMessageHandlers{{
+    {proto::ids::ControlMessage::VERSION_RESPONSE, &ControlServiceChannel::handleVersionResponse},
+    {proto::ids::ControlMessage::SSL_HANDSHAKE, &ControlServiceChannel::handleHandshake},
+    {proto::ids::ControlMessage::SERVICE_DISCOVERY_REQUEST, &ControlServiceChannel::parse<proto::messages::ServiceDiscoveryRequest, &IControlServiceChannelEventHandler::onServiceDiscoveryRequest>},
+    {proto::ids::ControlMessage::AUDIO_FOCUS_REQUEST, &ControlServiceChannel::parse<proto::messages::AudioFocusRequest, &IControlServiceChannelEventHandler::onAudioFocusRequest>},
+    {proto::ids::ControlMessage::SHUTDOWN_REQUEST, &ControlServiceChannel::parse<proto::messages::ShutdownRequest, &IControlServiceChannelEventHandler::onShutdownRequest>},
+    {proto::ids::ControlMessage::SHUTDOWN_RESPONSE, &ControlServiceChannel::parse<proto::messages::ShutdownResponse, &IControlServiceChannelEventHandler::onShutdownResponse>},
+    {proto::ids::ControlMessage::NAVIGATION_FOCUS_REQUEST, &ControlServiceChannel::parse<proto::messages::NavigationFocusRequest, &IControlServiceChannelEventHandler::onNavigationFocusRequest>},
+    {proto::ids::ControlMessage::PING_REQUEST, &ControlServiceChannel::parse<proto::messages::PingRequest, &IControlServiceChannelEventHandler::onPingRequest>},
+    {proto::ids::ControlMessage::PING_RESPONSE, &ControlServiceChannel::parse<proto::messages::PingResponse, &IControlServiceChannelEventHandler::onPingResponse>}
+}};
+
 ControlServiceChannel::ControlServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, messenger, messenger::ChannelId::CONTROL)
+    : TypedServiceChannel(strand, messenger, messenger::ChannelId::CONTROL)
 {
 
 }
 
 void ControlServiceChannel::sendVersionRequest(SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::VERSION_REQUEST).getData());
+    const uint16_t versionBuffer[] = {boost::endian::native_to_big(AASDK_MAJOR), boost::endian::native_to_big(AASDK_MINOR)};
 
-    common::Data versionBuffer(4, 0);
-    reinterpret_cast<uint16_t&>(versionBuffer[0]) = boost::endian::native_to_big(AASDK_MAJOR);
-    reinterpret_cast<uint16_t&>(versionBuffer[2]) = boost::endian::native_to_big(AASDK_MINOR);
-    message->insertPayload(versionBuffer);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::VERSION_REQUEST)
+                     .setPayload(common::DataConstBuffer(versionBuffer, sizeof(versionBuffer)))
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendHandshake(common::Data handshakeBuffer, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::SSL_HANDSHAKE).getData());
-    message->insertPayload(handshakeBuffer);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::SSL_HANDSHAKE)
+                     .setPayload(common::DataConstBuffer(handshakeBuffer))
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendAuthComplete(const proto::messages::AuthCompleteIndication& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::AUTH_COMPLETE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::AUTH_COMPLETE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendServiceDiscoveryResponse(const proto::messages::ServiceDiscoveryResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::SERVICE_DISCOVERY_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::SERVICE_DISCOVERY_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendAudioFocusResponse(const proto::messages::AudioFocusResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::AUDIO_FOCUS_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::AUDIO_FOCUS_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendShutdownRequest(const proto::messages::ShutdownRequest& request, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::SHUTDOWN_REQUEST).getData());
-    message->insertPayload(request);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::SHUTDOWN_REQUEST)
+                     .setPayload(request)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendShutdownResponse(const proto::messages::ShutdownResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::SHUTDOWN_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::SHUTDOWN_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendNavigationFocusResponse(const proto::messages::NavigationFocusResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::NAVIGATION_FOCUS_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::NAVIGATION_FOCUS_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendPingRequest(const proto::messages::PingRequest& request, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::PING_REQUEST).getData());
-    message->insertPayload(request);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::PING_REQUEST)
+                     .setPayload(request)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::sendPingResponse(const proto::messages::PingResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::PING_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::ControlMessage::PING_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
 void ControlServiceChannel::receive(IControlServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise  = messenger::ReceivePromise::defer(strand_);
-    receivePromise->then(std::bind(&ControlServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
-                        std::bind(&IControlServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
+    this->receiveMessage(std::move(eventHandler));
+}
 
-    messenger_->enqueueReceive(channelId_, std::move(receivePromise));
+void ControlServiceChannel::subscribe(IControlServiceChannelEventHandler::Pointer eventHandler)
+{
+    this->subscribeMessages(std::move(eventHandler));
 }
 
-void ControlServiceChannel::messageHandler(messenger::Message::Pointer message, IControlServiceChannelEventHandler::Pointer eventHandler)
+void ControlServiceChannel::handleHandshake(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
 {
-    messenger::MessageId messageId(message->getPayload());
-    common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
-
-    switch(messageId.getId())
-    {
-    case proto::ids::ControlMessage::VERSION_RESPONSE:
-        this->handleVersionResponse(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::SSL_HANDSHAKE:
-        eventHandler->onHandshake(payload);
-        break;
-    case proto::ids::ControlMessage::SERVICE_DISCOVERY_REQUEST:
-        this->handleServiceDiscoveryRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::AUDIO_FOCUS_REQUEST:
-        this->handleAudioFocusRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::SHUTDOWN_REQUEST:
-        this->handleShutdownRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::SHUTDOWN_RESPONSE:
-        this->handleShutdownResponse(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::NAVIGATION_FOCUS_REQUEST:
-        this->handleNavigationFocusRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::PING_REQUEST:
-        this->handlePingRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::PING_RESPONSE:
-        this->handlePingResponse(payload, std::move(eventHandler));
-        break;
-    default:
-        AASDK_LOG(error) << "[ControlServiceChannel] message not handled: " << messageId.getId();
-        this->receive(std::move(eventHandler));
-        break;
-    }
+    eventHandler->onHandshake(payload);
 }
 
 void ControlServiceChannel::handleVersionResponse(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
@@ -195,97 +181,6 @@ void ControlServiceChannel::handleVersionResponse(const common::DataConstBuffer&
     eventHandler->onVersionResponse(majorCode, minorCode, status);
 }
 
-void ControlServiceChannel::handleServiceDiscoveryRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::ServiceDiscoveryRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onServiceDiscoveryRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void ControlServiceChannel::handleAudioFocusRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::AudioFocusRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onAudioFocusRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void ControlServiceChannel::handleShutdownRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::ShutdownRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onShutdownRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void ControlServiceChannel::handleShutdownResponse(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::ShutdownResponse response;
-    if(response.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onShutdownResponse(response);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void ControlServiceChannel::handleNavigationFocusRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::NavigationFocusRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onNavigationFocusRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void ControlServiceChannel::handlePingRequest(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::PingRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onPingRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void ControlServiceChannel::handlePingResponse(const common::DataConstBuffer& payload, IControlServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::PingResponse response;
-    if(response.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onPingResponse(response);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
 }
 }
 }
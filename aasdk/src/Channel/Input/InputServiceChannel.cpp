@@ -19,6 +19,7 @@
 #include <aasdk_proto/ControlMessageIdsEnum.pb.h>
 #include <aasdk_proto/ButtonCodeEnum.pb.h>
 #include <aasdk_proto/InputChannelMessageIdsEnum.pb.h>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
 #include <f1x/aasdk/Channel/Input/InputServiceChannel.hpp>
 #include <f1x/aasdk/Channel/Input/IInputServiceChannelEventHandler.hpp>
 #include <f1x/aasdk/Common/Log.hpp>
@@ -32,19 +33,25 @@ namespace channel
 namespace input
 {
 
+const InputServiceChannel::MessageHandlers<2> InputServiceChannel::cMessageHandlers{{
+    {proto::ids::InputChannelMessage::BINDING_REQUEST, &InputServiceChannel::parse<proto::messages::BindingRequest, &IInputServiceChannelEventHandler::onBindingRequest>},
+    {proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST, &InputServiceChannel::parse<proto::messages::ChannelOpenRequest, &IInputServiceChannelEventHandler::onChannelOpenRequest>}
+}};
+
 InputServiceChannel::InputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::INPUT)
+    : TypedServiceChannel(strand, std::move(messenger), messenger::ChannelId::INPUT)
 {
 
 }
 
 void InputServiceChannel::receive(IInputServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
-    receivePromise->then(std::bind(&InputServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
-                        std::bind(&IInputServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
+    this->receiveMessage(std::move(eventHandler));
+}
 
-    messenger_->enqueueReceive(channelId_, std::move(receivePromise));
+void InputServiceChannel::subscribe(IInputServiceChannelEventHandler::Pointer eventHandler)
+{
+    this->subscribeMessages(std::move(eventHandler));
 }
 
 messenger::ChannelId InputServiceChannel::getId() const
@@ -54,75 +61,42 @@ messenger::ChannelId InputServiceChannel::getId() const
 
 void InputServiceChannel::sendInputEventIndication(const proto::messages::InputEventIndication& indication, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::InputChannelMessage::INPUT_EVENT_INDICATION).getData());
-    message->insertPayload(indication);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::InputChannelMessage::INPUT_EVENT_INDICATION)
+                     .setPayload(indication)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
-void InputServiceChannel::sendBindingResponse(const proto::messages::BindingResponse& response, SendPromise::Pointer promise)
+void InputServiceChannel::sendInputEventIndication(const proto::messages::InputEventIndication& indication)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::InputChannelMessage::BINDING_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::InputChannelMessage::INPUT_EVENT_INDICATION)
+                     .setPayload(indication)
+                     .build());
 
-    this->send(std::move(message), std::move(promise));
+    this->send(std::move(message));
 }
 
-void InputServiceChannel::sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise)
+void InputServiceChannel::sendBindingResponse(const proto::messages::BindingResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::InputChannelMessage::BINDING_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
-void InputServiceChannel::messageHandler(messenger::Message::Pointer message, IInputServiceChannelEventHandler::Pointer eventHandler)
+void InputServiceChannel::sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise)
 {
-    messenger::MessageId messageId(message->getPayload());
-    common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
-
-    switch(messageId.getId())
-    {
-    case proto::ids::InputChannelMessage::BINDING_REQUEST:
-        this->handleBindingRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST:
-        this->handleChannelOpenRequest(payload, std::move(eventHandler));
-        break;
-    default:
-        AASDK_LOG(error) << "[InputServiceChannel] message not handled: " << messageId.getId();
-        this->receive(std::move(eventHandler));
-        break;
-    }
-}
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL)
+                     .setId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
-void InputServiceChannel::handleBindingRequest(const common::DataConstBuffer& payload, IInputServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::BindingRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onBindingRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
-
-void InputServiceChannel::handleChannelOpenRequest(const common::DataConstBuffer& payload, IInputServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::ChannelOpenRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onChannelOpenRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
+    this->send(std::move(message), std::move(promise));
 }
 
 }
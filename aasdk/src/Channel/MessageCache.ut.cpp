@@ -0,0 +1,111 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <aasdk_proto/PingRequestMessage.pb.h>
+#include <aasdk_proto/ServiceDiscoveryRequestMessage.pb.h>
+#include <f1x/aasdk/Channel/MessageCache.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace ut
+{
+
+typedef MessageCache<proto::messages::PingRequest, proto::messages::ServiceDiscoveryRequest> TestMessageCache;
+
+static common::Data serialize(const google::protobuf::Message& message)
+{
+    common::Data data(message.ByteSizeLong());
+    message.SerializeToArray(data.data(), data.size());
+    return data;
+}
+
+static common::Data createServiceDiscoveryRequest(const std::string& deviceName)
+{
+    proto::messages::ServiceDiscoveryRequest request;
+    request.set_device_name(deviceName);
+    request.set_device_brand("brand");
+    return serialize(request);
+}
+
+BOOST_AUTO_TEST_CASE(MessageCache_MessageInstanceIsReused)
+{
+    TestMessageCache messageCache;
+    const auto first = createServiceDiscoveryRequest("first device with a name longer than the small string buffer");
+    const auto second = createServiceDiscoveryRequest("second");
+
+    const void* firstAddress = nullptr;
+    {
+        auto request = messageCache.parse<proto::messages::ServiceDiscoveryRequest>(common::DataConstBuffer(first));
+        BOOST_REQUIRE(request != nullptr);
+        BOOST_CHECK_EQUAL(request->device_name(), "first device with a name longer than the small string buffer");
+        firstAddress = request.get();
+    }
+
+    auto request = messageCache.parse<proto::messages::ServiceDiscoveryRequest>(common::DataConstBuffer(second));
+    BOOST_REQUIRE(request != nullptr);
+    BOOST_CHECK_EQUAL(request->device_name(), "second");
+    BOOST_CHECK_EQUAL(request.get(), firstAddress);
+}
+
+BOOST_AUTO_TEST_CASE(MessageCache_NestedParseUsesTemporary)
+{
+    TestMessageCache messageCache;
+    proto::messages::PingRequest ping;
+    ping.set_timestamp(1);
+    const auto outerData = serialize(ping);
+    ping.set_timestamp(2);
+    const auto innerData = serialize(ping);
+
+    auto outer = messageCache.parse<proto::messages::PingRequest>(common::DataConstBuffer(outerData));
+    auto inner = messageCache.parse<proto::messages::PingRequest>(common::DataConstBuffer(innerData));
+    BOOST_REQUIRE(outer != nullptr);
+    BOOST_REQUIRE(inner != nullptr);
+    BOOST_CHECK(outer.get() != inner.get());
+    BOOST_CHECK_EQUAL(outer->timestamp(), 1);
+    BOOST_CHECK_EQUAL(inner->timestamp(), 2);
+
+    const void* cachedAddress = outer.get();
+    outer.reset();
+    inner.reset();
+    BOOST_CHECK_EQUAL(messageCache.parse<proto::messages::PingRequest>(common::DataConstBuffer(innerData)).get(), cachedAddress);
+}
+
+BOOST_AUTO_TEST_CASE(MessageCache_ParseError)
+{
+    TestMessageCache messageCache;
+    const common::Data invalid{0xFF, 0xFF, 0xFF};
+
+    BOOST_CHECK(messageCache.parse<proto::messages::PingRequest>(common::DataConstBuffer(invalid)) == nullptr);
+
+    proto::messages::PingRequest ping;
+    ping.set_timestamp(3);
+    const auto valid = serialize(ping);
+    auto request = messageCache.parse<proto::messages::PingRequest>(common::DataConstBuffer(valid));
+    BOOST_REQUIRE(request != nullptr);
+    BOOST_CHECK_EQUAL(request->timestamp(), 3);
+}
+
+}
+}
+}
+}
@@ -19,6 +19,7 @@
 #include <aasdk_proto/ControlMessageIdsEnum.pb.h>
 #include <aasdk_proto/ControlMessageIdsEnum.pb.h>
 #include <aasdk_proto/SensorChannelMessageIdsEnum.pb.h>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
 #include <f1x/aasdk/Channel/Sensor/ISensorServiceChannelEventHandler.hpp>
 #include <f1x/aasdk/Channel/Sensor/SensorServiceChannel.hpp>
 #include <f1x/aasdk/Common/Log.hpp>
@@ -32,19 +33,25 @@ namespace channel
 namespace sensor
 {
 
+const SensorServiceChannel::MessageHandlers<2> SensorServiceChannel::cMessageHandlers{{
+    {proto::ids::SensorChannelMessage::SENSOR_START_REQUEST, &SensorServiceChannel::parse<proto::messages::SensorStartRequestMessage, &ISensorServiceChannelEventHandler::onSensorStartRequest>},
+    {proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST, &SensorServiceChannel::parse<proto::messages::ChannelOpenRequest, &ISensorServiceChannelEventHandler::onChannelOpenRequest>}
+}};
+
 SensorServiceChannel::SensorServiceChannel(boost::asio::io_service::strand& strand,  messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::SENSOR)
+    : TypedServiceChannel(strand, std::move(messenger), messenger::ChannelId::SENSOR)
 {
 
 }
 
 void SensorServiceChannel::receive(ISensorServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
-    receivePromise->then(std::bind(&SensorServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
-                        std::bind(&ISensorServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
+    this->receiveMessage(std::move(eventHandler));
+}
 
-    messenger_->enqueueReceive(channelId_, std::move(receivePromise));
+void SensorServiceChannel::subscribe(ISensorServiceChannelEventHandler::Pointer eventHandler)
+{
+    this->subscribeMessages(std::move(eventHandler));
 }
 
 messenger::ChannelId SensorServiceChannel::getId() const
@@ -54,75 +61,42 @@ messenger::ChannelId SensorServiceChannel::getId() const
 
 void SensorServiceChannel::sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL));
-    message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL)
+                     .setId(proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
-void SensorServiceChannel::messageHandler(messenger::Message::Pointer message, ISensorServiceChannelEventHandler::Pointer eventHandler)
-{
-    messenger::MessageId messageId(message->getPayload());
-    common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
-
-    switch(messageId.getId())
-    {
-    case proto::ids::SensorChannelMessage::SENSOR_START_REQUEST:
-        this->handleSensorStartRequest(payload, std::move(eventHandler));
-        break;
-    case proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST:
-        this->handleChannelOpenRequest(payload, std::move(eventHandler));
-        break;
-    default:
-        AASDK_LOG(error) << "[SensorServiceChannel] message not handled: " << messageId.getId();
-        this->receive(std::move(eventHandler));
-        break;
-    }
-}
-
 void SensorServiceChannel::sendSensorEventIndication(const proto::messages::SensorEventIndication& indication, SendPromise::Pointer promise)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::SensorChannelMessage::SENSOR_EVENT_INDICATION).getData());
-    message->insertPayload(indication);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::SensorChannelMessage::SENSOR_EVENT_INDICATION)
+                     .setPayload(indication)
+                     .build());
 
     this->send(std::move(message), std::move(promise));
 }
 
-void SensorServiceChannel::sendSensorStartResponse(const proto::messages::SensorStartResponseMessage& response, SendPromise::Pointer promise)
+void SensorServiceChannel::sendSensorEventIndication(const proto::messages::SensorEventIndication& indication)
 {
-    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
-    message->insertPayload(messenger::MessageId(proto::ids::SensorChannelMessage::SENSOR_START_RESPONSE).getData());
-    message->insertPayload(response);
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::SensorChannelMessage::SENSOR_EVENT_INDICATION)
+                     .setPayload(indication)
+                     .build());
 
-    this->send(std::move(message), std::move(promise));
+    this->send(std::move(message));
 }
 
-void SensorServiceChannel::handleSensorStartRequest(const common::DataConstBuffer& payload, ISensorServiceChannelEventHandler::Pointer eventHandler)
+void SensorServiceChannel::sendSensorStartResponse(const proto::messages::SensorStartResponseMessage& response, SendPromise::Pointer promise)
 {
-    proto::messages::SensorStartRequestMessage request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onSensorStartRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
-}
+    auto message(messenger::MessageBuilder(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC)
+                     .setId(proto::ids::SensorChannelMessage::SENSOR_START_RESPONSE)
+                     .setPayload(response)
+                     .build());
 
-void SensorServiceChannel::handleChannelOpenRequest(const common::DataConstBuffer& payload, ISensorServiceChannelEventHandler::Pointer eventHandler)
-{
-    proto::messages::ChannelOpenRequest request;
-    if(request.ParseFromArray(payload.cdata, payload.size))
-    {
-        eventHandler->onChannelOpenRequest(request);
-    }
-    else
-    {
-        eventHandler->onChannelError(error::Error(error::ErrorCode::PARSE_PAYLOAD));
-    }
+    this->send(std::move(message), std::move(promise));
 }
 
 }
@@ -16,6 +16,7 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <f1x/aasdk/IO/IOContextWrapper.hpp>
 #include <f1x/aasdk/IO/PromiseLink.hpp>
 #include <f1x/aasdk/Channel/ServiceChannel.hpp>
 
@@ -32,6 +33,7 @@ ServiceChannel::ServiceChannel(boost::asio::io_service::strand& strand,
     : strand_(strand)
     , messenger_(std::move(messenger))
     , channelId_(channelId)
+    , subscribed_(false)
 {
 
 }
@@ -47,6 +49,22 @@ void ServiceChannel::send(messenger::Message::Pointer message, SendPromise::Poin
     messenger_->enqueueSend(std::move(message), std::move(sendPromise));
 }
 
+void ServiceChannel::send(messenger::Message::Pointer message)
+{
+    messenger_->enqueueSend(std::move(message));
+}
+
+void ServiceChannel::subscribe(messenger::ChannelSubscription::MessageHandler messageHandler, messenger::ChannelSubscription::ErrorHandler errorHandler)
+{
+    subscribed_ = true;
+
+    // Errors of promise-less sends are reported through the same handler as receive errors, on the channel strand.
+    messenger_->setSendErrorHandler(channelId_, [&strand = strand_, errorHandler](const error::Error& e) {
+        io::IOContextWrapper(strand).dispatch(std::bind(errorHandler, e));
+    });
+    messenger_->subscribe(channelId_, std::make_shared<messenger::ChannelSubscription>(strand_, std::move(messageHandler), std::move(errorHandler)));
+}
+
 }
 }
 }
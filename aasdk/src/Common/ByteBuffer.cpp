@@ -0,0 +1,305 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <f1x/aasdk/Common/ByteBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+ByteBuffer::ByteBuffer() noexcept
+    : data_(nullptr)
+    , size_(0)
+    , capacity_(0)
+{
+
+}
+
+ByteBuffer::ByteBuffer(size_type size)
+    : ByteBuffer(size, value_type(0))
+{
+
+}
+
+ByteBuffer::ByteBuffer(size_type size, value_type value)
+    : ByteBuffer(size, cDefaultInit)
+{
+    if(size_ > 0)
+    {
+        memset(data_, value, size_);
+    }
+}
+
+ByteBuffer::ByteBuffer(size_type size, DefaultInit)
+    : ByteBuffer()
+{
+    this->reallocate(size);
+    size_ = size;
+}
+
+ByteBuffer::ByteBuffer(std::initializer_list<value_type> values)
+    : ByteBuffer(values.begin(), values.end())
+{
+
+}
+
+ByteBuffer::ByteBuffer(const ByteBuffer& other)
+    : ByteBuffer(other.size_, cDefaultInit)
+{
+    if(size_ > 0)
+    {
+        memcpy(data_, other.data_, size_);
+    }
+}
+
+ByteBuffer::ByteBuffer(ByteBuffer&& other) noexcept
+    : data_(other.data_)
+    , size_(other.size_)
+    , capacity_(other.capacity_)
+{
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.capacity_ = 0;
+}
+
+ByteBuffer::~ByteBuffer()
+{
+    std::free(data_);
+}
+
+ByteBuffer& ByteBuffer::operator=(const ByteBuffer& other)
+{
+    if(this != &other)
+    {
+        this->resize(other.size_, cDefaultInit);
+
+        if(size_ > 0)
+        {
+            memcpy(data_, other.data_, size_);
+        }
+    }
+
+    return *this;
+}
+
+ByteBuffer& ByteBuffer::operator=(ByteBuffer&& other) noexcept
+{
+    if(this != &other)
+    {
+        std::free(data_);
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    return *this;
+}
+
+ByteBuffer& ByteBuffer::operator=(std::initializer_list<value_type> values)
+{
+    this->assign(values.begin(), values.end());
+    return *this;
+}
+
+ByteBuffer::reference ByteBuffer::at(size_type index)
+{
+    if(index >= size_)
+    {
+        throw std::out_of_range("ByteBuffer::at");
+    }
+
+    return data_[index];
+}
+
+ByteBuffer::const_reference ByteBuffer::at(size_type index) const
+{
+    if(index >= size_)
+    {
+        throw std::out_of_range("ByteBuffer::at");
+    }
+
+    return data_[index];
+}
+
+void ByteBuffer::reserve(size_type capacity)
+{
+    if(capacity > capacity_)
+    {
+        this->reallocate(capacity);
+    }
+}
+
+void ByteBuffer::shrink_to_fit()
+{
+    if(size_ < capacity_)
+    {
+        this->reallocate(size_);
+    }
+}
+
+void ByteBuffer::resize(size_type size)
+{
+    this->resize(size, value_type(0));
+}
+
+void ByteBuffer::resize(size_type size, value_type value)
+{
+    const auto oldSize = size_;
+    this->resize(size, cDefaultInit);
+
+    if(size > oldSize)
+    {
+        memset(data_ + oldSize, value, size - oldSize);
+    }
+}
+
+void ByteBuffer::resize(size_type size, DefaultInit)
+{
+    if(size > capacity_)
+    {
+        this->reallocate(this->getGrownCapacity(size));
+    }
+
+    size_ = size;
+}
+
+void ByteBuffer::swap(ByteBuffer& other) noexcept
+{
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+}
+
+void ByteBuffer::push_back(value_type value)
+{
+    this->resize(size_ + 1, cDefaultInit);
+    data_[size_ - 1] = value;
+}
+
+void ByteBuffer::assign(size_type count, value_type value)
+{
+    this->clear();
+    this->resize(count, value);
+}
+
+ByteBuffer::iterator ByteBuffer::insert(const_iterator position, value_type value)
+{
+    auto gap = this->makeGap(position, 1);
+    *gap = value;
+    return gap;
+}
+
+ByteBuffer::iterator ByteBuffer::insert(const_iterator position, size_type count, value_type value)
+{
+    auto gap = this->makeGap(position, count);
+    memset(gap, value, count);
+    return gap;
+}
+
+ByteBuffer::iterator ByteBuffer::insert(const_iterator position, std::initializer_list<value_type> values)
+{
+    return this->insert(position, values.begin(), values.end());
+}
+
+ByteBuffer::iterator ByteBuffer::erase(const_iterator position)
+{
+    return this->erase(position, position + 1);
+}
+
+ByteBuffer::iterator ByteBuffer::erase(const_iterator first, const_iterator last)
+{
+    const auto offset = static_cast<size_type>(first - data_);
+    const auto count = static_cast<size_type>(last - first);
+
+    if(count > 0)
+    {
+        memmove(data_ + offset, data_ + offset + count, size_ - offset - count);
+        size_ -= count;
+    }
+
+    return data_ + offset;
+}
+
+ByteBuffer::iterator ByteBuffer::makeGap(const_iterator position, size_type count)
+{
+    const auto offset = static_cast<size_type>(position - data_);
+
+    if(count == 0)
+    {
+        return data_ + offset;
+    }
+
+    const auto oldSize = size_;
+    this->resize(size_ + count, cDefaultInit);
+    memmove(data_ + offset + count, data_ + offset, oldSize - offset);
+    return data_ + offset;
+}
+
+void ByteBuffer::reallocate(size_type capacity)
+{
+    if(capacity == 0)
+    {
+        std::free(data_);
+        data_ = nullptr;
+        capacity_ = 0;
+        return;
+    }
+
+    auto data = static_cast<value_type*>(std::realloc(data_, capacity));
+
+    if(data == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    data_ = data;
+    capacity_ = capacity;
+}
+
+ByteBuffer::size_type ByteBuffer::getGrownCapacity(size_type size) const
+{
+    return std::max(size, capacity_ * 2);
+}
+
+bool operator==(const ByteBuffer& left, const ByteBuffer& right)
+{
+    return left.size() == right.size() && (left.empty() || memcmp(left.data(), right.data(), left.size()) == 0);
+}
+
+bool operator!=(const ByteBuffer& left, const ByteBuffer& right)
+{
+    return !(left == right);
+}
+
+bool operator<(const ByteBuffer& left, const ByteBuffer& right)
+{
+    return std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end());
+}
+
+}
+}
+}
@@ -0,0 +1,98 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <list>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/ByteBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(ByteBuffer_InsertInTheMiddle)
+{
+    ByteBuffer buffer{1, 5};
+    const uint8_t values[] = {2, 3};
+
+    buffer.insert(buffer.begin() + 1, std::begin(values), std::end(values));
+    buffer.insert(buffer.end() - 1, 4);
+
+    const ByteBuffer expectedBuffer{1, 2, 3, 4, 5};
+    BOOST_CHECK(buffer == expectedBuffer);
+}
+
+BOOST_AUTO_TEST_CASE(ByteBuffer_InsertFromInputIterators)
+{
+    const std::list<uint8_t> values{7, 8, 9};
+    ByteBuffer buffer(values.begin(), values.end());
+    buffer.insert(buffer.begin(), values.begin(), values.end());
+
+    const ByteBuffer expectedBuffer{7, 8, 9, 7, 8, 9};
+    BOOST_CHECK(buffer == expectedBuffer);
+}
+
+BOOST_AUTO_TEST_CASE(ByteBuffer_EraseRange)
+{
+    ByteBuffer buffer{1, 2, 3, 4, 5};
+    auto next = buffer.erase(buffer.begin() + 1, buffer.begin() + 3);
+
+    const ByteBuffer expectedBuffer{1, 4, 5};
+    BOOST_CHECK(buffer == expectedBuffer);
+    BOOST_CHECK_EQUAL(*next, 4);
+}
+
+BOOST_AUTO_TEST_CASE(ByteBuffer_CopyAndMove)
+{
+    ByteBuffer buffer(100, 0x3C);
+    ByteBuffer copiedBuffer(buffer);
+    BOOST_CHECK(copiedBuffer == buffer);
+    BOOST_CHECK(copiedBuffer.data() != buffer.data());
+
+    const auto data = buffer.data();
+    ByteBuffer movedBuffer(std::move(buffer));
+    BOOST_CHECK_EQUAL(movedBuffer.data(), data);
+    BOOST_CHECK(buffer.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ByteBuffer_DefaultInitResizeKeepsCapacityGrowthGeometric)
+{
+    ByteBuffer buffer;
+    buffer.resize(1000, cDefaultInit);
+    const auto capacity = buffer.capacity();
+    buffer.resize(1001, cDefaultInit);
+
+    BOOST_CHECK_EQUAL(buffer.size(), 1001);
+    BOOST_CHECK(buffer.capacity() >= 2 * capacity);
+}
+
+BOOST_AUTO_TEST_CASE(ByteBuffer_Compare)
+{
+    BOOST_CHECK(ByteBuffer({1, 2}) < ByteBuffer({1, 2, 0}));
+    BOOST_CHECK(ByteBuffer({1, 2}) != ByteBuffer({1, 3}));
+    BOOST_CHECK(ByteBuffer() == ByteBuffer(0, 5));
+}
+
+}
+}
+}
+}
@@ -0,0 +1,81 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/Data.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace bench
+{
+
+// Appends a received frame into a buffer which already has the capacity for it, as
+// Message::insertPayload and Cryptor::decrypt do, and returns nanoseconds per append.
+template<typename DataType, typename AppendFunctor>
+static size_t measureAppend(const Data& frame, size_t appendsCount, AppendFunctor append)
+{
+    DataType data;
+    data.reserve(frame.size());
+    size_t checksum = 0;
+
+    const auto begin = std::chrono::steady_clock::now();
+
+    for(size_t i = 0; i < appendsCount; ++i)
+    {
+        data.clear();
+        append(data, DataConstBuffer(frame));
+        checksum += data[i % data.size()];
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+    BOOST_CHECK_EQUAL(checksum, appendsCount * 0x5E);
+    return elapsed / appendsCount;
+}
+
+BOOST_AUTO_TEST_CASE(Data_AppendCostPerFrame)
+{
+    const size_t appendsCount = 5000;
+
+    for(const size_t frameSize : {1024, 16384, 131072, 524288})
+    {
+        const Data frame(frameSize, 0x5E);
+        const auto zeroFilledNs = measureAppend<std::vector<uint8_t>>(frame, appendsCount, [](std::vector<uint8_t>& data, const DataConstBuffer& buffer) {
+            const auto offset = data.size();
+            data.resize(offset + buffer.size);
+            memcpy(&data[offset], buffer.cdata, buffer.size);
+        });
+        const auto defaultInitializedNs = measureAppend<Data>(frame, appendsCount, [](Data& data, const DataConstBuffer& buffer) {
+            copy(data, buffer);
+        });
+
+        std::cout << "[Data] append, frame size: " << frameSize
+                  << ", ns per frame zero-filled: " << zeroFilledNs
+                  << ", default-initialized: " << defaultInitializedNs << std::endl;
+    }
+}
+
+}
+}
+}
+}
@@ -0,0 +1,66 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/Data.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(Data_CopyAppendsBuffer)
+{
+    Data data{1, 2};
+    const Data appended{3, 4, 5};
+
+    copy(data, DataConstBuffer(appended));
+    copy(data, DataConstBuffer(appended, 2));
+
+    const Data expectedData{1, 2, 3, 4, 5, 5};
+    BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(), expectedData.begin(), expectedData.end());
+}
+
+BOOST_AUTO_TEST_CASE(Data_ExplicitValueInitializesElements)
+{
+    Data data(3, 0);
+    data.resize(5, 7);
+    data.insert(data.begin(), 2, 9);
+
+    const Data expectedData{9, 9, 0, 0, 0, 7, 7};
+    BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(), expectedData.begin(), expectedData.end());
+}
+
+BOOST_AUTO_TEST_CASE(Data_ResizeKeepsExistingElements)
+{
+    Data data{1, 2, 3};
+    data.resize(1024);
+    data.resize(2);
+
+    const Data expectedData{1, 2};
+    BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(), expectedData.begin(), expectedData.end());
+}
+
+}
+}
+}
+}
@@ -0,0 +1,202 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/Common/LockProfiler.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+LockProfiler::Lock::Lock(std::string name)
+    : name_(std::move(name))
+{
+    this->reset();
+}
+
+void LockProfiler::Lock::acquired(Clock::duration waitTime, bool contended)
+{
+    acquisitionsCount_.fetch_add(1, std::memory_order_relaxed);
+
+    if(contended)
+    {
+        contendedCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    record(waitHistogram_, totalWaitTime_, maxWaitTime_, waitTime);
+}
+
+void LockProfiler::Lock::released(Clock::duration holdTime)
+{
+    record(holdHistogram_, totalHoldTime_, maxHoldTime_, holdTime);
+}
+
+void LockProfiler::Lock::record(AtomicHistogram& histogram, std::atomic<Clock::rep>& total, std::atomic<Clock::rep>& max, Clock::duration duration)
+{
+    histogram[LockProfiler::getBucket(duration)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(duration.count(), std::memory_order_relaxed);
+
+    auto currentMax = max.load(std::memory_order_relaxed);
+    while(duration.count() > currentMax && !max.compare_exchange_weak(currentMax, duration.count(), std::memory_order_relaxed));
+}
+
+LockProfiler::Histogram LockProfiler::Lock::load(const AtomicHistogram& histogram)
+{
+    Histogram result;
+    std::transform(histogram.begin(), histogram.end(), result.begin(), [](const std::atomic<size_t>& bucket) { return bucket.load(std::memory_order_relaxed); });
+    return result;
+}
+
+LockProfiler::Statistics LockProfiler::Lock::getStatistics() const
+{
+    Statistics statistics;
+    statistics.name = name_;
+    statistics.acquisitionsCount = acquisitionsCount_.load(std::memory_order_relaxed);
+    statistics.contendedCount = contendedCount_.load(std::memory_order_relaxed);
+    statistics.totalWaitTime = Clock::duration(totalWaitTime_.load(std::memory_order_relaxed));
+    statistics.maxWaitTime = Clock::duration(maxWaitTime_.load(std::memory_order_relaxed));
+    statistics.totalHoldTime = Clock::duration(totalHoldTime_.load(std::memory_order_relaxed));
+    statistics.maxHoldTime = Clock::duration(maxHoldTime_.load(std::memory_order_relaxed));
+    statistics.waitHistogram = load(waitHistogram_);
+    statistics.holdHistogram = load(holdHistogram_);
+
+    return statistics;
+}
+
+void LockProfiler::Lock::reset()
+{
+    acquisitionsCount_ = 0;
+    contendedCount_ = 0;
+    totalWaitTime_ = 0;
+    maxWaitTime_ = 0;
+    totalHoldTime_ = 0;
+    maxHoldTime_ = 0;
+
+    for(size_t i = 0; i < cBucketsCount; ++i)
+    {
+        waitHistogram_[i] = 0;
+        holdHistogram_[i] = 0;
+    }
+}
+
+LockProfiler& LockProfiler::getInstance()
+{
+    // Never destroyed, mutexes of static objects keep references to their Lock.
+    static auto instance = new LockProfiler();
+    return *instance;
+}
+
+LockProfiler::Lock& LockProfiler::getLock(const std::string& name)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    auto& profile = locks_[name];
+    if(profile == nullptr)
+    {
+        profile.reset(new Lock(name));
+    }
+
+    return *profile;
+}
+
+std::vector<LockProfiler::Statistics> LockProfiler::getStatistics() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    std::vector<Statistics> statistics;
+    statistics.reserve(locks_.size());
+
+    for(const auto& entry : locks_)
+    {
+        statistics.push_back(entry.second->getStatistics());
+    }
+
+    return statistics;
+}
+
+void LockProfiler::dump() const
+{
+    auto statistics = this->getStatistics();
+
+    // Locks costing the most waiting time come first.
+    std::sort(statistics.begin(), statistics.end(), [](const Statistics& lhs, const Statistics& rhs) { return lhs.totalWaitTime > rhs.totalWaitTime; });
+
+    const auto toMicroseconds = [](Clock::duration duration) { return std::chrono::duration_cast<std::chrono::microseconds>(duration).count(); };
+    const auto toString = [](const Histogram& histogram) {
+        std::string result;
+        for(const auto count : histogram)
+        {
+            result += (result.empty() ? "" : " ") + std::to_string(count);
+        }
+        return result;
+    };
+
+    for(const auto& entry : statistics)
+    {
+        AASDK_LOG(info) << "[LockProfiler] lock: " << entry.name
+                        << ", acquisitions: " << entry.acquisitionsCount
+                        << ", contended: " << entry.contendedCount
+                        << ", total wait: " << toMicroseconds(entry.totalWaitTime) << " us"
+                        << ", max wait: " << toMicroseconds(entry.maxWaitTime) << " us"
+                        << ", total hold: " << toMicroseconds(entry.totalHoldTime) << " us"
+                        << ", max hold: " << toMicroseconds(entry.maxHoldTime) << " us";
+        AASDK_LOG(info) << "[LockProfiler] lock: " << entry.name << ", wait histogram (log2 us): " << toString(entry.waitHistogram);
+        AASDK_LOG(info) << "[LockProfiler] lock: " << entry.name << ", hold histogram (log2 us): " << toString(entry.holdHistogram);
+    }
+}
+
+void LockProfiler::reset()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    for(auto& entry : locks_)
+    {
+        entry.second->reset();
+    }
+}
+
+size_t LockProfiler::getBucket(Clock::duration duration)
+{
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    size_t bucket = 0;
+
+    while(microseconds > 0 && bucket < cBucketsCount - 1)
+    {
+        microseconds >>= 1;
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+bool LockProfiler::isEnabled()
+{
+#ifdef AASDK_LOCK_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+}
+}
+}
@@ -0,0 +1,92 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <thread>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/LockProfiler.hpp>
+#include <f1x/aasdk/Common/ProfiledMutex.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(LockProfiler_Buckets)
+{
+    BOOST_CHECK_EQUAL(LockProfiler::getBucket(std::chrono::nanoseconds(500)), 0);
+    BOOST_CHECK_EQUAL(LockProfiler::getBucket(std::chrono::microseconds(1)), 1);
+    BOOST_CHECK_EQUAL(LockProfiler::getBucket(std::chrono::microseconds(3)), 2);
+    BOOST_CHECK_EQUAL(LockProfiler::getBucket(std::chrono::microseconds(4)), 3);
+    BOOST_CHECK_EQUAL(LockProfiler::getBucket(std::chrono::seconds(10)), LockProfiler::cBucketsCount - 1);
+}
+
+BOOST_AUTO_TEST_CASE(LockProfiler_LocksSharedByName)
+{
+    auto& profiler = LockProfiler::getInstance();
+    auto& lock = profiler.getLock("LockProfiler_LocksSharedByName");
+    lock.reset();
+    BOOST_CHECK_EQUAL(&profiler.getLock("LockProfiler_LocksSharedByName"), &lock);
+
+    lock.acquired(std::chrono::microseconds(0), false);
+    lock.released(std::chrono::microseconds(2));
+    lock.acquired(std::chrono::microseconds(5), true);
+    lock.released(std::chrono::microseconds(1));
+
+    const auto statistics = lock.getStatistics();
+    BOOST_CHECK_EQUAL(statistics.acquisitionsCount, 2);
+    BOOST_CHECK_EQUAL(statistics.contendedCount, 1);
+    BOOST_CHECK(statistics.totalWaitTime == std::chrono::microseconds(5));
+    BOOST_CHECK(statistics.maxHoldTime == std::chrono::microseconds(2));
+    BOOST_CHECK_EQUAL(statistics.waitHistogram[0], 1);
+    BOOST_CHECK_EQUAL(statistics.waitHistogram[3], 1);
+    BOOST_CHECK_EQUAL(statistics.holdHistogram[1], 1);
+    BOOST_CHECK_EQUAL(statistics.holdHistogram[2], 1);
+}
+
+#ifdef AASDK_LOCK_PROFILER
+BOOST_AUTO_TEST_CASE(ProfiledMutex_RecordsContention)
+{
+    ProfiledMutex<std::mutex> mutex("ProfiledMutex_RecordsContention");
+    auto& lock = LockProfiler::getInstance().getLock("ProfiledMutex_RecordsContention");
+    lock.reset();
+
+    mutex.lock();
+    std::thread waiter([&mutex]() {
+        std::lock_guard<decltype(mutex)> guard(mutex);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    mutex.unlock();
+    waiter.join();
+
+    const auto statistics = lock.getStatistics();
+    BOOST_CHECK_EQUAL(statistics.acquisitionsCount, 2);
+    BOOST_CHECK_EQUAL(statistics.contendedCount, 1);
+    BOOST_CHECK(statistics.maxWaitTime >= std::chrono::milliseconds(10));
+    BOOST_CHECK(statistics.maxHoldTime >= std::chrono::milliseconds(20));
+}
+#endif
+
+}
+}
+}
+}
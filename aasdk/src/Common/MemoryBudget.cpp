@@ -0,0 +1,212 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+constexpr size_t MemoryBudget::cUnlimited;
+
+MemoryBudget::MemoryBudget()
+    : total_{"total", 0, 0, 0}
+    , limit_(cUnlimited)
+{
+
+}
+
+MemoryBudget& MemoryBudget::getInstance()
+{
+    // Never destroyed, reservations of static objects keep references to their account.
+    static auto instance = new MemoryBudget();
+    return *instance;
+}
+
+MemoryReservation MemoryBudget::reserve(const std::string& component, size_t desiredSize, size_t minimumSize)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    auto& account = accounts_[component];
+    if(account == nullptr)
+    {
+        account.reset(new Statistics{component, 0, 0, 0});
+    }
+
+    const auto availableSize = limit_ > total_.currentSize ? limit_ - total_.currentSize : 0;
+    const auto size = std::max(std::min(desiredSize, availableSize), std::min(minimumSize, desiredSize));
+
+    if(size > availableSize)
+    {
+        AASDK_LOG(warning) << "[MemoryBudget] " << component << " reserves " << size << " bytes, over the limit of " << limit_ << " bytes.";
+    }
+    else if(size < desiredSize)
+    {
+        AASDK_LOG(info) << "[MemoryBudget] " << component << " limited to " << size << " of " << desiredSize << " bytes.";
+    }
+
+    ++account->reservationsCount;
+    ++total_.reservationsCount;
+    this->resize(*account, 0, size);
+
+    return MemoryReservation(*this, *account, size);
+}
+
+void MemoryBudget::setLimit(size_t limit)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    limit_ = limit;
+}
+
+size_t MemoryBudget::getLimit() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return limit_;
+}
+
+MemoryBudget::Statistics MemoryBudget::getTotalStatistics() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return total_;
+}
+
+std::vector<MemoryBudget::Statistics> MemoryBudget::getStatistics() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    std::vector<Statistics> statistics;
+    statistics.reserve(accounts_.size());
+
+    for(const auto& entry : accounts_)
+    {
+        statistics.push_back(*entry.second);
+    }
+
+    return statistics;
+}
+
+void MemoryBudget::dump() const
+{
+    const auto total = this->getTotalStatistics();
+    const auto limit = this->getLimit();
+
+    AASDK_LOG(info) << "[MemoryBudget] limit: " << (limit == cUnlimited ? std::string("none") : std::to_string(limit / 1024) + " kB")
+                    << ", current: " << total.currentSize / 1024 << " kB"
+                    << ", peak: " << total.peakSize / 1024 << " kB";
+
+    for(const auto& entry : this->getStatistics())
+    {
+        AASDK_LOG(info) << "[MemoryBudget] component: " << entry.name
+                        << ", reservations: " << entry.reservationsCount
+                        << ", current: " << entry.currentSize / 1024 << " kB"
+                        << ", peak: " << entry.peakSize / 1024 << " kB";
+    }
+}
+
+void MemoryBudget::resize(Statistics& account, size_t currentSize, size_t newSize)
+{
+    for(auto statistics : {&account, &total_})
+    {
+        statistics->currentSize = statistics->currentSize - currentSize + newSize;
+        statistics->peakSize = std::max(statistics->peakSize, statistics->currentSize);
+    }
+}
+
+MemoryReservation::MemoryReservation()
+    : budget_(nullptr)
+    , account_(nullptr)
+    , size_(0)
+{
+
+}
+
+MemoryReservation::MemoryReservation(MemoryBudget& budget, MemoryBudget::Statistics& account, size_t size)
+    : budget_(&budget)
+    , account_(&account)
+    , size_(size)
+{
+
+}
+
+MemoryReservation::MemoryReservation(MemoryReservation&& other)
+    : budget_(other.budget_)
+    , account_(other.account_)
+    , size_(other.size_)
+{
+    other.budget_ = nullptr;
+    other.account_ = nullptr;
+    other.size_ = 0;
+}
+
+MemoryReservation& MemoryReservation::operator=(MemoryReservation&& other)
+{
+    if(this != &other)
+    {
+        this->release();
+        std::swap(budget_, other.budget_);
+        std::swap(account_, other.account_);
+        std::swap(size_, other.size_);
+    }
+
+    return *this;
+}
+
+MemoryReservation::~MemoryReservation()
+{
+    this->release();
+}
+
+size_t MemoryReservation::getSize() const
+{
+    return size_;
+}
+
+void MemoryReservation::resize(size_t size)
+{
+    if(budget_ != nullptr)
+    {
+        std::lock_guard<decltype(budget_->mutex_)> lock(budget_->mutex_);
+        budget_->resize(*account_, size_, size);
+    }
+
+    size_ = size;
+}
+
+void MemoryReservation::release()
+{
+    if(budget_ != nullptr)
+    {
+        std::lock_guard<decltype(budget_->mutex_)> lock(budget_->mutex_);
+        --account_->reservationsCount;
+        --budget_->total_.reservationsCount;
+        budget_->resize(*account_, size_, 0);
+    }
+
+    budget_ = nullptr;
+    account_ = nullptr;
+    size_ = 0;
+}
+
+}
+}
+}
@@ -0,0 +1,119 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace ut
+{
+
+class MemoryBudgetUnitTest
+{
+protected:
+    MemoryBudgetUnitTest()
+        : budget_(MemoryBudget::getInstance())
+        , limit_(budget_.getLimit())
+    {
+        budget_.setLimit(budget_.getTotalStatistics().currentSize + 1000);
+    }
+
+    ~MemoryBudgetUnitTest()
+    {
+        budget_.setLimit(limit_);
+    }
+
+    static const MemoryBudget::Statistics* find(const std::vector<MemoryBudget::Statistics>& statistics, const std::string& name)
+    {
+        for(const auto& entry : statistics)
+        {
+            if(entry.name == name)
+            {
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    MemoryBudget& budget_;
+    size_t limit_;
+};
+
+BOOST_FIXTURE_TEST_CASE(MemoryBudget_GrantDesiredSizeWithinLimit, MemoryBudgetUnitTest)
+{
+    const auto reservation = budget_.reserve("MemoryBudget_GrantDesiredSizeWithinLimit", 600, 100);
+    BOOST_CHECK_EQUAL(reservation.getSize(), 600u);
+}
+
+BOOST_FIXTURE_TEST_CASE(MemoryBudget_LimitSizeWhenBudgetIsExhausted, MemoryBudgetUnitTest)
+{
+    const auto firstReservation = budget_.reserve("MemoryBudget_LimitSizeWhenBudgetIsExhausted", 600, 100);
+    const auto secondReservation = budget_.reserve("MemoryBudget_LimitSizeWhenBudgetIsExhausted", 600, 100);
+    BOOST_CHECK_EQUAL(secondReservation.getSize(), 400u);
+
+    const auto thirdReservation = budget_.reserve("MemoryBudget_LimitSizeWhenBudgetIsExhausted", 600, 100);
+    BOOST_CHECK_EQUAL(thirdReservation.getSize(), 100u);
+
+    const auto fourthReservation = budget_.reserve("MemoryBudget_LimitSizeWhenBudgetIsExhausted", 50, 100);
+    BOOST_CHECK_EQUAL(fourthReservation.getSize(), 50u);
+}
+
+BOOST_FIXTURE_TEST_CASE(MemoryBudget_TrackCurrentAndPeakSizeOfComponent, MemoryBudgetUnitTest)
+{
+    const std::string component("MemoryBudget_TrackCurrentAndPeakSizeOfComponent");
+
+    {
+        auto reservation = budget_.reserve(component, 300, 0);
+        reservation.resize(700);
+        auto movedReservation(std::move(reservation));
+        BOOST_CHECK_EQUAL(reservation.getSize(), 0u);
+
+        const auto statistics = budget_.getStatistics();
+        const auto entry = find(statistics, component);
+        BOOST_REQUIRE(entry != nullptr);
+        BOOST_CHECK_EQUAL(entry->reservationsCount, 1u);
+        BOOST_CHECK_EQUAL(entry->currentSize, 700u);
+    }
+
+    const auto statistics = budget_.getStatistics();
+    const auto entry = find(statistics, component);
+    BOOST_REQUIRE(entry != nullptr);
+    BOOST_CHECK_EQUAL(entry->reservationsCount, 0u);
+    BOOST_CHECK_EQUAL(entry->currentSize, 0u);
+    BOOST_CHECK_EQUAL(entry->peakSize, 700u);
+}
+
+BOOST_FIXTURE_TEST_CASE(MemoryBudget_ReleasedSizeIsAvailableAgain, MemoryBudgetUnitTest)
+{
+    auto reservation = budget_.reserve("MemoryBudget_ReleasedSizeIsAvailableAgain", 1000, 0);
+    reservation = MemoryReservation();
+
+    const auto otherReservation = budget_.reserve("MemoryBudget_ReleasedSizeIsAvailableAgain", 1000, 0);
+    BOOST_CHECK_EQUAL(otherReservation.getSize(), 1000u);
+}
+
+}
+}
+}
+}
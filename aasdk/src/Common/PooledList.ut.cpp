@@ -0,0 +1,154 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/PooledList.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace ut
+{
+
+template<typename ValueType>
+class CountingAllocator: public std::allocator<ValueType>
+{
+public:
+    template<typename OtherType>
+    struct rebind
+    {
+        typedef CountingAllocator<OtherType> other;
+    };
+
+    CountingAllocator(size_t& allocationsCount)
+        : allocationsCount_(&allocationsCount)
+    {
+
+    }
+
+    template<typename OtherType>
+    CountingAllocator(const CountingAllocator<OtherType>& other)
+        : allocationsCount_(other.allocationsCount_)
+    {
+
+    }
+
+    ValueType* allocate(size_t count)
+    {
+        ++*allocationsCount_;
+        return std::allocator<ValueType>::allocate(count);
+    }
+
+    size_t* allocationsCount_;
+};
+
+template<typename LeftType, typename RightType>
+bool operator==(const CountingAllocator<LeftType>& left, const CountingAllocator<RightType>& right)
+{
+    return left.allocationsCount_ == right.allocationsCount_;
+}
+
+template<typename LeftType, typename RightType>
+bool operator!=(const CountingAllocator<LeftType>& left, const CountingAllocator<RightType>& right)
+{
+    return !(left == right);
+}
+
+typedef std::pair<int, std::shared_ptr<int>> QueueElement;
+typedef PooledList<QueueElement, CountingAllocator<QueueElement>> CountingPooledList;
+
+BOOST_AUTO_TEST_CASE(PooledList_NoAllocationsWithinReservedCapacity)
+{
+    size_t allocationsCount = 0;
+    CountingPooledList list(4, CountingAllocator<QueueElement>(allocationsCount));
+    const auto reservedAllocationsCount = allocationsCount;
+
+    for(int i = 0; i < 1000; ++i)
+    {
+        list.emplace_back(std::make_pair(i, nullptr));
+        list.emplace_back(std::make_pair(i + 1, nullptr));
+        BOOST_CHECK_EQUAL(list.front().first, i);
+        list.pop_front();
+        list.erase(list.begin());
+    }
+
+    BOOST_CHECK(list.empty());
+    BOOST_CHECK_EQUAL(allocationsCount, reservedAllocationsCount);
+    BOOST_CHECK_EQUAL(list.getCapacity(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(PooledList_GrowsBeyondReservedCapacityAndKeepsNodes)
+{
+    size_t allocationsCount = 0;
+    CountingPooledList list(1, CountingAllocator<QueueElement>(allocationsCount));
+    list.emplace_back(std::make_pair(1, nullptr));
+    list.emplace_back(std::make_pair(2, nullptr));
+    list.emplace_back(std::make_pair(3, nullptr));
+    BOOST_CHECK_EQUAL(list.getCapacity(), 3);
+
+    list.clear();
+    const auto grownAllocationsCount = allocationsCount;
+
+    for(int i = 0; i < 3; ++i)
+    {
+        list.emplace_back(std::make_pair(i, nullptr));
+    }
+
+    BOOST_CHECK_EQUAL(list.size(), 3);
+    BOOST_CHECK_EQUAL(allocationsCount, grownAllocationsCount);
+}
+
+BOOST_AUTO_TEST_CASE(PooledList_EraseKeepsOtherIteratorsValid)
+{
+    PooledList<int> list(3);
+    auto first = list.emplace_back(1);
+    auto second = list.emplace_back(2);
+    auto third = list.emplace_back(3);
+
+    BOOST_CHECK(list.erase(second) == third);
+    BOOST_CHECK_EQUAL(*first, 1);
+    BOOST_CHECK_EQUAL(*third, 3);
+
+    auto fourth = list.emplace_back(4);
+    BOOST_CHECK(std::next(third) == fourth);
+    BOOST_CHECK(std::next(first) == third);
+    BOOST_CHECK_EQUAL(list.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(PooledList_ErasedElementReleasesValue)
+{
+    auto value = std::make_shared<int>(5);
+    PooledList<std::shared_ptr<int>> list(2);
+    list.emplace_back(value);
+    list.emplace_back(value);
+    BOOST_CHECK_EQUAL(value.use_count(), 3);
+
+    list.pop_front();
+    BOOST_CHECK_EQUAL(value.use_count(), 2);
+
+    list.clear();
+    BOOST_CHECK_EQUAL(value.use_count(), 1);
+}
+
+}
+}
+}
+}
@@ -0,0 +1,95 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/SessionArena.hpp>
+#include <f1x/aasdk/Messenger/MessagePool.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace bench
+{
+
+static size_t getResidentSize()
+{
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    std::ifstream("/proc/self/statm") >> totalPages >> residentPages;
+    return residentPages * sysconf(_SC_PAGESIZE);
+}
+
+// One connection: session objects of mixed sizes, messages going through the pool and
+// long-lived objects released at arbitrary points, with a heap allocation interleaved
+// that outlives the session as the rest of the application would make.
+static void simulateSession(std::vector<std::shared_ptr<void>>& applicationObjects, size_t sessionIndex)
+{
+    auto arena = std::make_shared<SessionArena>();
+    auto messagePool = allocateShared<messenger::MessagePool>(arena, arena);
+    std::vector<std::shared_ptr<void>> sessionObjects;
+
+    for(size_t i = 0; i < 200; ++i)
+    {
+        sessionObjects.push_back(allocateShared<std::array<uint8_t, 96>>(arena));
+        sessionObjects.push_back(allocateShared<std::array<uint8_t, 700>>(arena));
+
+        auto message = messagePool->acquire(messenger::ChannelId::VIDEO, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC);
+        sessionObjects.push_back(std::move(message));
+
+        if(i % 3 == 0)
+        {
+            sessionObjects.erase(sessionObjects.begin() + (i % sessionObjects.size()));
+        }
+    }
+
+    applicationObjects[sessionIndex % applicationObjects.size()] = std::make_shared<std::array<uint8_t, 64>>();
+}
+
+BOOST_AUTO_TEST_CASE(SessionArena_ResidentSizeAcrossReconnects)
+{
+    const size_t reconnectsCount = 1000;
+    std::vector<std::shared_ptr<void>> applicationObjects(64);
+
+    for(size_t i = 0; i < 10; ++i)
+    {
+        simulateSession(applicationObjects, i);
+    }
+
+    const auto initialResidentSize = getResidentSize();
+
+    for(size_t i = 0; i < reconnectsCount; ++i)
+    {
+        simulateSession(applicationObjects, i);
+    }
+
+    const auto finalResidentSize = getResidentSize();
+    std::cout << "[SessionArena] reconnects: " << reconnectsCount
+              << ", resident size before: " << initialResidentSize / 1024 << " kB"
+              << ", after: " << finalResidentSize / 1024 << " kB" << std::endl;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,182 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <new>
+#include <f1x/aasdk/Common/SessionArena.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+SessionArena::SessionArena()
+    : pages_(nullptr)
+    , pageCursor_(nullptr)
+    , pageRemainingSize_(0)
+    , largeFreeBlocks_(nullptr)
+    , statistics_{}
+    , mutex_("SessionArena")
+{
+    freeBlocks_.fill(nullptr);
+}
+
+SessionArena::~SessionArena()
+{
+    while(pages_ != nullptr)
+    {
+        auto page = pages_;
+        pages_ = page->next;
+        ::operator delete(page);
+    }
+}
+
+void* SessionArena::allocate(size_t size)
+{
+    if(size > cMaxLargeBlockSize)
+    {
+        {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            ++statistics_.largeAllocationsCount;
+        }
+
+        return ::operator new(size);
+    }
+    else if(size > cMaxBlockSize)
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        ++statistics_.allocatedBlocksCount;
+        return this->allocateLarge(getLargeBlockSize(size));
+    }
+
+    const auto sizeClass = getSizeClass(size);
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    ++statistics_.allocatedBlocksCount;
+
+    auto& freeBlock = freeBlocks_[sizeClass];
+
+    if(freeBlock != nullptr)
+    {
+        auto block = freeBlock;
+        freeBlock = block->next;
+        return block;
+    }
+
+    return this->allocateFromPage(getBlockSize(sizeClass));
+}
+
+void SessionArena::deallocate(void* block, size_t size)
+{
+    if(size > cMaxLargeBlockSize)
+    {
+        {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            --statistics_.largeAllocationsCount;
+        }
+
+        ::operator delete(block);
+        return;
+    }
+    else if(size > cMaxBlockSize)
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        --statistics_.allocatedBlocksCount;
+
+        auto largeFreeBlock = static_cast<LargeFreeBlock*>(block);
+        largeFreeBlock->size = getLargeBlockSize(size);
+        largeFreeBlock->next = largeFreeBlocks_;
+        largeFreeBlocks_ = largeFreeBlock;
+        return;
+    }
+
+    const auto sizeClass = getSizeClass(size);
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    --statistics_.allocatedBlocksCount;
+
+    auto freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = freeBlocks_[sizeClass];
+    freeBlocks_[sizeClass] = freeBlock;
+}
+
+SessionArena::Statistics SessionArena::getStatistics() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return statistics_;
+}
+
+size_t SessionArena::getSizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+
+    while(getBlockSize(sizeClass) < size)
+    {
+        ++sizeClass;
+    }
+
+    return sizeClass;
+}
+
+size_t SessionArena::getBlockSize(size_t sizeClass)
+{
+    return cMinBlockSize << sizeClass;
+}
+
+size_t SessionArena::getLargeBlockSize(size_t size)
+{
+    return (size + cMinBlockSize - 1) / cMinBlockSize * cMinBlockSize;
+}
+
+void* SessionArena::allocateLarge(size_t size)
+{
+    for(auto freeBlock = &largeFreeBlocks_; *freeBlock != nullptr; freeBlock = &(*freeBlock)->next)
+    {
+        if((*freeBlock)->size == size)
+        {
+            auto block = *freeBlock;
+            *freeBlock = block->next;
+            return block;
+        }
+    }
+
+    return this->allocateFromPage(size);
+}
+
+void* SessionArena::allocateFromPage(size_t blockSize)
+{
+    if(pageRemainingSize_ < blockSize)
+    {
+        // The rest of the current page is too small for this class and stays unused until the arena is freed.
+        auto page = static_cast<PageHeader*>(::operator new(cPageSize));
+        page->next = pages_;
+        pages_ = page;
+        ++statistics_.pagesCount;
+
+        pageCursor_ = reinterpret_cast<uint8_t*>(page) + sizeof(PageHeader);
+        pageRemainingSize_ = cPageSize - sizeof(PageHeader);
+    }
+
+    auto block = pageCursor_;
+    pageCursor_ += blockSize;
+    pageRemainingSize_ -= blockSize;
+    return block;
+}
+
+}
+}
+}
@@ -0,0 +1,158 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Transport/UT/Transport.mock.hpp>
+#include <f1x/aasdk/Messenger/UT/Cryptor.mock.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+#include <f1x/aasdk/Common/SessionArena.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(SessionArena_ReuseReleasedBlockOfSizeClass)
+{
+    SessionArena arena;
+    auto block = arena.allocate(40);
+    arena.deallocate(block, 40);
+
+    BOOST_CHECK_EQUAL(arena.allocate(64), block);
+    BOOST_CHECK(arena.allocate(40) != block);
+    BOOST_CHECK_EQUAL(arena.getStatistics().allocatedBlocksCount, 2u);
+    BOOST_CHECK_EQUAL(arena.getStatistics().pagesCount, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(SessionArena_AddPageWhenCurrentIsFull)
+{
+    SessionArena arena;
+
+    for(size_t i = 0; i < SessionArena::cPageSize / SessionArena::cMaxBlockSize; ++i)
+    {
+        arena.allocate(SessionArena::cMaxBlockSize);
+    }
+
+    BOOST_CHECK_EQUAL(arena.getStatistics().pagesCount, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(SessionArena_LargeBlocksAreCarvedFromPages)
+{
+    SessionArena arena;
+    const size_t size = SessionArena::cMaxBlockSize + 1;
+    auto block = arena.allocate(size);
+    BOOST_CHECK_EQUAL(arena.getStatistics().largeAllocationsCount, 0u);
+    BOOST_CHECK_EQUAL(arena.getStatistics().allocatedBlocksCount, 1u);
+    BOOST_CHECK_EQUAL(arena.getStatistics().pagesCount, 1u);
+
+    arena.deallocate(block, size);
+    BOOST_CHECK_EQUAL(arena.getStatistics().allocatedBlocksCount, 0u);
+
+    BOOST_CHECK(arena.allocate(size + 64) != block);
+    BOOST_CHECK_EQUAL(arena.allocate(size), block);
+}
+
+BOOST_AUTO_TEST_CASE(SessionArena_LargeAllocationsBypassPages)
+{
+    SessionArena arena;
+    const size_t size = SessionArena::cMaxLargeBlockSize + 1;
+    auto block = arena.allocate(size);
+    BOOST_CHECK_EQUAL(arena.getStatistics().largeAllocationsCount, 1u);
+    BOOST_CHECK_EQUAL(arena.getStatistics().pagesCount, 0u);
+
+    arena.deallocate(block, size);
+    BOOST_CHECK_EQUAL(arena.getStatistics().largeAllocationsCount, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(SessionArena_MessengerAndStreamsAreCarvedFromPages)
+{
+    boost::asio::io_service ioService;
+    transport::ut::TransportMock transportMock;
+    transport::ITransport::Pointer transport(&transportMock, [](auto*) {});
+    messenger::ut::CryptorMock cryptorMock;
+    messenger::ICryptor::Pointer cryptor(&cryptorMock, [](auto*) {});
+
+    // Built the same way as by the entity factory of the application.
+    auto arena = std::make_shared<SessionArena>();
+    auto messagePool(allocateShared<messenger::MessagePool>(arena, arena));
+    auto messageInStream(allocateShared<messenger::MessageInStream>(arena, ioService, transport, cryptor, std::move(messagePool)));
+    auto messageOutStream(allocateShared<messenger::MessageOutStream>(arena, ioService, transport, cryptor));
+    auto messenger(allocateShared<messenger::Messenger>(arena, ioService, std::move(messageInStream), std::move(messageOutStream)));
+
+    BOOST_CHECK_EQUAL(arena->getStatistics().largeAllocationsCount, 0u);
+    BOOST_CHECK(arena->getStatistics().allocatedBlocksCount >= 4u);
+    BOOST_CHECK(arena->getStatistics().pagesCount >= 1u);
+}
+
+BOOST_AUTO_TEST_CASE(SessionArena_SharedObjectKeepsArenaAlive)
+{
+    auto arena = std::make_shared<SessionArena>();
+    std::weak_ptr<SessionArena> weakArena(arena);
+
+    auto value = allocateShared<std::pair<int, int>>(arena, 1, 2);
+    BOOST_CHECK_EQUAL(arena->getStatistics().allocatedBlocksCount, 1u);
+    arena.reset();
+
+    BOOST_CHECK_EQUAL(value->second, 2);
+    BOOST_CHECK(!weakArena.expired());
+
+    value.reset();
+    BOOST_CHECK(weakArena.expired());
+}
+
+BOOST_AUTO_TEST_CASE(SessionArena_AllocateSharedWithoutArena)
+{
+    auto value = allocateShared<int>(nullptr, 5);
+    BOOST_CHECK_EQUAL(*value, 5);
+}
+
+BOOST_AUTO_TEST_CASE(SessionArena_ReconnectsDoNotGrowArena)
+{
+    for(size_t i = 0; i < 1000; ++i)
+    {
+        auto arena = std::make_shared<SessionArena>();
+        std::vector<std::shared_ptr<std::array<uint8_t, 200>>> objects;
+
+        for(size_t j = 0; j < 100; ++j)
+        {
+            objects.push_back(allocateShared<std::array<uint8_t, 200>>(arena));
+        }
+
+        // Objects dropped in the middle of a session are reused by the ones created later.
+        objects.erase(objects.begin(), objects.begin() + 50);
+
+        for(size_t j = 0; j < 50; ++j)
+        {
+            objects.push_back(allocateShared<std::array<uint8_t, 200>>(arena));
+        }
+
+        BOOST_REQUIRE_EQUAL(arena->getStatistics().pagesCount, 1u);
+        BOOST_REQUIRE_EQUAL(arena->getStatistics().allocatedBlocksCount, 100u);
+    }
+}
+
+}
+}
+}
+}
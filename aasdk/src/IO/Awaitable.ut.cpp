@@ -0,0 +1,161 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef AASDK_COROUTINES
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/Awaitable.hpp>
+#include <f1x/aasdk/IO/Coroutine.hpp>
+#include <f1x/aasdk/IO/PromiseLink.hpp>
+#include <f1x/aasdk/Transport/TransportAwaitables.hpp>
+#include <f1x/aasdk/Transport/UT/Transport.mock.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::SaveArg;
+
+class AwaitableUnitTest
+{
+protected:
+    AwaitableUnitTest()
+        : strand_(ioService_)
+    {
+
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+};
+
+Coroutine sum(boost::asio::io_service::strand& strand, Promise<int>::Pointer first, Promise<int>::Pointer second, int& result, bool& failed)
+{
+    try
+    {
+        result = co_await Awaitable<int>(strand, [first](Promise<int>::Pointer promise) { PromiseLink<int, int>::forward(*first, std::move(promise)); });
+        result += co_await Awaitable<int>(strand, [second](Promise<int>::Pointer promise) { PromiseLink<int, int>::forward(*second, std::move(promise)); });
+    }
+    catch(const error::Error&)
+    {
+        failed = true;
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(Awaitable_ResumesWithResolvedValues, AwaitableUnitTest)
+{
+    auto first = Promise<int>::defer(strand_);
+    auto second = Promise<int>::defer(strand_);
+    int result = 0;
+    bool failed = false;
+
+    strand_.dispatch([&]() { sum(strand_, first, second, result, failed); });
+    ioService_.run();
+    ioService_.reset();
+    BOOST_CHECK_EQUAL(result, 0);
+
+    first->resolve(2);
+    ioService_.run();
+    ioService_.reset();
+    BOOST_CHECK_EQUAL(result, 2);
+
+    second->resolve(3);
+    ioService_.run();
+
+    BOOST_CHECK_EQUAL(result, 5);
+    BOOST_CHECK(!failed);
+}
+
+BOOST_FIXTURE_TEST_CASE(Awaitable_RethrowsRejection, AwaitableUnitTest)
+{
+    auto first = Promise<int>::defer(strand_);
+    auto second = Promise<int>::defer(strand_);
+    int result = 0;
+    bool failed = false;
+
+    strand_.dispatch([&]() { sum(strand_, first, second, result, failed); });
+    ioService_.run();
+    ioService_.reset();
+
+    first->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+    ioService_.run();
+
+    BOOST_CHECK_EQUAL(result, 0);
+    BOOST_CHECK(failed);
+}
+
+Coroutine waitForever(boost::asio::io_service::strand& strand, std::shared_ptr<int> owner, Promise<void>::Pointer& pending)
+{
+    co_await Awaitable<void>(strand, [&pending](Promise<void>::Pointer promise) { pending = std::move(promise); });
+    ++*owner;
+}
+
+BOOST_FIXTURE_TEST_CASE(Awaitable_DroppedPromiseDestroysCoroutine, AwaitableUnitTest)
+{
+    auto owner = std::make_shared<int>(0);
+    Promise<void>::Pointer pending;
+
+    waitForever(strand_, owner, pending);
+    BOOST_CHECK_EQUAL(owner.use_count(), 2);
+
+    pending.reset();
+    BOOST_CHECK_EQUAL(owner.use_count(), 1);
+    BOOST_CHECK_EQUAL(*owner, 0);
+}
+
+Coroutine receiveFrame(transport::ITransport& transport, boost::asio::io_service::strand& strand, common::Data& frame)
+{
+    auto header = co_await transport::asyncReceive(transport, strand, 2);
+    auto payload = co_await transport::asyncReceive(transport, strand, header[1]);
+    frame = std::move(header);
+    frame.insert(frame.end(), payload.begin(), payload.end());
+}
+
+BOOST_FIXTURE_TEST_CASE(Awaitable_ReceivesFromTransport, AwaitableUnitTest)
+{
+    transport::ut::TransportMock transportMock;
+    transport::ITransport::ReceivePromise::Pointer headerPromise;
+    transport::ITransport::ReceivePromise::Pointer payloadPromise;
+    EXPECT_CALL(transportMock, receive(2, _)).WillOnce(SaveArg<1>(&headerPromise));
+    EXPECT_CALL(transportMock, receive(3, _)).WillOnce(SaveArg<1>(&payloadPromise));
+
+    common::Data frame;
+    receiveFrame(transportMock, strand_, frame);
+
+    headerPromise->resolve(common::Data{1, 3});
+    ioService_.run();
+    ioService_.reset();
+
+    payloadPromise->resolve(common::Data{4, 5, 6});
+    ioService_.run();
+
+    BOOST_CHECK(frame == common::Data({1, 3, 4, 5, 6}));
+}
+
+}
+}
+}
+}
+
+#endif
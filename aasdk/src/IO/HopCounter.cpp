@@ -0,0 +1,63 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/IO/HopCounter.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+HopCounter::HopCounter()
+    : postedCount_(0)
+    , inlineCount_(0)
+{
+
+}
+
+void HopCounter::addPosted()
+{
+    ++postedCount_;
+}
+
+void HopCounter::addInline()
+{
+    ++inlineCount_;
+}
+
+size_t HopCounter::getPostedCount() const
+{
+    return postedCount_;
+}
+
+size_t HopCounter::getInlineCount() const
+{
+    return inlineCount_;
+}
+
+void HopCounter::reset()
+{
+    postedCount_ = 0;
+    inlineCount_ = 0;
+}
+
+}
+}
+}
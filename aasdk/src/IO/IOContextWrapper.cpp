@@ -28,6 +28,7 @@ namespace io
 IOContextWrapper::IOContextWrapper()
     : ioService_(nullptr)
     , strand_(nullptr)
+    , hopCounter_(nullptr)
 {
 
 }
@@ -35,6 +36,7 @@ IOContextWrapper::IOContextWrapper()
 IOContextWrapper::IOContextWrapper(boost::asio::io_service& ioService)
     : ioService_(&ioService)
     , strand_(nullptr)
+    , hopCounter_(nullptr)
 {
 
 }
@@ -42,14 +44,21 @@ IOContextWrapper::IOContextWrapper(boost::asio::io_service& ioService)
 IOContextWrapper::IOContextWrapper(boost::asio::io_service::strand& strand)
     : ioService_(nullptr)
     , strand_(&strand)
+    , hopCounter_(nullptr)
 {
 
 }
 
+void IOContextWrapper::setHopCounter(HopCounter* hopCounter)
+{
+    hopCounter_ = hopCounter;
+}
+
 void IOContextWrapper::reset()
 {
     ioService_ = nullptr;
     strand_ = nullptr;
+    hopCounter_ = nullptr;
 }
 
 bool IOContextWrapper::isActive() const
@@ -57,6 +66,12 @@ bool IOContextWrapper::isActive() const
     return ioService_ != nullptr || strand_ != nullptr;
 }
 
+size_t& IOContextWrapper::getInlineDepth()
+{
+    static thread_local size_t inlineDepth = 0;
+    return inlineDepth;
+}
+
 }
 }
 }
@@ -0,0 +1,96 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/IO/ProfilerSignalHandler.hpp>
+#include <f1x/aasdk/IO/PromiseProfiler.hpp>
+#include <f1x/aasdk/IO/StallDetector.hpp>
+#include <f1x/aasdk/Common/LockProfiler.hpp>
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+ProfilerSignalHandler::ProfilerSignalHandler(boost::asio::io_service& ioService, int signalNumber, bool profilersEnabled)
+    : signalSet_(ioService, signalNumber)
+    , profilersEnabled_(profilersEnabled)
+{
+
+}
+
+void ProfilerSignalHandler::start()
+{
+    signalSet_.async_wait(StallDetector::wrap(std::bind(&ProfilerSignalHandler::signalHandler, this->shared_from_this(), std::placeholders::_1)));
+}
+
+void ProfilerSignalHandler::stop()
+{
+    boost::system::error_code error;
+    signalSet_.cancel(error);
+}
+
+void ProfilerSignalHandler::signalHandler(const boost::system::error_code& error)
+{
+    if(error)
+    {
+        return;
+    }
+
+    if(profilersEnabled_)
+    {
+        this->dumpProfilers();
+    }
+
+    if(StallDetector::getInstance().isRunning())
+    {
+        StallDetector::getInstance().dump();
+    }
+
+    common::MemoryBudget::getInstance().dump();
+
+    this->start();
+}
+
+void ProfilerSignalHandler::dumpProfilers()
+{
+    if(PromiseProfiler::isEnabled())
+    {
+        PromiseProfiler::getInstance().dump();
+    }
+    else
+    {
+        AASDK_LOG(info) << "[PromiseProfiler] not available, aasdk was built without AASDK_PROMISE_PROFILER.";
+    }
+
+    if(common::LockProfiler::isEnabled())
+    {
+        common::LockProfiler::getInstance().dump();
+    }
+    else
+    {
+        AASDK_LOG(info) << "[LockProfiler] not available, aasdk was built without AASDK_LOCK_PROFILER.";
+    }
+}
+
+}
+}
+}
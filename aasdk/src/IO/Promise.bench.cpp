@@ -0,0 +1,178 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/IO/Promise.hpp>
+
+namespace
+{
+
+std::atomic<size_t> allocationsCount(0);
+
+}
+
+void* operator new(size_t size)
+{
+    allocationsCount.fetch_add(1, std::memory_order_relaxed);
+
+    if(auto block = std::malloc(size == 0 ? 1 : size))
+    {
+        return block;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    std::free(block);
+}
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace bench
+{
+
+// Promise as it was before the pooled one: make_shared, std::function handlers and a mutex.
+template<typename ResolveArgumentType>
+class ReferencePromise: boost::noncopyable
+{
+public:
+    typedef std::function<void(ResolveArgumentType)> ResolveHandler;
+    typedef std::function<void(error::Error)> RejectHandler;
+    typedef std::shared_ptr<ReferencePromise> Pointer;
+
+    static Pointer defer(boost::asio::io_service::strand& strand)
+    {
+        return std::make_shared<ReferencePromise>(strand);
+    }
+
+    ReferencePromise(boost::asio::io_service::strand& strand)
+        : ioContextWrapper_(strand)
+    {
+
+    }
+
+    void then(ResolveHandler resolveHandler, RejectHandler rejectHandler = RejectHandler())
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+        resolveHandler_ = std::move(resolveHandler);
+        rejectHandler_ = std::move(rejectHandler);
+    }
+
+    void resolve(ResolveArgumentType argument)
+    {
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
+
+        if(resolveHandler_ != nullptr && ioContextWrapper_.isActive())
+        {
+            auto handler = [argument = std::move(argument), resolveHandler = std::move(resolveHandler_)]() mutable {
+                resolveHandler(std::move(argument));
+            };
+
+            IOContextWrapper ioContextWrapper(ioContextWrapper_);
+            ioContextWrapper_.reset();
+            rejectHandler_ = RejectHandler();
+            lock.unlock();
+
+            ioContextWrapper.execute(std::move(handler));
+        }
+    }
+
+private:
+    ResolveHandler resolveHandler_;
+    RejectHandler rejectHandler_;
+    IOContextWrapper ioContextWrapper_;
+    std::mutex mutex_;
+};
+
+static constexpr size_t cPromisesCount = 500000;
+
+// Typical continuation of the library: owner keep-alive, a member pointer and a forwarded promise.
+template<typename PromiseType>
+void measure(const std::string& name, bool resolveInPlace)
+{
+    boost::asio::io_service ioService;
+    boost::asio::io_service::strand strand(ioService);
+    auto owner(std::make_shared<int>(0));
+    size_t resolvedCount = 0;
+    size_t* counter = &resolvedCount;
+
+    const auto allocationsBefore = allocationsCount.load();
+    const auto begin = std::chrono::steady_clock::now();
+
+    strand.post([&]() {
+        for(size_t i = 0; i < cPromisesCount; ++i)
+        {
+            auto promise = PromiseType::defer(strand);
+            auto next = PromiseType::defer(strand);
+            promise->then([owner, counter, next](common::Data data) { ++*counter; (void)data; },
+                          [owner, next](const error::Error&) {});
+
+            if(resolveInPlace)
+            {
+                promise->resolve(common::Data());
+            }
+            else
+            {
+                ioService.post([promise]() { promise->resolve(common::Data()); });
+            }
+        }
+    });
+    ioService.run();
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+    const auto allocations = allocationsCount.load() - allocationsBefore;
+
+    std::cout << "[Promise] " << name << (resolveInPlace ? ", in place" : ", posted")
+              << ", ns per promise: " << elapsed / cPromisesCount
+              << ", allocations per promise: " << static_cast<double>(allocations) / cPromisesCount / 2 << std::endl;
+    BOOST_CHECK_EQUAL(resolvedCount, cPromisesCount);
+}
+
+BOOST_AUTO_TEST_CASE(Promise_ResolveLatency)
+{
+    for(auto resolveInPlace : {true, false})
+    {
+        measure<ReferencePromise<common::Data>>("reference", resolveInPlace);
+        measure<Promise<common::Data>>("pooled", resolveInPlace);
+    }
+}
+
+}
+}
+}
+}
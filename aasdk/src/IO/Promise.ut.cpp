@@ -0,0 +1,139 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/Promise.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+class PromiseUnitTest
+{
+protected:
+    PromiseUnitTest()
+        : strand_(ioService_)
+    {
+
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+};
+
+BOOST_FIXTURE_TEST_CASE(Promise_ResolveOutsideOfStrandIsPosted, PromiseUnitTest)
+{
+    int resolvedValue = 0;
+    auto promise = Promise<int>::defer(strand_);
+    promise->then([&resolvedValue](int value) { resolvedValue = value; });
+
+    promise->resolve(5);
+    BOOST_CHECK_EQUAL(resolvedValue, 0);
+
+    ioService_.run();
+    BOOST_CHECK_EQUAL(resolvedValue, 5);
+}
+
+BOOST_FIXTURE_TEST_CASE(Promise_ResolveOnOwnStrandIsExecutedInPlace, PromiseUnitTest)
+{
+    int resolvedValue = 0;
+    bool resolvedInPlace = false;
+    auto promise = Promise<int>::defer(strand_);
+    promise->then([&resolvedValue](int value) { resolvedValue = value; });
+
+    strand_.post([&]() {
+        promise->resolve(7);
+        resolvedInPlace = (resolvedValue == 7);
+    });
+
+    ioService_.run();
+    BOOST_CHECK(resolvedInPlace);
+}
+
+BOOST_FIXTURE_TEST_CASE(Promise_RejectOnOtherStrandIsPosted, PromiseUnitTest)
+{
+    boost::asio::io_service::strand otherStrand(ioService_);
+    bool rejected = false;
+    bool rejectedInPlace = true;
+    auto promise = Promise<void>::defer(strand_);
+    promise->then([]() {}, [&rejected](const error::Error&) { rejected = true; });
+
+    otherStrand.post([&]() {
+        promise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+        rejectedInPlace = rejected;
+    });
+
+    ioService_.run();
+    BOOST_CHECK(rejected);
+    BOOST_CHECK(!rejectedInPlace);
+}
+
+
+BOOST_FIXTURE_TEST_CASE(Promise_SettledOnlyOnce, PromiseUnitTest)
+{
+    int resolvedCount = 0;
+    int rejectedCount = 0;
+    auto promise = Promise<int>::defer(ioService_);
+    promise->then([&resolvedCount](int) { ++resolvedCount; }, [&rejectedCount](const error::Error&) { ++rejectedCount; });
+
+    promise->resolve(1);
+    promise->resolve(2);
+    promise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+    promise->then([&resolvedCount](int) { ++resolvedCount; });
+
+    ioService_.run();
+    BOOST_CHECK_EQUAL(resolvedCount, 1);
+    BOOST_CHECK_EQUAL(rejectedCount, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(Promise_HandlersReleasedWhenSettled, PromiseUnitTest)
+{
+    auto captured = std::make_shared<int>(0);
+    auto promise = Promise<void>::defer(ioService_);
+    promise->then([captured]() {}, [captured](const error::Error&) {});
+    BOOST_CHECK_EQUAL(captured.use_count(), 3);
+
+    promise->resolve();
+    ioService_.run();
+    BOOST_CHECK_EQUAL(captured.use_count(), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(Promise_StorageIsReused, PromiseUnitTest)
+{
+    Promise<void>::defer(strand_);
+    const auto before = PromisePool::getStatistics();
+
+    for(size_t i = 0; i < 10; ++i)
+    {
+        Promise<void>::defer(strand_);
+    }
+
+    const auto after = PromisePool::getStatistics();
+    BOOST_CHECK_EQUAL(after.hits - before.hits, 10);
+    BOOST_CHECK_EQUAL(after.misses, before.misses);
+}
+
+}
+}
+}
+}
@@ -0,0 +1,96 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <array>
+#include <memory>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/PromiseHandler.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(PromiseHandler_EmptyByDefault)
+{
+    PromiseHandler<void(int)> handler;
+    BOOST_CHECK(handler == nullptr);
+    BOOST_CHECK(!handler);
+
+    handler = [](int) {};
+    BOOST_CHECK(handler != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(PromiseHandler_SmallFunctorStoredInPlace)
+{
+    auto captured = std::make_shared<int>(0);
+    auto functor = [captured](int value) { *captured += value; };
+    BOOST_CHECK(PromiseHandler<void(int)>::isStoredInPlace<decltype(functor)>());
+
+    PromiseHandler<void(int)> handler(functor);
+    PromiseHandler<void(int)> copy(handler);
+    PromiseHandler<void(int)> moved(std::move(handler));
+    BOOST_CHECK(handler == nullptr);
+    BOOST_CHECK_EQUAL(captured.use_count(), 4);
+
+    copy(2);
+    moved(3);
+    BOOST_CHECK_EQUAL(*captured, 5);
+
+    copy = nullptr;
+    moved = PromiseHandler<void(int)>();
+    BOOST_CHECK_EQUAL(captured.use_count(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(PromiseHandler_LargeFunctorStoredOnHeap)
+{
+    auto captured = std::make_shared<int>(0);
+    std::array<int, 32> padding{};
+    auto functor = [captured, padding](int value) { *captured += value + padding[0]; };
+    BOOST_CHECK(!PromiseHandler<void(int)>::isStoredInPlace<decltype(functor)>());
+
+    PromiseHandler<void(int)> handler(functor);
+    PromiseHandler<void(int)> copy;
+    copy = handler;
+    PromiseHandler<void(int)> moved;
+    moved = std::move(handler);
+
+    copy(2);
+    moved(3);
+    BOOST_CHECK_EQUAL(*captured, 5);
+    BOOST_CHECK_EQUAL(captured.use_count(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(PromiseHandler_TypeNameOfStoredFunctor)
+{
+    auto functor = [](int) {};
+    PromiseHandler<void(int)> handler;
+    BOOST_CHECK(handler.getTypeName() == nullptr);
+
+    handler = functor;
+    BOOST_CHECK_EQUAL(handler.getTypeName(), typeid(functor).name());
+}
+
+}
+}
+}
+}
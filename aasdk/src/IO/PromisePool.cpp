@@ -0,0 +1,122 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <new>
+#include <f1x/aasdk/IO/PromisePool.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+namespace
+{
+
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+// Trivially destructible so that blocks released after the thread's pool was torn down can still tell.
+struct FreeList
+{
+    FreeBlock* head;
+    size_t count;
+    size_t hits;
+    size_t misses;
+    bool closed;
+};
+
+thread_local FreeList freeList = {nullptr, 0, 0, 0, false};
+
+struct FreeListReclaimer
+{
+    ~FreeListReclaimer()
+    {
+        freeList.closed = true;
+
+        while(freeList.head != nullptr)
+        {
+            auto block = freeList.head;
+            freeList.head = block->next;
+            ::operator delete(block);
+        }
+
+        freeList.count = 0;
+    }
+};
+
+FreeList& getFreeList()
+{
+    static thread_local FreeListReclaimer reclaimer;
+    (void)reclaimer;
+    return freeList;
+}
+
+}
+
+void* PromisePool::allocate(size_t size)
+{
+    if(size > cBlockSize)
+    {
+        return ::operator new(size);
+    }
+
+    auto& list = getFreeList();
+
+    if(list.head != nullptr)
+    {
+        auto block = list.head;
+        list.head = block->next;
+        --list.count;
+        ++list.hits;
+        return block;
+    }
+
+    ++list.misses;
+    return ::operator new(cBlockSize);
+}
+
+void PromisePool::deallocate(void* block, size_t size)
+{
+    if(size <= cBlockSize && !freeList.closed)
+    {
+        auto& list = getFreeList();
+
+        if(list.count < cMaxFreeBlocks)
+        {
+            list.head = new(block) FreeBlock{list.head};
+            ++list.count;
+            return;
+        }
+    }
+
+    ::operator delete(block);
+}
+
+PromisePool::Statistics PromisePool::getStatistics()
+{
+    const auto& list = getFreeList();
+    return Statistics{list.hits, list.misses, list.count};
+}
+
+}
+}
+}
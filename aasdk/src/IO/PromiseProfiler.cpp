@@ -0,0 +1,262 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+#include <f1x/aasdk/IO/PromiseProfiler.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+#ifdef AASDK_PROMISE_PROFILER
+PromiseSite::PromiseSite(const char* _file, int _line)
+    : file(_file)
+    , line(_line)
+{
+
+}
+#endif
+
+PromiseProfiler::Record::Record()
+    : file_(nullptr)
+    , line_(0)
+    , pending_(false)
+    , previous_(nullptr)
+    , next_(nullptr)
+{
+
+}
+
+PromiseProfiler::Record::~Record()
+{
+    if(file_ != nullptr)
+    {
+        PromiseProfiler::getInstance().destroy(*this);
+    }
+}
+
+void PromiseProfiler::Record::start(const PromiseSite& site)
+{
+#ifdef AASDK_PROMISE_PROFILER
+    file_ = site.file;
+    line_ = site.line;
+    PromiseProfiler::getInstance().start(*this);
+#endif
+}
+
+void PromiseProfiler::Record::resolve()
+{
+    if(file_ != nullptr)
+    {
+        PromiseProfiler::getInstance().settle(*this, true);
+    }
+}
+
+void PromiseProfiler::Record::reject()
+{
+    if(file_ != nullptr)
+    {
+        PromiseProfiler::getInstance().settle(*this, false);
+    }
+}
+
+PromiseProfiler::PromiseProfiler()
+    : pendingRecords_(nullptr)
+{
+
+}
+
+PromiseProfiler& PromiseProfiler::getInstance()
+{
+    // Never destroyed, promises may outlive static objects.
+    static auto instance = new PromiseProfiler();
+    return *instance;
+}
+
+void PromiseProfiler::start(Record& record)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    record.createdAt_ = Clock::now();
+    record.pending_ = true;
+    record.next_ = pendingRecords_;
+
+    if(pendingRecords_ != nullptr)
+    {
+        pendingRecords_->previous_ = &record;
+    }
+
+    pendingRecords_ = &record;
+
+    auto& statistics = this->getSiteStatistics(record);
+    ++statistics.createdCount;
+    ++statistics.pendingCount;
+}
+
+void PromiseProfiler::settle(Record& record, bool resolved)
+{
+    const auto settledAt = Clock::now();
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    if(record.pending_)
+    {
+        this->unlink(record);
+
+        auto& statistics = this->getSiteStatistics(record);
+        const auto settleTime = settledAt - record.createdAt_;
+        --statistics.pendingCount;
+        ++(resolved ? statistics.resolvedCount : statistics.rejectedCount);
+        statistics.totalSettleTime += settleTime;
+        statistics.maxSettleTime = std::max(statistics.maxSettleTime, settleTime);
+    }
+}
+
+void PromiseProfiler::destroy(Record& record)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    if(record.pending_)
+    {
+        this->unlink(record);
+
+        auto& statistics = this->getSiteStatistics(record);
+        --statistics.pendingCount;
+        ++statistics.destroyedPendingCount;
+    }
+}
+
+void PromiseProfiler::unlink(Record& record)
+{
+    if(record.previous_ != nullptr)
+    {
+        record.previous_->next_ = record.next_;
+    }
+    else
+    {
+        pendingRecords_ = record.next_;
+    }
+
+    if(record.next_ != nullptr)
+    {
+        record.next_->previous_ = record.previous_;
+    }
+
+    record.previous_ = nullptr;
+    record.next_ = nullptr;
+    record.pending_ = false;
+}
+
+PromiseProfiler::Statistics& PromiseProfiler::getSiteStatistics(const Record& record)
+{
+    auto& statistics = statistics_[std::make_pair(record.file_, record.line_)];
+
+    if(statistics.file == nullptr)
+    {
+        statistics.file = record.file_;
+        statistics.line = record.line_;
+    }
+
+    return statistics;
+}
+
+std::vector<PromiseProfiler::Statistics> PromiseProfiler::getStatistics() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    std::vector<Statistics> statistics;
+    statistics.reserve(statistics_.size());
+
+    for(const auto& entry : statistics_)
+    {
+        statistics.push_back(entry.second);
+    }
+
+    return statistics;
+}
+
+std::vector<PromiseProfiler::PendingPromise> PromiseProfiler::getPendingPromises() const
+{
+    const auto now = Clock::now();
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    std::vector<PendingPromise> pendingPromises;
+
+    for(auto record = pendingRecords_; record != nullptr; record = record->next_)
+    {
+        pendingPromises.push_back(PendingPromise{record->file_, record->line_, now - record->createdAt_});
+    }
+
+    return pendingPromises;
+}
+
+void PromiseProfiler::dump() const
+{
+    for(const auto& statistics : this->getStatistics())
+    {
+        const auto settledCount = statistics.resolvedCount + statistics.rejectedCount;
+
+        AASDK_LOG(info) << "[PromiseProfiler] " << statistics.file << ":" << statistics.line
+                        << ", created: " << statistics.createdCount
+                        << ", resolved: " << statistics.resolvedCount
+                        << ", rejected: " << statistics.rejectedCount
+                        << ", destroyed pending: " << statistics.destroyedPendingCount
+                        << ", pending: " << statistics.pendingCount
+                        << ", avg settle us: " << (settledCount > 0 ? std::chrono::duration_cast<std::chrono::microseconds>(statistics.totalSettleTime).count() / settledCount : 0)
+                        << ", max settle us: " << std::chrono::duration_cast<std::chrono::microseconds>(statistics.maxSettleTime).count();
+    }
+
+    for(const auto& pendingPromise : this->getPendingPromises())
+    {
+        AASDK_LOG(info) << "[PromiseProfiler] pending " << pendingPromise.file << ":" << pendingPromise.line
+                        << " for " << std::chrono::duration_cast<std::chrono::milliseconds>(pendingPromise.age).count() << " ms";
+    }
+}
+
+void PromiseProfiler::reset()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    for(auto& entry : statistics_)
+    {
+        const auto pendingCount = entry.second.pendingCount;
+        entry.second = Statistics{entry.second.file, entry.second.line, 0, 0, 0, 0, pendingCount, Clock::duration::zero(), Clock::duration::zero()};
+    }
+}
+
+bool PromiseProfiler::isEnabled()
+{
+#ifdef AASDK_PROMISE_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool PromiseProfiler::SiteCompare::operator()(const std::pair<const char*, int>& lhs, const std::pair<const char*, int>& rhs) const
+{
+    const auto result = std::strcmp(lhs.first, rhs.first);
+    return result < 0 || (result == 0 && lhs.second < rhs.second);
+}
+
+}
+}
+}
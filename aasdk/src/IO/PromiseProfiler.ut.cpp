@@ -0,0 +1,89 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef AASDK_PROMISE_PROFILER
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/Promise.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+static const PromiseProfiler::Statistics* findStatistics(const std::vector<PromiseProfiler::Statistics>& statistics, int line)
+{
+    for(const auto& entry : statistics)
+    {
+        if(entry.line == line && std::string(entry.file) == __FILE__)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+BOOST_AUTO_TEST_CASE(PromiseProfiler_RecordsSettledAndDroppedPromises)
+{
+    boost::asio::io_service ioService;
+    PromiseProfiler::getInstance().reset();
+
+    std::vector<Promise<void>::Pointer> promises;
+    const int line = __LINE__ + 3;
+    for(size_t i = 0; i < 4; ++i)
+    {
+        promises.push_back(Promise<void>::defer(ioService));
+    }
+
+    promises[0]->resolve();
+    promises[1]->resolve();
+    promises[2]->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+
+    auto statistics = findStatistics(PromiseProfiler::getInstance().getStatistics(), line);
+    BOOST_REQUIRE(statistics != nullptr);
+    BOOST_CHECK_EQUAL(statistics->createdCount, 4);
+    BOOST_CHECK_EQUAL(statistics->resolvedCount, 2);
+    BOOST_CHECK_EQUAL(statistics->rejectedCount, 1);
+    BOOST_CHECK_EQUAL(statistics->pendingCount, 1);
+
+    bool pendingListed = false;
+    for(const auto& pendingPromise : PromiseProfiler::getInstance().getPendingPromises())
+    {
+        pendingListed |= pendingPromise.line == line;
+    }
+    BOOST_CHECK(pendingListed);
+
+    promises.clear();
+
+    statistics = findStatistics(PromiseProfiler::getInstance().getStatistics(), line);
+    BOOST_REQUIRE(statistics != nullptr);
+    BOOST_CHECK_EQUAL(statistics->destroyedPendingCount, 1);
+    BOOST_CHECK_EQUAL(statistics->pendingCount, 0);
+}
+
+}
+}
+}
+}
+
+#endif
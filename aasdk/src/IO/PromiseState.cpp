@@ -0,0 +1,91 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <thread>
+#include <f1x/aasdk/IO/PromiseState.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+PromiseState::PromiseState()
+    : state_(PENDING)
+{
+
+}
+
+bool PromiseState::beginThen()
+{
+    auto state = state_.load(std::memory_order_acquire);
+
+    while(true)
+    {
+        if(state == SETTLED)
+        {
+            return false;
+        }
+        else if(state == THEN_IN_PROGRESS)
+        {
+            std::this_thread::yield();
+            state = state_.load(std::memory_order_acquire);
+        }
+        else if(state_.compare_exchange_weak(state, THEN_IN_PROGRESS, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return true;
+        }
+    }
+}
+
+void PromiseState::endThen()
+{
+    state_.store(HANDLERS_SET, std::memory_order_release);
+}
+
+bool PromiseState::settle()
+{
+    auto state = state_.load(std::memory_order_acquire);
+
+    while(true)
+    {
+        if(state == SETTLED)
+        {
+            return false;
+        }
+        else if(state == THEN_IN_PROGRESS)
+        {
+            std::this_thread::yield();
+            state = state_.load(std::memory_order_acquire);
+        }
+        else if(state_.compare_exchange_weak(state, SETTLED, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return state == HANDLERS_SET;
+        }
+    }
+}
+
+bool PromiseState::isSettled() const
+{
+    return state_.load(std::memory_order_acquire) == SETTLED;
+}
+
+}
+}
+}
@@ -0,0 +1,259 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <boost/core/demangle.hpp>
+#include <f1x/aasdk/IO/StallDetector.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+constexpr std::array<uint32_t, StallDetector::cBucketsCount - 1> StallDetector::cBucketBounds;
+
+StallDetector::Scope::Scope(const char* tag)
+    : tag_(tag)
+    , slot_(nullptr)
+    , active_(false)
+{
+    if(StallDetector::getInstance().running_.load(std::memory_order_relaxed))
+    {
+        slot_ = &StallDetector::getThreadSlot();
+
+        if(slot_->depth++ == 0)
+        {
+            active_ = true;
+            begin_ = Clock::now();
+            slot_->tag.store(tag_, std::memory_order_relaxed);
+            slot_->startTime.store(begin_.time_since_epoch().count(), std::memory_order_release);
+        }
+    }
+}
+
+StallDetector::Scope::~Scope()
+{
+    if(slot_ != nullptr)
+    {
+        --slot_->depth;
+
+        if(active_)
+        {
+            const auto duration = Clock::now() - begin_;
+            slot_->startTime.store(0, std::memory_order_release);
+            StallDetector::getInstance().finish(tag_, duration);
+        }
+    }
+}
+
+StallDetector::ThreadSlot::ThreadSlot()
+    : startTime(0)
+    , tag(nullptr)
+    , reportedStartTime(0)
+    , depth(0)
+    , threadId(std::this_thread::get_id())
+{
+    StallDetector::getInstance().registerSlot(*this);
+}
+
+StallDetector::ThreadSlot::~ThreadSlot()
+{
+    StallDetector::getInstance().unregisterSlot(*this);
+}
+
+StallDetector::StallDetector()
+    : running_(false)
+    , threshold_(0)
+    , samplingInterval_(0)
+{
+    this->reset();
+}
+
+StallDetector& StallDetector::getInstance()
+{
+    // Never destroyed, io_service threads may outlive static objects.
+    static auto instance = new StallDetector();
+    return *instance;
+}
+
+void StallDetector::start(Clock::duration threshold, Clock::duration samplingInterval)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    if(running_)
+    {
+        return;
+    }
+
+    threshold_ = threshold.count();
+    samplingInterval_ = samplingInterval;
+    running_ = true;
+
+    sampler_ = std::thread([this]() {
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
+
+        while(running_)
+        {
+            samplerCondition_.wait_for(lock, samplingInterval_);
+
+            if(running_)
+            {
+                this->sample();
+            }
+        }
+    });
+}
+
+void StallDetector::stop()
+{
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        running_ = false;
+    }
+
+    samplerCondition_.notify_all();
+
+    if(sampler_.joinable())
+    {
+        sampler_.join();
+    }
+}
+
+bool StallDetector::isRunning() const
+{
+    return running_;
+}
+
+StallDetector::ThreadSlot& StallDetector::getThreadSlot()
+{
+    static thread_local ThreadSlot slot;
+    return slot;
+}
+
+void StallDetector::registerSlot(ThreadSlot& slot)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    slots_.push_back(&slot);
+}
+
+void StallDetector::unregisterSlot(ThreadSlot& slot)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    slots_.erase(std::remove(slots_.begin(), slots_.end(), &slot), slots_.end());
+}
+
+void StallDetector::finish(const char* tag, Clock::duration duration)
+{
+    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+    const auto bucket = std::upper_bound(cBucketBounds.begin(), cBucketBounds.end(), milliseconds,
+                                         [](std::chrono::milliseconds::rep value, uint32_t bound) { return value < bound; });
+
+    histogram_[std::distance(cBucketBounds.begin(), bucket)].fetch_add(1, std::memory_order_relaxed);
+    handlersCount_.fetch_add(1, std::memory_order_relaxed);
+
+    auto maxDuration = maxDuration_.load(std::memory_order_relaxed);
+    while(duration.count() > maxDuration && !maxDuration_.compare_exchange_weak(maxDuration, duration.count(), std::memory_order_relaxed));
+
+    if(duration.count() > threshold_.load(std::memory_order_relaxed))
+    {
+        stallsCount_.fetch_add(1, std::memory_order_relaxed);
+        AASDK_LOG(warning) << "[StallDetector] handler " << boost::core::demangle(tag) << " took " << milliseconds << " ms.";
+    }
+}
+
+void StallDetector::sample()
+{
+    const auto now = Clock::now().time_since_epoch().count();
+    const auto threshold = threshold_.load(std::memory_order_relaxed);
+
+    for(auto slot : slots_)
+    {
+        const auto startTime = slot->startTime.load(std::memory_order_acquire);
+
+        if(startTime != 0 && now - startTime > threshold && slot->reportedStartTime != startTime)
+        {
+            const auto tag = slot->tag.load(std::memory_order_relaxed);
+
+            // The handler finished in the meantime, the tag may already belong to the next one.
+            if(slot->startTime.load(std::memory_order_acquire) != startTime)
+            {
+                continue;
+            }
+
+            slot->reportedStartTime = startTime;
+            ongoingStallsCount_.fetch_add(1, std::memory_order_relaxed);
+
+            AASDK_LOG(warning) << "[StallDetector] handler " << boost::core::demangle(tag) << " is running for "
+                               << std::chrono::duration_cast<std::chrono::milliseconds>(Clock::duration(now - startTime)).count()
+                               << " ms on thread " << slot->threadId << ".";
+        }
+    }
+}
+
+StallDetector::Statistics StallDetector::getStatistics() const
+{
+    Statistics statistics;
+
+    for(size_t i = 0; i < cBucketsCount; ++i)
+    {
+        statistics.histogram[i] = histogram_[i].load(std::memory_order_relaxed);
+    }
+
+    statistics.handlersCount = handlersCount_.load(std::memory_order_relaxed);
+    statistics.stallsCount = stallsCount_.load(std::memory_order_relaxed);
+    statistics.ongoingStallsCount = ongoingStallsCount_.load(std::memory_order_relaxed);
+    statistics.maxDuration = Clock::duration(maxDuration_.load(std::memory_order_relaxed));
+
+    return statistics;
+}
+
+void StallDetector::dump() const
+{
+    const auto statistics = this->getStatistics();
+
+    AASDK_LOG(info) << "[StallDetector] handlers: " << statistics.handlersCount
+                    << ", stalls: " << statistics.stallsCount
+                    << ", reported while running: " << statistics.ongoingStallsCount
+                    << ", max: " << std::chrono::duration_cast<std::chrono::microseconds>(statistics.maxDuration).count() << " us";
+
+    for(size_t i = 0; i < cBucketsCount; ++i)
+    {
+        AASDK_LOG(info) << "[StallDetector] " << (i < cBucketBounds.size() ? "< " : ">= ")
+                        << cBucketBounds[std::min(i, cBucketBounds.size() - 1)] << " ms: " << statistics.histogram[i];
+    }
+}
+
+void StallDetector::reset()
+{
+    for(auto& bucket : histogram_)
+    {
+        bucket = 0;
+    }
+
+    handlersCount_ = 0;
+    stallsCount_ = 0;
+    ongoingStallsCount_ = 0;
+    maxDuration_ = 0;
+}
+
+}
+}
+}
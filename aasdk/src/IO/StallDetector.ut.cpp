@@ -0,0 +1,163 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <thread>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/IOContextWrapper.hpp>
+#include <f1x/aasdk/IO/StallDetector.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
+#include <f1x/aasdk/Messenger/ChannelSubscription.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+class StallDetectorUnitTest
+{
+protected:
+    StallDetectorUnitTest()
+        : stallDetector_(StallDetector::getInstance())
+    {
+        stallDetector_.reset();
+    }
+
+    ~StallDetectorUnitTest()
+    {
+        stallDetector_.stop();
+        stallDetector_.reset();
+    }
+
+    boost::asio::io_service ioService_;
+    StallDetector& stallDetector_;
+};
+
+BOOST_FIXTURE_TEST_CASE(StallDetector_MeasuresPostedHandlers, StallDetectorUnitTest)
+{
+    stallDetector_.start(std::chrono::milliseconds(20), std::chrono::seconds(10));
+
+    IOContextWrapper ioContextWrapper(ioService_);
+    ioContextWrapper.post([]() {});
+    ioContextWrapper.post([]() { std::this_thread::sleep_for(std::chrono::milliseconds(30)); }, "slow");
+    ioService_.run();
+
+    const auto statistics = stallDetector_.getStatistics();
+    BOOST_CHECK_EQUAL(statistics.handlersCount, 2);
+    BOOST_CHECK_EQUAL(statistics.stallsCount, 1);
+    BOOST_CHECK_EQUAL(statistics.histogram[0], 1);
+    BOOST_CHECK_EQUAL(statistics.histogram[3], 1);
+    BOOST_CHECK(statistics.maxDuration >= std::chrono::milliseconds(30));
+}
+
+BOOST_FIXTURE_TEST_CASE(StallDetector_MeasuresSubscriptionDelivery, StallDetectorUnitTest)
+{
+    stallDetector_.start(std::chrono::milliseconds(20), std::chrono::seconds(10));
+
+    boost::asio::io_service::strand strand(ioService_);
+    auto subscription = std::make_shared<messenger::ChannelSubscription>(strand,
+                                                                         [](messenger::Message::Pointer) { std::this_thread::sleep_for(std::chrono::milliseconds(30)); },
+                                                                         [](const error::Error&) {});
+    subscription->push(std::make_shared<messenger::Message>(messenger::ChannelId::VIDEO, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC),
+                       1, messenger::ReceiveQueuePolicy::UNBOUNDED);
+    ioService_.run();
+
+    const auto statistics = stallDetector_.getStatistics();
+    BOOST_CHECK_EQUAL(statistics.handlersCount, 1);
+    BOOST_CHECK_EQUAL(statistics.stallsCount, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(StallDetector_MeasuresStrandHandlers, StallDetectorUnitTest)
+{
+    stallDetector_.start(std::chrono::milliseconds(20), std::chrono::seconds(10));
+
+    Strand strand(ioService_);
+    strand.post([]() {});
+    strand.dispatch([]() { std::this_thread::sleep_for(std::chrono::milliseconds(30)); });
+    ioService_.run();
+
+    const auto statistics = stallDetector_.getStatistics();
+    BOOST_CHECK_EQUAL(statistics.handlersCount, 2);
+    BOOST_CHECK_EQUAL(statistics.stallsCount, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(StallDetector_MeasuresCompletionHandlers, StallDetectorUnitTest)
+{
+    stallDetector_.start(std::chrono::milliseconds(20), std::chrono::seconds(10));
+
+    Strand strand(ioService_);
+    boost::asio::deadline_timer timer(ioService_, boost::posix_time::milliseconds(1));
+    boost::system::error_code timerError(boost::asio::error::operation_aborted);
+    bool runningInStrand = false;
+
+    timer.async_wait(strand.wrap([&](const boost::system::error_code& e) {
+        timerError = e;
+        runningInStrand = strand.running_in_this_thread();
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    }));
+    ioService_.run();
+
+    BOOST_CHECK(!timerError);
+    BOOST_CHECK(runningInStrand);
+
+    const auto statistics = stallDetector_.getStatistics();
+    BOOST_CHECK_EQUAL(statistics.handlersCount, 1);
+    BOOST_CHECK_EQUAL(statistics.stallsCount, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(StallDetector_ReportsRunningHandler, StallDetectorUnitTest)
+{
+    stallDetector_.start(std::chrono::milliseconds(10), std::chrono::milliseconds(5));
+
+    IOContextWrapper ioContextWrapper(ioService_);
+    ioContextWrapper.post([]() { std::this_thread::sleep_for(std::chrono::milliseconds(100)); }, "stuck");
+    ioService_.run();
+
+    const auto statistics = stallDetector_.getStatistics();
+    BOOST_CHECK_EQUAL(statistics.ongoingStallsCount, 1);
+    BOOST_CHECK_EQUAL(statistics.stallsCount, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(StallDetector_NestedHandlersAccountedToOutermost, StallDetectorUnitTest)
+{
+    stallDetector_.start(std::chrono::seconds(1), std::chrono::seconds(10));
+
+    {
+        StallDetector::Scope outer("outer");
+        StallDetector::Scope inner("inner");
+    }
+
+    BOOST_CHECK_EQUAL(stallDetector_.getStatistics().handlersCount, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(StallDetector_NothingRecordedWhenStopped, StallDetectorUnitTest)
+{
+    IOContextWrapper ioContextWrapper(ioService_);
+    ioContextWrapper.post([]() {});
+    ioService_.run();
+
+    BOOST_CHECK_EQUAL(stallDetector_.getStatistics().handlersCount, 0);
+}
+
+}
+}
+}
+}
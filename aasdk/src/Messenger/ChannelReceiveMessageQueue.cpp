@@ -25,41 +25,145 @@ namespace aasdk
 namespace messenger
 {
 
+ChannelReceiveMessageQueue::ChannelQueue::ChannelQueue()
+    : capacity(cDefaultCapacity)
+    , policy(ReceiveQueuePolicy::UNBOUNDED)
+    , size(0)
+    , dropped(0)
+{
+
+}
+
+ChannelReceiveMessageQueue::ChannelReceiveMessageQueue()
+    : blockedChannelsCount_(0)
+{
+
+}
+
+void ChannelReceiveMessageQueue::setPolicy(ChannelId channelId, size_t capacity, ReceiveQueuePolicy policy)
+{
+    auto& channelQueue = this->getChannelQueue(channelId);
+    const bool wasBlocking = this->isFull(channelQueue) && channelQueue.policy == ReceiveQueuePolicy::BLOCK;
+
+    channelQueue.capacity = capacity > 0 ? capacity : 1;
+    channelQueue.policy = policy;
+
+    while((channelQueue.policy == ReceiveQueuePolicy::DROP_OLDEST || channelQueue.policy == ReceiveQueuePolicy::DROP_NEWEST)
+          && channelQueue.messages.size() > channelQueue.capacity)
+    {
+        channelQueue.messages.pop_front();
+        ++channelQueue.dropped;
+    }
+
+    channelQueue.size = channelQueue.messages.size();
+    const bool isBlocking = this->isFull(channelQueue) && channelQueue.policy == ReceiveQueuePolicy::BLOCK;
+    blockedChannelsCount_ += isBlocking ? 1 : 0;
+    blockedChannelsCount_ -= wasBlocking ? 1 : 0;
+}
+
 void ChannelReceiveMessageQueue::push(Message::Pointer message)
 {
-    const auto channelId = message->getChannelId();
+    auto& channelQueue = this->getChannelQueue(message->getChannelId());
 
-    if(queue_.count(channelId) == 0)
+    if(this->isFull(channelQueue))
     {
-        queue_.emplace(std::make_pair(channelId, MessageQueue()));
+        switch(channelQueue.policy)
+        {
+        case ReceiveQueuePolicy::DROP_OLDEST:
+            channelQueue.messages.pop_front();
+            ++channelQueue.dropped;
+            break;
+
+        case ReceiveQueuePolicy::DROP_NEWEST:
+            ++channelQueue.dropped;
+            return;
+
+        default:
+            // Backpressure: the messenger stops reading from the transport while a blocking queue is full,
+            // so the queue can only exceed its capacity by the message which was already in flight.
+            break;
+        }
     }
 
-    auto& channelQueue = queue_.at(channelId);
-    channelQueue.emplace(std::move(message));
+    channelQueue.messages.emplace_back(std::move(message));
+    channelQueue.size = channelQueue.messages.size();
+
+    if(channelQueue.policy == ReceiveQueuePolicy::BLOCK && channelQueue.messages.size() == channelQueue.capacity)
+    {
+        ++blockedChannelsCount_;
+    }
 }
 
 Message::Pointer ChannelReceiveMessageQueue::pop(ChannelId channelId)
 {
-    auto& channelQueue = queue_.at(channelId);
-    auto message(std::move(channelQueue.front()));
-    channelQueue.pop();
+    auto& channelQueue = this->getChannelQueue(channelId);
 
-    if(channelQueue.empty())
+    if(channelQueue.policy == ReceiveQueuePolicy::BLOCK && channelQueue.messages.size() == channelQueue.capacity)
     {
-        queue_.erase(channelId);
+        --blockedChannelsCount_;
     }
 
+    auto message(std::move(channelQueue.messages.front()));
+    channelQueue.messages.pop_front();
+    channelQueue.size = channelQueue.messages.size();
+
     return message;
 }
 
 bool ChannelReceiveMessageQueue::empty(ChannelId channelId) const
 {
-    return queue_.count(channelId) == 0;
+    return this->getChannelQueue(channelId).messages.empty();
+}
+
+bool ChannelReceiveMessageQueue::isBlocked() const
+{
+    return blockedChannelsCount_ > 0;
+}
+
+size_t ChannelReceiveMessageQueue::getSize(ChannelId channelId) const
+{
+    return this->getChannelQueue(channelId).size;
+}
+
+size_t ChannelReceiveMessageQueue::getCapacity(ChannelId channelId) const
+{
+    return this->getChannelQueue(channelId).capacity;
+}
+
+ReceiveQueuePolicy ChannelReceiveMessageQueue::getPolicy(ChannelId channelId) const
+{
+    return this->getChannelQueue(channelId).policy;
+}
+
+size_t ChannelReceiveMessageQueue::getDroppedCount(ChannelId channelId) const
+{
+    return this->getChannelQueue(channelId).dropped;
 }
 
 void ChannelReceiveMessageQueue::clear()
 {
-    queue_.clear();
+    for(auto& channelQueue : queue_)
+    {
+        channelQueue.messages.clear();
+        channelQueue.size = 0;
+    }
+
+    blockedChannelsCount_ = 0;
+}
+
+ChannelReceiveMessageQueue::ChannelQueue& ChannelReceiveMessageQueue::getChannelQueue(ChannelId channelId)
+{
+    return queue_[static_cast<uint8_t>(channelId)];
+}
+
+const ChannelReceiveMessageQueue::ChannelQueue& ChannelReceiveMessageQueue::getChannelQueue(ChannelId channelId) const
+{
+    return queue_[static_cast<uint8_t>(channelId)];
+}
+
+bool ChannelReceiveMessageQueue::isFull(const ChannelQueue& channelQueue) const
+{
+    return channelQueue.policy != ReceiveQueuePolicy::UNBOUNDED && channelQueue.messages.size() >= channelQueue.capacity;
 }
 
 }
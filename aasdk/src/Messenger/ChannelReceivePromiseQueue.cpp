@@ -25,33 +25,36 @@ namespace aasdk
 namespace messenger
 {
 
+ChannelReceivePromiseQueue::ChannelReceivePromiseQueue()
+    : size_(0)
+{
+
+}
+
 void ChannelReceivePromiseQueue::push(ChannelId channelId, ReceivePromise::Pointer promise)
 {
-    queue_[channelId].push(std::move(promise));
+    queue_[static_cast<size_t>(channelId)].emplace_back(std::move(promise));
+    ++size_;
 }
 
 ReceivePromise::Pointer ChannelReceivePromiseQueue::pop(ChannelId channelId)
 {
-    auto& channelQueue = queue_.at(channelId);
+    auto& channelQueue = queue_.at(static_cast<size_t>(channelId));
     auto promise = std::move(channelQueue.front());
-    channelQueue.pop();
-
-    if(channelQueue.empty())
-    {
-        queue_.erase(channelId);
-    }
+    channelQueue.pop_front();
+    --size_;
 
     return promise;
 }
 
 bool ChannelReceivePromiseQueue::isPending(ChannelId channelId) const
 {
-    return queue_.count(channelId) > 0 && !queue_.at(channelId).empty();
+    return !queue_[static_cast<size_t>(channelId)].empty();
 }
 
 size_t ChannelReceivePromiseQueue::size() const
 {
-    return queue_.size();
+    return size_;
 }
 
 bool ChannelReceivePromiseQueue::empty() const
@@ -61,12 +64,25 @@ bool ChannelReceivePromiseQueue::empty() const
 
 void ChannelReceivePromiseQueue::clear()
 {
-    queue_.clear();
+    for(auto& channelQueue : queue_)
+    {
+        channelQueue.clear();
+    }
+
+    size_ = 0;
 }
 
 ReceivePromise::Pointer ChannelReceivePromiseQueue::pop()
 {
-    return this->pop(queue_.begin()->first);
+    for(size_t channelIndex = 0; channelIndex < queue_.size(); ++channelIndex)
+    {
+        if(!queue_[channelIndex].empty())
+        {
+            return this->pop(static_cast<ChannelId>(channelIndex));
+        }
+    }
+
+    return nullptr;
 }
 
 }
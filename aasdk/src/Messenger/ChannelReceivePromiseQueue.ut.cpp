@@ -0,0 +1,73 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Messenger/ChannelReceivePromiseQueue.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(ChannelReceivePromiseQueue_PopsPromisesOfChannelInOrder)
+{
+    boost::asio::io_service ioService;
+    auto firstPromise = ReceivePromise::defer(ioService);
+    auto secondPromise = ReceivePromise::defer(ioService);
+    auto otherChannelPromise = ReceivePromise::defer(ioService);
+
+    ChannelReceivePromiseQueue queue;
+    queue.push(ChannelId::VIDEO, firstPromise);
+    queue.push(ChannelId::SENSOR, otherChannelPromise);
+    queue.push(ChannelId::VIDEO, secondPromise);
+    BOOST_CHECK_EQUAL(queue.size(), 3);
+    BOOST_CHECK(!queue.isPending(ChannelId::INPUT));
+
+    BOOST_CHECK(queue.pop(ChannelId::VIDEO) == firstPromise);
+    BOOST_CHECK(queue.pop(ChannelId::VIDEO) == secondPromise);
+    BOOST_CHECK(!queue.isPending(ChannelId::VIDEO));
+    BOOST_CHECK(queue.isPending(ChannelId::SENSOR));
+
+    BOOST_CHECK(queue.pop() == otherChannelPromise);
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ChannelReceivePromiseQueue_ClearReleasesPromises)
+{
+    boost::asio::io_service ioService;
+    auto promise = ReceivePromise::defer(ioService);
+
+    ChannelReceivePromiseQueue queue;
+    queue.push(ChannelId::AV_INPUT, promise);
+    queue.push(ChannelId::CONTROL, promise);
+    BOOST_CHECK_EQUAL(promise.use_count(), 3);
+
+    queue.clear();
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK(!queue.isPending(ChannelId::AV_INPUT));
+    BOOST_CHECK_EQUAL(promise.use_count(), 1);
+}
+
+}
+}
+}
+}
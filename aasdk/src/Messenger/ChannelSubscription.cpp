@@ -0,0 +1,190 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Messenger/ChannelSubscription.hpp>
+#include <f1x/aasdk/IO/IOContextWrapper.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+ChannelSubscription::ChannelSubscription(boost::asio::io_service::strand& strand, MessageHandler messageHandler, ErrorHandler errorHandler)
+    : strand_(strand)
+    , messageHandler_(std::move(messageHandler))
+    , errorHandler_(std::move(errorHandler))
+    , droppedCount_(0)
+    , deliveryScheduled_(false)
+    , blocked_(false)
+    , active_(true)
+    , mutex_("ChannelSubscription")
+{
+
+}
+
+bool ChannelSubscription::push(Message::Pointer message, size_t capacity, ReceiveQueuePolicy policy)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    if(!active_)
+    {
+        return false;
+    }
+
+    if(batch_.size() >= capacity)
+    {
+        if(policy == ReceiveQueuePolicy::DROP_NEWEST)
+        {
+            ++droppedCount_;
+            return false;
+        }
+        else if(policy == ReceiveQueuePolicy::DROP_OLDEST)
+        {
+            batch_.erase(batch_.begin());
+            ++droppedCount_;
+        }
+    }
+
+    batch_.emplace_back(std::move(message));
+
+    if(!deliveryScheduled_)
+    {
+        deliveryScheduled_ = true;
+        io::IOContextWrapper(strand_).post(std::bind(&ChannelSubscription::deliver, this->shared_from_this()));
+    }
+
+    if(policy == ReceiveQueuePolicy::BLOCK && !blocked_ && batch_.size() >= capacity)
+    {
+        blocked_ = true;
+        return true;
+    }
+
+    return false;
+}
+
+void ChannelSubscription::reject(const error::Error& e)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    if(active_)
+    {
+        active_ = false;
+        batch_.clear();
+        io::IOContextWrapper(strand_).post([errorHandler = std::move(errorHandler_), e]() {
+            errorHandler(e);
+        });
+    }
+
+    blocked_ = false;
+    messageHandler_ = MessageHandler();
+    drainHandler_ = DrainHandler();
+}
+
+bool ChannelSubscription::cancel()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    const bool wasBlocked = blocked_;
+    blocked_ = false;
+    active_ = false;
+    batch_.clear();
+    messageHandler_ = MessageHandler();
+    errorHandler_ = ErrorHandler();
+    drainHandler_ = DrainHandler();
+
+    return wasBlocked;
+}
+
+void ChannelSubscription::setDrainHandler(DrainHandler drainHandler)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    drainHandler_ = std::move(drainHandler);
+}
+
+void ChannelSubscription::setHopProfiler(HopProfiler::Pointer hopProfiler)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    hopProfiler_ = std::move(hopProfiler);
+}
+
+size_t ChannelSubscription::getPendingCount() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return batch_.size();
+}
+
+size_t ChannelSubscription::getDroppedCount() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return droppedCount_;
+}
+
+void ChannelSubscription::deliver()
+{
+    std::vector<Message::Pointer> batch;
+    MessageHandler messageHandler;
+    DrainHandler drainHandler;
+    HopProfiler::Pointer hopProfiler;
+
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+        deliveryScheduled_ = false;
+        batch.swap(batch_);
+        messageHandler = messageHandler_;
+        hopProfiler = hopProfiler_;
+    }
+
+    for(auto& message : batch)
+    {
+        // The batch is always posted to the subscription strand.
+        message->getHopCounter().addPosted();
+
+        if(hopProfiler != nullptr)
+        {
+            hopProfiler->record(*message);
+        }
+
+        if(messageHandler != nullptr)
+        {
+            messageHandler(std::move(message));
+        }
+    }
+
+    // A blocked channel is released only once its batch has been consumed, so at most capacity messages are pending.
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+        if(blocked_)
+        {
+            blocked_ = false;
+            drainHandler = drainHandler_;
+        }
+    }
+
+    if(drainHandler != nullptr)
+    {
+        drainHandler();
+    }
+}
+
+}
+}
+}
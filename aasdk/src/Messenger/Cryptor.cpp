@@ -36,6 +36,7 @@ Cryptor::Cryptor(transport::ISSLWrapper::Pointer sslWrapper)
     , context_(nullptr)
     , ssl_(nullptr)
     , isActive_(false)
+    , mutex_("Cryptor")
 {
 
 }
@@ -185,7 +186,7 @@ size_t Cryptor::decrypt(common::Data& output, const common::DataConstBuffer& buf
 
     this->write(buffer);
     const size_t beginOffset = output.size();
-    output.resize(beginOffset + 1);
+    output.resize(beginOffset + 1, common::cDefaultInit);
 
     size_t availableBytes = 1;
     size_t totalReadSize = 0;
@@ -202,7 +203,7 @@ size_t Cryptor::decrypt(common::Data& output, const common::DataConstBuffer& buf
 
         totalReadSize += readSize;
         availableBytes = sslWrapper_->getAvailableBytes(ssl_);
-        output.resize(output.size() + availableBytes);
+        output.resize(output.size() + availableBytes, common::cDefaultInit);
     }
 
     return totalReadSize;
@@ -229,7 +230,7 @@ size_t Cryptor::read(common::Data& output)
     const auto pendingSize = sslWrapper_->bioCtrlPending(bIOs_.second);
 
     size_t beginOffset = output.size();
-    output.resize(beginOffset + pendingSize);
+    output.resize(beginOffset + pendingSize, common::cDefaultInit);
     size_t totalReadSize = 0;
 
     while(totalReadSize < pendingSize)
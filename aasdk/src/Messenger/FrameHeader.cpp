@@ -65,12 +65,21 @@ MessageType FrameHeader::getMessageType() const
 
 common::Data FrameHeader::getData() const
 {
-    common::Data data;
+    common::Data data(getSizeOf());
+    this->write(common::DataBuffer(data));
+    return data;
+}
 
-    data.push_back(static_cast<uint8_t>(channelId_));
-    data.push_back(static_cast<uint8_t>(encryptionType_) | static_cast<uint8_t>(messageType_) | static_cast<uint8_t>(frameType_));
+size_t FrameHeader::write(common::DataBuffer buffer) const
+{
+    if(buffer.size < getSizeOf())
+    {
+        return 0;
+    }
 
-    return data;
+    buffer.data[0] = static_cast<uint8_t>(channelId_);
+    buffer.data[1] = static_cast<uint8_t>(encryptionType_) | static_cast<uint8_t>(messageType_) | static_cast<uint8_t>(frameType_);
+    return getSizeOf();
 }
 
 }
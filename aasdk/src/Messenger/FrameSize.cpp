@@ -43,6 +43,9 @@ FrameSize::FrameSize(size_t frameSize)
 }
 
 FrameSize::FrameSize(const common::DataConstBuffer& buffer)
+    : frameSizeType_(FrameSizeType::SHORT)
+    , frameSize_(0)
+    , totalSize_(0)
 {
     if(buffer.size >= 2)
     {
@@ -59,20 +62,28 @@ FrameSize::FrameSize(const common::DataConstBuffer& buffer)
 
 common::Data FrameSize::getData() const
 {
-    common::Data data;
+    common::Data data(getSizeOf(frameSizeType_));
+    this->write(common::DataBuffer(data));
+    return data;
+}
+
+size_t FrameSize::write(common::DataBuffer buffer) const
+{
+    if(buffer.size < getSizeOf(frameSizeType_))
+    {
+        return 0;
+    }
 
-    uint16_t frameSizeBig = boost::endian::native_to_big(static_cast<uint16_t>(frameSize_));
-    const common::DataConstBuffer frameSizeBigBuffer(&frameSizeBig, sizeof(frameSizeBig));
-    common::copy(data, frameSizeBigBuffer);
+    const uint16_t frameSizeBig = boost::endian::native_to_big(static_cast<uint16_t>(frameSize_));
+    memcpy(buffer.data, &frameSizeBig, sizeof(frameSizeBig));
 
     if(frameSizeType_ == FrameSizeType::EXTENDED)
     {
-        uint32_t totalSizeBig = boost::endian::native_to_big(static_cast<uint32_t>(totalSize_));
-        const common::DataConstBuffer totalSizeBigBuffer(&totalSizeBig, sizeof(totalSizeBig));
-        common::copy(data, totalSizeBigBuffer);
+        const uint32_t totalSizeBig = boost::endian::native_to_big(static_cast<uint32_t>(totalSize_));
+        memcpy(buffer.data + sizeof(frameSizeBig), &totalSizeBig, sizeof(totalSizeBig));
     }
 
-    return data;
+    return getSizeOf(frameSizeType_);
 }
 
 size_t FrameSize::getSize() const
@@ -80,9 +91,14 @@ size_t FrameSize::getSize() const
     return frameSize_;
 }
 
-size_t FrameSize::getSizeOf(FrameSizeType type)
+size_t FrameSize::getTotalSize() const
+{
+    return totalSize_;
+}
+
+FrameSizeType FrameSize::getType() const
 {
-    return type == FrameSizeType::EXTENDED ? 6 : 2;
+    return frameSizeType_;
 }
 
 }
@@ -0,0 +1,107 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/Messenger/HopProfiler.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+void HopProfiler::record(const Message& message)
+{
+    if(isEnabled())
+    {
+        this->record(message.getChannelId(), getMessageId(message), message.getHopCounter());
+    }
+}
+
+void HopProfiler::record(ChannelId channelId, uint16_t messageId, const io::HopCounter& hopCounter)
+{
+    if(!isEnabled())
+    {
+        return;
+    }
+
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    auto& statistics = statistics_[std::make_pair(channelId, messageId)];
+    statistics.channelId = channelId;
+    statistics.messageId = messageId;
+    statistics.messagesCount += 1;
+    statistics.postedHopsCount += hopCounter.getPostedCount();
+    statistics.inlineHopsCount += hopCounter.getInlineCount();
+    statistics.maxPostedHops = std::max<size_t>(statistics.maxPostedHops, hopCounter.getPostedCount());
+}
+
+std::vector<HopProfiler::Statistics> HopProfiler::getStatistics() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    std::vector<Statistics> statistics;
+    statistics.reserve(statistics_.size());
+
+    for(const auto& entry : statistics_)
+    {
+        statistics.push_back(entry.second);
+    }
+
+    return statistics;
+}
+
+void HopProfiler::dump() const
+{
+    for(const auto& statistics : this->getStatistics())
+    {
+        AASDK_LOG(info) << "[HopProfiler] channel: " << channelIdToString(statistics.channelId)
+                        << ", message id: " << statistics.messageId
+                        << ", messages: " << statistics.messagesCount
+                        << ", avg posted hops: " << static_cast<double>(statistics.postedHopsCount) / statistics.messagesCount
+                        << ", avg inline hops: " << static_cast<double>(statistics.inlineHopsCount) / statistics.messagesCount
+                        << ", max posted hops: " << statistics.maxPostedHops;
+    }
+}
+
+bool HopProfiler::isEnabled()
+{
+#ifdef AASDK_HOP_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint16_t HopProfiler::getMessageId(const Message& message)
+{
+    const auto& payload = message.getPayload();
+    return payload.size() >= MessageId::getSizeOf() ? MessageId(payload).getId() : 0;
+}
+
+void HopProfiler::reset()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    statistics_.clear();
+}
+
+}
+}
+}
@@ -0,0 +1,230 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/ThreadingPolicy.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace bench
+{
+
+// One direction of an in-memory wire. Bytes sent by the sender end are handed to the receive pending on the other end.
+class Pipe
+{
+public:
+    typedef std::shared_ptr<Pipe> Pointer;
+
+    void write(const common::Data& data)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        buffer_.insert(buffer_.end(), data.begin(), data.end());
+        this->complete(std::move(lock));
+    }
+
+    void read(size_t size, transport::ITransport::ReceivePromise::Pointer promise)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        pendingSize_ = size;
+        pendingPromise_ = std::move(promise);
+        this->complete(std::move(lock));
+    }
+
+    void close()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto promise = std::move(pendingPromise_);
+        lock.unlock();
+
+        if(promise != nullptr)
+        {
+            promise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+        }
+    }
+
+private:
+    void complete(std::unique_lock<std::mutex> lock)
+    {
+        if(pendingPromise_ == nullptr || buffer_.size() - offset_ < pendingSize_)
+        {
+            return;
+        }
+
+        common::Data data(buffer_.begin() + offset_, buffer_.begin() + offset_ + pendingSize_);
+        offset_ += pendingSize_;
+
+        if(offset_ == buffer_.size())
+        {
+            buffer_.clear();
+            offset_ = 0;
+        }
+
+        auto promise = std::move(pendingPromise_);
+        lock.unlock();
+        promise->resolve(std::move(data));
+    }
+
+    std::mutex mutex_;
+    common::Data buffer_;
+    size_t offset_ = 0;
+    size_t pendingSize_ = 0;
+    transport::ITransport::ReceivePromise::Pointer pendingPromise_;
+};
+
+class PipeTransport: public transport::ITransport
+{
+public:
+    PipeTransport(Pipe::Pointer input, Pipe::Pointer output)
+        : input_(std::move(input))
+        , output_(std::move(output))
+    {
+
+    }
+
+    void receive(size_t size, ReceivePromise::Pointer promise) override
+    {
+        input_->read(size, std::move(promise));
+    }
+
+    void send(common::Data data, SendPromise::Pointer promise) override
+    {
+        output_->write(data);
+        promise->resolve();
+    }
+
+    void stop() override
+    {
+        input_->close();
+    }
+
+private:
+    Pipe::Pointer input_;
+    Pipe::Pointer output_;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+static void measureLoopback(size_t ioThreadsCount)
+{
+    const size_t messagesCount = 100000;
+    const size_t sendWindow = 8;
+
+    boost::asio::io_service ioService(ioThreadsCount);
+    boost::asio::io_service::strand strand(ioService);
+    auto pipe(std::make_shared<Pipe>());
+    auto senderTransport(std::make_shared<PipeTransport>(std::make_shared<Pipe>(), pipe));
+    auto receiverTransport(std::make_shared<PipeTransport>(pipe, std::make_shared<Pipe>()));
+
+    auto sender(std::make_shared<Messenger>(ioService,
+                                            std::make_shared<MessageInStream>(ioService, senderTransport, nullptr, std::make_shared<MessagePool>()),
+                                            std::make_shared<MessageOutStream>(ioService, senderTransport, nullptr)));
+    auto receiver(std::make_shared<Messenger>(ioService,
+                                              std::make_shared<MessageInStream>(ioService, receiverTransport, nullptr, std::make_shared<MessagePool>()),
+                                              std::make_shared<MessageOutStream>(ioService, receiverTransport, nullptr)));
+
+    size_t receivedCount = 0;
+    Clock::rep latencySum = 0;
+    size_t sentCount = 0;
+    std::function<void()> sendNext;
+
+    // Every received message lets the next one go, so at most sendWindow messages are in flight end to end.
+    receiver->subscribe(ChannelId::SENSOR, std::make_shared<ChannelSubscription>(strand, [&](Message::Pointer message) {
+            Clock::rep sentAt;
+            std::memcpy(&sentAt, message->getPayload().data(), sizeof(sentAt));
+            latencySum += Clock::now().time_since_epoch().count() - sentAt;
+            ++receivedCount;
+            sendNext();
+        },
+        [](const error::Error&) {}));
+
+    sendNext = [&]() {
+        if(sentCount == messagesCount)
+        {
+            return;
+        }
+
+        ++sentCount;
+        const auto sentAt = Clock::now().time_since_epoch().count();
+        common::Data payload(64, 0x5E);
+        std::memcpy(payload.data(), &sentAt, sizeof(sentAt));
+
+        auto message(std::make_shared<Message>(ChannelId::SENSOR, EncryptionType::PLAIN, MessageType::SPECIFIC));
+        message->insertPayload(payload);
+
+        sender->enqueueSend(std::move(message));
+    };
+
+    const auto begin = Clock::now();
+    strand.dispatch([&]() {
+        for(size_t i = 0; i < sendWindow; ++i)
+        {
+            sendNext();
+        }
+    });
+
+    std::vector<std::thread> threadPool;
+    for(size_t i = 0; i < ioThreadsCount; ++i)
+    {
+        threadPool.emplace_back([&ioService]() { ioService.run(); });
+    }
+
+    std::for_each(threadPool.begin(), threadPool.end(), std::bind(&std::thread::join, std::placeholders::_1));
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+
+    std::cout << "[Loopback] locks: " << (std::is_same<common::Mutex, common::NullMutex>::value ? "elided" : "std::mutex")
+              << ", io threads: " << ioThreadsCount
+              << ", messages per second: " << messagesCount * 1000000000ULL / elapsed
+              << ", mean latency us: " << std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::duration(latencySum)).count() / receivedCount / 1000.0
+              << std::endl;
+    BOOST_CHECK_EQUAL(receivedCount, messagesCount);
+
+    receiverTransport->stop();
+    senderTransport->stop();
+    ioService.reset();
+    ioService.run();
+}
+
+BOOST_AUTO_TEST_CASE(Loopback_ThreadingModes)
+{
+    // Build with and without AASDK_SINGLE_THREADED to compare both modes; elided locks are only valid with one io thread.
+    measureLoopback(common::SingleThreadedPolicy::cIOThreadsCount);
+
+    if(common::DefaultThreadingPolicy::cIOThreadsCount > 1)
+    {
+        measureLoopback(common::MultiThreadedPolicy::cIOThreadsCount);
+    }
+}
+
+}
+}
+}
+}
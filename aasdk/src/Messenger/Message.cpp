@@ -29,6 +29,8 @@ Message::Message(ChannelId channelId, EncryptionType encryptionType, MessageType
     : channelId_(channelId)
     , encryptionType_(encryptionType)
     , type_(type)
+    , frameHeadroom_(0)
+    , fragmentType_(FrameType::BULK)
 {
 }
 
@@ -37,6 +39,9 @@ Message::Message(Message&& other)
     , encryptionType_(other.encryptionType_)
     , type_(other.type_)
     , payload_(std::move(other.payload_))
+    , frameHeadroom_(other.frameHeadroom_)
+    , hopCounter_(other.hopCounter_)
+    , fragmentType_(other.fragmentType_)
 {
 
 }
@@ -47,6 +52,9 @@ Message& Message::operator=(Message&& other)
     encryptionType_ = std::move(other.encryptionType_);
     type_ = std::move(other.type_);
     payload_ = std::move(other.payload_);
+    frameHeadroom_ = other.frameHeadroom_;
+    hopCounter_ = other.hopCounter_;
+    fragmentType_ = other.fragmentType_;
 
     return *this;
 }
@@ -68,14 +76,40 @@ MessageType Message::getType() const
 
 common::Data& Message::getPayload()
 {
+    this->dropFrameHeadroom();
     return payload_;
 }
 
 const common::Data& Message::getPayload() const
 {
+    this->dropFrameHeadroom();
     return payload_;
 }
 
+common::Data& Message::getFrameBuffer()
+{
+    return payload_;
+}
+
+size_t Message::getFrameHeadroom() const
+{
+    return frameHeadroom_;
+}
+
+void Message::setFrameHeadroom(size_t frameHeadroom)
+{
+    frameHeadroom_ = frameHeadroom;
+}
+
+void Message::dropFrameHeadroom() const
+{
+    if(frameHeadroom_ > 0)
+    {
+        payload_.erase(payload_.begin(), payload_.begin() + frameHeadroom_);
+        frameHeadroom_ = 0;
+    }
+}
+
 void Message::insertPayload(const common::Data& payload)
 {
     payload_.insert(payload_.end(), payload.begin(), payload.end());
@@ -84,7 +118,7 @@ void Message::insertPayload(const common::Data& payload)
 void Message::insertPayload(const google::protobuf::Message& message)
 {
     auto offset = payload_.size();
-    payload_.resize(payload_.size() + message.ByteSizeLong());
+    payload_.resize(payload_.size() + message.ByteSizeLong(), common::cDefaultInit);
 
     common::DataBuffer buffer(payload_, offset);
     message.SerializeToArray(buffer.data, buffer.size);
@@ -100,6 +134,26 @@ void Message::insertPayload(common::DataBuffer& buffer)
     common::copy(payload_, buffer);
 }
 
+io::HopCounter& Message::getHopCounter()
+{
+    return hopCounter_;
+}
+
+const io::HopCounter& Message::getHopCounter() const
+{
+    return hopCounter_;
+}
+
+void Message::setFragmentType(FrameType fragmentType)
+{
+    fragmentType_ = fragmentType;
+}
+
+FrameType Message::getFragmentType() const
+{
+    return fragmentType_;
+}
+
 }
 }
 }
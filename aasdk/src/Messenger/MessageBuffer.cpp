@@ -0,0 +1,64 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Messenger/MessageBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+MessageBuffer::MessageBuffer()
+    : offset_(0)
+{
+
+}
+
+MessageBuffer::MessageBuffer(Message::Pointer message, size_t offset)
+    : message_(std::move(message))
+    , offset_(offset)
+{
+
+}
+
+common::DataConstBuffer MessageBuffer::getData() const
+{
+    return message_ != nullptr ? common::DataConstBuffer(message_->getPayload(), offset_) : common::DataConstBuffer();
+}
+
+size_t MessageBuffer::getSize() const
+{
+    return this->getData().size;
+}
+
+const Message::Pointer& MessageBuffer::getMessage() const
+{
+    return message_;
+}
+
+void MessageBuffer::release()
+{
+    message_.reset();
+    offset_ = 0;
+}
+
+}
+}
+}
@@ -0,0 +1,74 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Messenger/MessageBuffer.hpp>
+#include <f1x/aasdk/Messenger/MessagePool.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(MessageBuffer_ReferencesPayloadFromOffset)
+{
+    auto message = std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    message->insertPayload(common::Data{0x00, 0x01, 0x02, 0x03, 0x04});
+
+    MessageBuffer buffer(message, 2);
+    BOOST_CHECK_EQUAL(buffer.getSize(), 3u);
+    BOOST_CHECK(buffer.getData().cdata == &message->getPayload()[2]);
+    BOOST_CHECK_EQUAL(buffer.getData().cdata[0], 0x02);
+
+    MessageBuffer empty;
+    BOOST_CHECK_EQUAL(empty.getSize(), 0u);
+    BOOST_CHECK(empty.getData() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(MessageBuffer_HoldsMessageUntilReleased)
+{
+    auto messagePool = std::make_shared<MessagePool>();
+    auto message = messagePool->acquire(ChannelId::MEDIA_AUDIO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    message->insertPayload(common::Data(128, 0x5A));
+    const auto* rawPayload = message->getPayload().data();
+
+    MessageBuffer buffer(std::move(message), 10);
+    auto copy = buffer;
+    buffer.release();
+    BOOST_CHECK(buffer.getMessage() == nullptr);
+
+    message = messagePool->acquire(ChannelId::MEDIA_AUDIO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    BOOST_CHECK(message != copy.getMessage());
+    BOOST_CHECK(copy.getData().cdata == rawPayload + 10);
+    BOOST_CHECK_EQUAL(copy.getSize(), 118u);
+
+    const auto before = messagePool->getStatistics();
+    copy.release();
+    message.reset();
+    message = messagePool->acquire(ChannelId::MEDIA_AUDIO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    BOOST_CHECK_EQUAL(messagePool->getStatistics().messageHits, before.messageHits + 1);
+}
+
+}
+}
+}
+}
@@ -0,0 +1,159 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+constexpr size_t MessageBuilder::cFrameHeadroom;
+
+MessageBuilder::MessageBuilder(ChannelId channelId, EncryptionType encryptionType, MessageType type)
+    : channelId_(channelId)
+    , encryptionType_(encryptionType)
+    , type_(type)
+    , hasId_(false)
+    , id_(0)
+    , hasTimestamp_(false)
+    , timestamp_(0)
+    , protobufMessage_(nullptr)
+    , protobufMessageSize_(0)
+    , wirePayloadSize_(0)
+{
+
+}
+
+MessageBuilder& MessageBuilder::setId(MessageId id)
+{
+    hasId_ = true;
+    id_ = id;
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::setTimestamp(Timestamp timestamp)
+{
+    hasTimestamp_ = true;
+    timestamp_ = timestamp;
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::setPayload(const google::protobuf::Message& message)
+{
+    protobufMessage_ = &message;
+    protobufMessageSize_ = message.ByteSizeLong();
+    buffer_ = common::DataConstBuffer();
+    wirePayloadSize_ = 0;
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::setPayload(const common::DataConstBuffer& buffer)
+{
+    protobufMessage_ = nullptr;
+    protobufMessageSize_ = 0;
+    buffer_ = buffer;
+    wirePayloadSize_ = 0;
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::setPayload(const proto::messages::AVMediaAckIndication& message)
+{
+    return this->setWirePayload(message);
+}
+
+MessageBuilder& MessageBuilder::setPayload(const proto::messages::InputEventIndication& message)
+{
+    return this->setWirePayload(message);
+}
+
+MessageBuilder& MessageBuilder::setPayload(const proto::messages::PingRequest& message)
+{
+    return this->setWirePayload(message);
+}
+
+template<typename MessageType>
+MessageBuilder& MessageBuilder::setWirePayload(const MessageType& message)
+{
+    if(!WireTemplate<MessageType>::matches(message))
+    {
+        return this->setPayload(static_cast<const google::protobuf::Message&>(message));
+    }
+
+    protobufMessage_ = nullptr;
+    protobufMessageSize_ = 0;
+    buffer_ = common::DataConstBuffer();
+    wirePayloadSize_ = WireTemplate<MessageType>::write(message, wirePayload_.data());
+    return *this;
+}
+
+size_t MessageBuilder::getPayloadSize() const
+{
+    return (hasId_ ? MessageId::getSizeOf() : 0)
+            + (hasTimestamp_ ? Timestamp::getSizeOf() : 0)
+            + protobufMessageSize_
+            + wirePayloadSize_
+            + buffer_.size;
+}
+
+Message::Pointer MessageBuilder::build() const
+{
+    auto message(std::make_shared<Message>(channelId_, encryptionType_, type_));
+    auto& payload = message->getFrameBuffer();
+
+    const size_t frameHeadroom = encryptionType_ == EncryptionType::PLAIN ? cFrameHeadroom : 0;
+    payload.resize(frameHeadroom + this->getPayloadSize(), common::cDefaultInit);
+    message->setFrameHeadroom(frameHeadroom);
+
+    size_t offset = frameHeadroom;
+
+    if(hasId_)
+    {
+        offset += id_.write(common::DataBuffer(payload, offset));
+    }
+
+    if(hasTimestamp_)
+    {
+        offset += timestamp_.write(common::DataBuffer(payload, offset));
+    }
+
+    if(protobufMessage_ != nullptr)
+    {
+        protobufMessage_->SerializeWithCachedSizesToArray(payload.data() + offset);
+        offset += protobufMessageSize_;
+    }
+
+    if(wirePayloadSize_ > 0)
+    {
+        memcpy(payload.data() + offset, wirePayload_.data(), wirePayloadSize_);
+        offset += wirePayloadSize_;
+    }
+
+    if(buffer_.size > 0)
+    {
+        memcpy(payload.data() + offset, buffer_.cdata, buffer_.size);
+    }
+
+    return message;
+}
+
+}
+}
+}
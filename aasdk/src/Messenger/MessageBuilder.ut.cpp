@@ -0,0 +1,124 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <aasdk_proto/PingRequestMessage.pb.h>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(MessageBuilder_BuildProtobufMessage)
+{
+    proto::messages::PingRequest request;
+    request.set_timestamp(123456789);
+
+    Message expectedMessage(ChannelId::CONTROL, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    expectedMessage.insertPayload(MessageId(0x000b).getData());
+    expectedMessage.insertPayload(request);
+
+    auto message = MessageBuilder(ChannelId::CONTROL, EncryptionType::ENCRYPTED, MessageType::SPECIFIC)
+            .setId(0x000b)
+            .setPayload(request)
+            .build();
+
+    BOOST_CHECK(message->getChannelId() == ChannelId::CONTROL);
+    BOOST_CHECK(message->getEncryptionType() == EncryptionType::ENCRYPTED);
+    BOOST_CHECK(message->getType() == MessageType::SPECIFIC);
+    BOOST_CHECK_EQUAL_COLLECTIONS(message->getPayload().begin(), message->getPayload().end(),
+                                  expectedMessage.getPayload().begin(), expectedMessage.getPayload().end());
+    BOOST_CHECK_EQUAL(message->getFrameHeadroom(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MessageBuilder_BuildPlainMessageBehindFrameHeadroom)
+{
+    const common::Data data(100, 0x3C);
+
+    auto message = MessageBuilder(ChannelId::CONTROL, EncryptionType::PLAIN, MessageType::SPECIFIC)
+            .setId(0x0001)
+            .setPayload(common::DataConstBuffer(data))
+            .build();
+
+    const auto& payload = message->getFrameBuffer();
+    BOOST_CHECK_EQUAL(message->getFrameHeadroom(), MessageBuilder::cFrameHeadroom);
+    BOOST_CHECK_EQUAL(payload.size(), MessageBuilder::cFrameHeadroom + MessageId::getSizeOf() + data.size());
+    BOOST_CHECK_EQUAL(MessageId(common::Data(payload.begin() + MessageBuilder::cFrameHeadroom, payload.end())).getId(), 0x0001);
+    BOOST_CHECK_EQUAL_COLLECTIONS(payload.begin() + MessageBuilder::cFrameHeadroom + MessageId::getSizeOf(), payload.end(),
+                                  data.begin(), data.end());
+}
+
+BOOST_AUTO_TEST_CASE(MessageBuilder_BuildPlainMessagePayload)
+{
+    const common::Data data(100, 0x3C);
+
+    Message expectedMessage(ChannelId::CONTROL, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    expectedMessage.insertPayload(MessageId(0x0001).getData());
+    expectedMessage.insertPayload(data);
+
+    auto message = MessageBuilder(ChannelId::CONTROL, EncryptionType::PLAIN, MessageType::SPECIFIC)
+            .setId(0x0001)
+            .setPayload(common::DataConstBuffer(data))
+            .build();
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(message->getPayload().begin(), message->getPayload().end(),
+                                  expectedMessage.getPayload().begin(), expectedMessage.getPayload().end());
+    BOOST_CHECK_EQUAL(message->getFrameHeadroom(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MessageBuilder_BuildTimestampedMessage)
+{
+    const common::Data data(100, 0x3C);
+    const Timestamp::ValueType timestamp = 0x0102030405060708;
+
+    Message expectedMessage(ChannelId::AV_INPUT, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    expectedMessage.insertPayload(MessageId(0x0001).getData());
+    expectedMessage.insertPayload(Timestamp(timestamp).getData());
+    expectedMessage.insertPayload(data);
+
+    MessageBuilder messageBuilder(ChannelId::AV_INPUT, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    messageBuilder.setId(0x0001).setTimestamp(timestamp).setPayload(common::DataConstBuffer(data));
+    BOOST_CHECK_EQUAL(messageBuilder.getPayloadSize(), expectedMessage.getPayload().size());
+
+    auto message = messageBuilder.build();
+    BOOST_CHECK_EQUAL_COLLECTIONS(message->getPayload().begin(), message->getPayload().end(),
+                                  expectedMessage.getPayload().begin(), expectedMessage.getPayload().end());
+}
+
+BOOST_AUTO_TEST_CASE(MessageBuilder_WriteIsBoundedByBuffer)
+{
+    common::Data data(1, 0);
+    BOOST_CHECK_EQUAL(MessageId(0x1234).write(common::DataBuffer(data)), 0);
+    BOOST_CHECK_EQUAL(FrameSize(10, 20).write(common::DataBuffer(data)), 0);
+
+    data.resize(FrameSize::getSizeOf(FrameSizeType::EXTENDED));
+    BOOST_CHECK_EQUAL(FrameSize(10, 20).write(common::DataBuffer(data)), data.size());
+
+    const auto expectedData = FrameSize(10, 20).getData();
+    BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(), expectedData.begin(), expectedData.end());
+}
+
+}
+}
+}
+}
@@ -44,9 +44,21 @@ uint16_t MessageId::getId() const
 
 common::Data MessageId::getData() const
 {
-    const MessageId messageIdBig = boost::endian::native_to_big(id_);
-    const common::DataConstBuffer messageIdBigBuffer(&messageIdBig, sizeof(messageIdBig));
-    return common::createData(messageIdBigBuffer);
+    common::Data data(getSizeOf());
+    this->write(common::DataBuffer(data));
+    return data;
+}
+
+size_t MessageId::write(common::DataBuffer buffer) const
+{
+    if(buffer.size < getSizeOf())
+    {
+        return 0;
+    }
+
+    const uint16_t messageIdBig = boost::endian::native_to_big(id_);
+    memcpy(buffer.data, &messageIdBig, sizeof(messageIdBig));
+    return sizeof(messageIdBig);
 }
 
 bool MessageId::operator>(uint16_t id) const
@@ -27,10 +27,11 @@ namespace aasdk
 namespace messenger
 {
 
-MessageInStream::MessageInStream(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor)
+MessageInStream::MessageInStream(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor, MessagePool::Pointer messagePool)
     : strand_(ioService)
     , transport_(std::move(transport))
     , cryptor_(std::move(cryptor))
+    , messagePool_(std::move(messagePool))
 {
 
 }
@@ -41,15 +42,15 @@ void MessageInStream::startReceive(ReceivePromise::Pointer promise)
         if(promise_ == nullptr)
         {
             promise_ = std::move(promise);
+            self_ = std::move(self);
 
             auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_);
             transportPromise->then(
-                [this, self = this->shared_from_this()](common::Data data) mutable {
+                [this](common::Data data) mutable {
                     this->receiveFrameHeaderHandler(common::DataConstBuffer(data));
                 },
-                [this, self = this->shared_from_this()](const error::Error& e) mutable {
-                    promise_->reject(e);
-                    promise_.reset();
+                [this](const error::Error& e) mutable {
+                    this->rejectMessage(e);
                 });
 
             transport_->receive(FrameHeader::getSizeOf(), std::move(transportPromise));
@@ -61,45 +62,54 @@ void MessageInStream::startReceive(ReceivePromise::Pointer promise)
     });
 }
 
+void MessageInStream::setStreamingEnabled(ChannelId channelId, bool enabled)
+{
+    strand_.dispatch([this, self = this->shared_from_this(), channelId, enabled]() {
+        streamingChannels_.set(static_cast<uint8_t>(channelId), enabled);
+    });
+}
+
 void MessageInStream::receiveFrameHeaderHandler(const common::DataConstBuffer& buffer)
 {
     FrameHeader frameHeader(buffer);
+    auto& reassembly = reassemblyTable_[static_cast<uint8_t>(frameHeader.getChannelId())];
 
-    if(message_ == nullptr)
+    if(frameHeader.getType() == FrameType::BULK)
     {
-        //message_ = std::make_shared<Message>(frameHeader.getChannelId(), frameHeader.getEncryptionType(), frameHeader.getMessageType());
-        if (messageBig_ != nullptr && messageBig_->getChannelId() == frameHeader.getChannelId()) {
-            message_ = std::move(messageBig_);
-            messageBig_ = nullptr;
-            //AASDK_LOG(debug) << "[chos] " << (int) message_->getChannelId();
-        }
-        else {
-            message_ = std::make_shared<Message>(frameHeader.getChannelId(), frameHeader.getEncryptionType(), frameHeader.getMessageType());
+        message_ = messagePool_->acquire(frameHeader.getChannelId(), frameHeader.getEncryptionType(), frameHeader.getMessageType());
+    }
+    else if(frameHeader.getType() == FrameType::FIRST)
+    {
+        if(reassembly != nullptr)
+        {
+            AASDK_LOG(error) << "[MessageInStream] dropping incomplete message, channel: " << channelIdToString(frameHeader.getChannelId());
         }
+
+        reassembly = messagePool_->acquire(frameHeader.getChannelId(), frameHeader.getEncryptionType(), frameHeader.getMessageType());
+        message_ = reassembly;
+    }
+    else if(reassembly != nullptr)
+    {
+        message_ = reassembly;
     }
-    else if(message_->getChannelId() != frameHeader.getChannelId())
+    else
     {
-        //message_.reset();
-        //promise_->reject(error::Error(error::ErrorCode::MESSENGER_INTERTWINED_CHANNELS));
-        //promise_.reset();
-        //return;
-        messageBig_ = std::move(message_);
-        message_ = std::make_shared<Message>(frameHeader.getChannelId(), frameHeader.getEncryptionType(), frameHeader.getMessageType());
-        //AASDK_LOG(debug) << "[chos] " << (int) messageBig_->getChannelId() << " " << (int) message_->getChannelId() << " recentFrameType_ " << (int) recentFrameType_;
+        this->rejectMessage(error::Error(error::ErrorCode::MESSENGER_INTERTWINED_CHANNELS));
+        return;
     }
 
     recentFrameType_ = frameHeader.getType();
     const size_t frameSize = FrameSize::getSizeOf(frameHeader.getType() == FrameType::FIRST ? FrameSizeType::EXTENDED : FrameSizeType::SHORT);
 
+    // The message outlives the receive of each of its frame parts, so the transport counts the hops into it.
     auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_);
+    transportPromise->setHopCounter(&message_->getHopCounter());
     transportPromise->then(
-        [this, self = this->shared_from_this()](common::Data data) mutable {
+        [this](common::Data data) mutable {
             this->receiveFrameSizeHandler(common::DataConstBuffer(data));
         },
-        [this, self = this->shared_from_this()](const error::Error& e) mutable {
-            message_.reset();
-            promise_->reject(e);
-            promise_.reset();
+        [this](const error::Error& e) mutable {
+            this->rejectMessage(e);
         });
 
     transport_->receive(frameSize, std::move(transportPromise));
@@ -108,22 +118,34 @@ void MessageInStream::receiveFrameHeaderHandler(const common::DataConstBuffer& b
 void MessageInStream::receiveFrameSizeHandler(const common::DataConstBuffer& buffer)
 {
     auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_);
+    transportPromise->setHopCounter(&message_->getHopCounter());
     transportPromise->then(
-        [this, self = this->shared_from_this()](common::Data data) mutable {
+        [this](common::Data data) mutable {
             this->receiveFramePayloadHandler(common::DataConstBuffer(data));
         },
-        [this, self = this->shared_from_this()](const error::Error& e) mutable {
-            message_.reset();
-            promise_->reject(e);
-            promise_.reset();
+        [this](const error::Error& e) mutable {
+            this->rejectMessage(e);
         });
 
     FrameSize frameSize(buffer);
+
+    if(frameSize.getType() == FrameSizeType::EXTENDED && !this->isStreamingEnabled(message_->getChannelId()))
+    {
+        // The total size comes from the peer, so only up to the largest pooled class is reserved up front.
+        const auto maxReservedSize = MessagePool::getPayloadCapacity(PayloadSizeClass::VIDEO);
+        const auto totalSize = frameSize.getTotalSize();
+        messagePool_->reserve(*message_, totalSize < maxReservedSize ? totalSize : maxReservedSize);
+    }
+    else if(recentFrameType_ == FrameType::BULK || this->isStreamingEnabled(message_->getChannelId()))
+    {
+        messagePool_->reserve(*message_, frameSize.getSize());
+    }
+
     transport_->receive(frameSize.getSize(), std::move(transportPromise));
 }
 
 void MessageInStream::receiveFramePayloadHandler(const common::DataConstBuffer& buffer)
-{   
+{
     if(message_->getEncryptionType() == EncryptionType::ENCRYPTED)
     {
         try
@@ -132,9 +154,7 @@ void MessageInStream::receiveFramePayloadHandler(const common::DataConstBuffer&
         }
         catch(const error::Error& e)
         {
-            message_.reset();
-            promise_->reject(e);
-            promise_.reset();
+            this->rejectMessage(e);
             return;
         }
     }
@@ -145,26 +165,75 @@ void MessageInStream::receiveFramePayloadHandler(const common::DataConstBuffer&
 
     if(recentFrameType_ == FrameType::BULK || recentFrameType_ == FrameType::LAST)
     {
-        promise_->resolve(std::move(message_));
-        promise_.reset();
+        message_->setFragmentType(this->isStreamingEnabled(message_->getChannelId()) ? recentFrameType_ : FrameType::BULK);
+
+        // BULK frame never occupies the slot, a message pending on the same channel stays in it.
+        if(recentFrameType_ == FrameType::LAST)
+        {
+            reassemblyTable_[static_cast<uint8_t>(message_->getChannelId())].reset();
+        }
+
+        this->resolveMessage();
+    }
+    else if(this->isStreamingEnabled(message_->getChannelId()))
+    {
+        // Following frames of the message arrive into a fresh fragment.
+        reassemblyTable_[static_cast<uint8_t>(message_->getChannelId())] =
+                messagePool_->acquire(message_->getChannelId(), message_->getEncryptionType(), message_->getType());
+
+        message_->setFragmentType(recentFrameType_);
+        this->resolveMessage();
     }
     else
     {
+        message_.reset();
+
         auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_);
         transportPromise->then(
-            [this, self = this->shared_from_this()](common::Data data) mutable {
+            [this](common::Data data) mutable {
                 this->receiveFrameHeaderHandler(common::DataConstBuffer(data));
             },
-            [this, self = this->shared_from_this()](const error::Error& e) mutable {
-                message_.reset();
-                promise_->reject(e);
-                promise_.reset();
+            [this](const error::Error& e) mutable {
+                this->rejectMessage(e);
             });
 
         transport_->receive(FrameHeader::getSizeOf(), std::move(transportPromise));
     }
 }
 
+bool MessageInStream::isStreamingEnabled(ChannelId channelId) const
+{
+    return streamingChannels_.test(static_cast<uint8_t>(channelId));
+}
+
+void MessageInStream::resolveMessage()
+{
+    // Receive is over, the stream may go away once the promise is resolved.
+    auto self = std::move(self_);
+    auto promise = std::move(promise_);
+    promise->setHopCounter(&message_->getHopCounter());
+    promise->resolve(std::move(message_));
+}
+
+void MessageInStream::rejectMessage(const error::Error& e)
+{
+    if(message_ != nullptr)
+    {
+        auto& reassembly = reassemblyTable_[static_cast<uint8_t>(message_->getChannelId())];
+
+        if(reassembly == message_)
+        {
+            reassembly.reset();
+        }
+
+        message_.reset();
+    }
+
+    auto self = std::move(self_);
+    auto promise = std::move(promise_);
+    promise->reject(e);
+}
+
 }
 }
 }
@@ -36,6 +36,7 @@ using ::testing::_;
 using ::testing::SaveArg;
 using ::testing::SetArgReferee;
 using ::testing::Return;
+using ::testing::Invoke;
 
 class MessageInStreamUnitTest
 {
@@ -43,6 +44,7 @@ protected:
     MessageInStreamUnitTest()
         : transport_(&transportMock_, [](auto*) {})
         , cryptor_(&cryptorMock_, [](auto*) {})
+        , messagePool_(std::make_shared<MessagePool>())
         , receivePromise_(ReceivePromise::defer(ioService_))
     {
         receivePromise_->then(std::bind(&ReceivePromiseHandlerMock::onResolve, &receivePromiseHandlerMock_, std::placeholders::_1),
@@ -54,6 +56,7 @@ protected:
     transport::ITransport::Pointer transport_;
     CryptorMock cryptorMock_;
     ICryptor::Pointer cryptor_;
+    MessagePool::Pointer messagePool_;
     ReceivePromiseHandlerMock receivePromiseHandlerMock_;
     ReceivePromise::Pointer receivePromise_;
 };
@@ -66,7 +69,7 @@ ACTION(ThrowSSLReadException)
 
 BOOST_FIXTURE_TEST_CASE(MessageInStream_ReceivePlainMessage, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
 
     FrameHeader frameHeader(ChannelId::BLUETOOTH, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -106,11 +109,40 @@ BOOST_FIXTURE_TEST_CASE(MessageInStream_ReceivePlainMessage, MessageInStreamUnit
 
     const auto& payload = message->getPayload();
     BOOST_CHECK_EQUAL_COLLECTIONS(payload.begin(), payload.end(), framePayload.begin(), framePayload.end());
+
+    BOOST_CHECK_EQUAL(message->getHopCounter().getPostedCount(), 3u);
+    BOOST_CHECK_EQUAL(message->getHopCounter().getInlineCount(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(MessageInStream_HopsResolvedOnStreamStrandRunInline, MessageInStreamUnitTest)
+{
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
+
+    const auto resolveWith = [](common::Data data) {
+        return Invoke([data](size_t, transport::ITransport::ReceivePromise::Pointer promise) { promise->resolve(data); });
+    };
+
+    // Transport which has the data at hand resolves each receive on the stream strand.
+    common::Data framePayload(1000, 0x5E);
+    EXPECT_CALL(transportMock_, receive(_, _))
+            .WillOnce(resolveWith(FrameHeader(ChannelId::BLUETOOTH, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC).getData()))
+            .WillOnce(resolveWith(FrameSize(framePayload.size()).getData()))
+            .WillOnce(resolveWith(framePayload));
+
+    Message::Pointer message;
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(_)).WillOnce(SaveArg<0>(&message));
+
+    messageInStream->startReceive(std::move(receivePromise_));
+    ioService_.run();
+
+    BOOST_CHECK_EQUAL(message->getHopCounter().getPostedCount(), 1u);
+    BOOST_CHECK_EQUAL(message->getHopCounter().getInlineCount(), 2u);
 }
 
 BOOST_FIXTURE_TEST_CASE(MessageInStream_ReceiveEncryptedMessage, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
 
     FrameHeader frameHeader(ChannelId::VIDEO, FrameType::BULK, EncryptionType::ENCRYPTED, MessageType::CONTROL);
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -157,7 +189,7 @@ BOOST_FIXTURE_TEST_CASE(MessageInStream_ReceiveEncryptedMessage, MessageInStream
 
 BOOST_FIXTURE_TEST_CASE(MessageInStream_MessageDecryptionFailed, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
 
     FrameHeader frameHeader(ChannelId::VIDEO, FrameType::BULK, EncryptionType::ENCRYPTED, MessageType::CONTROL);
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -196,7 +228,7 @@ BOOST_FIXTURE_TEST_CASE(MessageInStream_MessageDecryptionFailed, MessageInStream
 
 BOOST_FIXTURE_TEST_CASE(MessageInStream_FramePayloadReceiveFailed, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
 
     FrameHeader frameHeader(ChannelId::BLUETOOTH, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -233,7 +265,7 @@ BOOST_FIXTURE_TEST_CASE(MessageInStream_FramePayloadReceiveFailed, MessageInStre
 
 BOOST_FIXTURE_TEST_CASE(MessageInStream_FramePayloadSizeReceiveFailed, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
 
     FrameHeader frameHeader(ChannelId::BLUETOOTH, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -261,7 +293,7 @@ BOOST_FIXTURE_TEST_CASE(MessageInStream_FramePayloadSizeReceiveFailed, MessageIn
 
 BOOST_FIXTURE_TEST_CASE(MessageInStream_FrameHeaderReceiveFailed, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
 
     FrameHeader frameHeader(ChannelId::BLUETOOTH, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -282,7 +314,7 @@ BOOST_FIXTURE_TEST_CASE(MessageInStream_FrameHeaderReceiveFailed, MessageInStrea
 
 BOOST_FIXTURE_TEST_CASE(MessageInStream_ReceiveSplittedMessage, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
     FrameHeader frame1Header(ChannelId::BLUETOOTH, FrameType::FIRST, EncryptionType::PLAIN, MessageType::SPECIFIC);
 
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -350,9 +382,158 @@ BOOST_FIXTURE_TEST_CASE(MessageInStream_ReceiveSplittedMessage, MessageInStreamU
     BOOST_CHECK_EQUAL_COLLECTIONS(payload.begin(), payload.end(), expectedPayload.begin(), expectedPayload.end());
 }
 
+BOOST_FIXTURE_TEST_CASE(MessageInStream_ReservationOfAnnouncedSizeIsCapped, MessageInStreamUnitTest)
+{
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
+    FrameHeader frame1Header(ChannelId::BLUETOOTH, FrameType::FIRST, EncryptionType::PLAIN, MessageType::SPECIFIC);
+
+    transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameHeader::getSizeOf(), _)).Times(2).WillRepeatedly(SaveArg<1>(&frameHeaderTransportPromise));
+
+    messageInStream->startReceive(std::move(receivePromise_));
+
+    ioService_.run();
+    ioService_.reset();
+
+    common::Data frame1Payload(1000, 0x5E);
+    common::Data frame2Payload(2000, 0x5F);
+    common::Data expectedPayload(frame1Payload.begin(), frame1Payload.end());
+    expectedPayload.insert(expectedPayload.end(), frame2Payload.begin(), frame2Payload.end());
+
+    transport::ITransport::ReceivePromise::Pointer frame1SizeTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameSize::getSizeOf(FrameSizeType::EXTENDED), _)).WillOnce(SaveArg<1>(&frame1SizeTransportPromise));
+    frameHeaderTransportPromise->resolve(frame1Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame1PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame1Payload.size(), _)).WillOnce(SaveArg<1>(&frame1PayloadTransportPromise));
+    // The announced total size is not trusted for the up-front reservation.
+    FrameSize frame1Size(frame1Payload.size(), 64 * 1024 * 1024);
+    frame1SizeTransportPromise->resolve(frame1Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    frame1PayloadTransportPromise->resolve(frame1Payload);
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame2SizeTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameSize::getSizeOf(FrameSizeType::SHORT), _)).WillOnce(SaveArg<1>(&frame2SizeTransportPromise));
+
+    FrameHeader frame2Header(ChannelId::BLUETOOTH, FrameType::LAST, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    frameHeaderTransportPromise->resolve(frame2Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame2PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame2Payload.size(), _)).WillOnce(SaveArg<1>(&frame2PayloadTransportPromise));
+    FrameSize frame2Size(frame2Payload.size());
+    frame2SizeTransportPromise->resolve(frame2Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer message;
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(_)).WillOnce(SaveArg<0>(&message));
+    frame2PayloadTransportPromise->resolve(frame2Payload);
+
+    ioService_.run();
+
+    BOOST_CHECK(message->getPayload().capacity() <= MessagePool::getPayloadCapacity(PayloadSizeClass::VIDEO));
+    const auto& payload = message->getPayload();
+    BOOST_CHECK_EQUAL_COLLECTIONS(payload.begin(), payload.end(), expectedPayload.begin(), expectedPayload.end());
+}
+
+BOOST_FIXTURE_TEST_CASE(MessageInStream_ReceiveStreamedMessage, MessageInStreamUnitTest)
+{
+    auto messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
+    messageInStream->setStreamingEnabled(ChannelId::VIDEO, true);
+    FrameHeader frame1Header(ChannelId::VIDEO, FrameType::FIRST, EncryptionType::PLAIN, MessageType::SPECIFIC);
+
+    transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameHeader::getSizeOf(), _)).Times(2).WillRepeatedly(SaveArg<1>(&frameHeaderTransportPromise));
+
+    messageInStream->startReceive(std::move(receivePromise_));
+
+    ioService_.run();
+    ioService_.reset();
+
+    common::Data frame1Payload(1000, 0x5E);
+    common::Data frame2Payload(2000, 0x5F);
+
+    transport::ITransport::ReceivePromise::Pointer frame1SizeTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameSize::getSizeOf(FrameSizeType::EXTENDED), _)).WillOnce(SaveArg<1>(&frame1SizeTransportPromise));
+    frameHeaderTransportPromise->resolve(frame1Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame1PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame1Payload.size(), _)).WillOnce(SaveArg<1>(&frame1PayloadTransportPromise));
+    FrameSize frame1Size(frame1Payload.size(), frame1Payload.size() + frame2Payload.size());
+    frame1SizeTransportPromise->resolve(frame1Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer firstFragment;
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(_)).WillOnce(SaveArg<0>(&firstFragment));
+    frame1PayloadTransportPromise->resolve(frame1Payload);
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK(firstFragment->getFragmentType() == FrameType::FIRST);
+    BOOST_CHECK_EQUAL_COLLECTIONS(firstFragment->getPayload().begin(), firstFragment->getPayload().end(), frame1Payload.begin(), frame1Payload.end());
+
+    ReceivePromiseHandlerMock secondReceivePromiseHandlerMock;
+    auto secondReceivePromise = ReceivePromise::defer(ioService_);
+    secondReceivePromise->then(std::bind(&ReceivePromiseHandlerMock::onResolve, &secondReceivePromiseHandlerMock, std::placeholders::_1),
+                               std::bind(&ReceivePromiseHandlerMock::onReject, &secondReceivePromiseHandlerMock, std::placeholders::_1));
+    messageInStream->startReceive(std::move(secondReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame2SizeTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameSize::getSizeOf(FrameSizeType::SHORT), _)).WillOnce(SaveArg<1>(&frame2SizeTransportPromise));
+
+    FrameHeader frame2Header(ChannelId::VIDEO, FrameType::LAST, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    frameHeaderTransportPromise->resolve(frame2Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame2PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame2Payload.size(), _)).WillOnce(SaveArg<1>(&frame2PayloadTransportPromise));
+    FrameSize frame2Size(frame2Payload.size());
+    frame2SizeTransportPromise->resolve(frame2Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer lastFragment;
+    EXPECT_CALL(secondReceivePromiseHandlerMock, onReject(_)).Times(0);
+    EXPECT_CALL(secondReceivePromiseHandlerMock, onResolve(_)).WillOnce(SaveArg<0>(&lastFragment));
+    frame2PayloadTransportPromise->resolve(frame2Payload);
+
+    ioService_.run();
+
+    BOOST_CHECK(lastFragment->getChannelId() == ChannelId::VIDEO);
+    BOOST_CHECK(lastFragment->getFragmentType() == FrameType::LAST);
+    BOOST_CHECK_EQUAL_COLLECTIONS(lastFragment->getPayload().begin(), lastFragment->getPayload().end(), frame2Payload.begin(), frame2Payload.end());
+}
+
 BOOST_FIXTURE_TEST_CASE(MessageInStream_IntertwinedChannels, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
     FrameHeader frame1Header(ChannelId::BLUETOOTH, FrameType::FIRST, EncryptionType::PLAIN, MessageType::SPECIFIC);
 
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -395,9 +576,215 @@ BOOST_FIXTURE_TEST_CASE(MessageInStream_IntertwinedChannels, MessageInStreamUnit
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(MessageInStream_InterleavedChannels, MessageInStreamUnitTest)
+{
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
+
+    // Frame header and short frame size have the same length, they are received one after another.
+    static_assert(FrameHeader::getSizeOf() == 2, "Unexpected frame header size");
+    transport::ITransport::ReceivePromise::Pointer shortTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameHeader::getSizeOf(), _)).Times(5).WillRepeatedly(SaveArg<1>(&shortTransportPromise));
+
+    messageInStream->startReceive(std::move(receivePromise_));
+
+    ioService_.run();
+    ioService_.reset();
+
+    common::Data frame1Payload(1000, 0x5E);
+    common::Data frame2Payload(2000, 0x5F);
+    common::Data frame3Payload(500, 0x60);
+    common::Data expectedPayload(frame1Payload.begin(), frame1Payload.end());
+    expectedPayload.insert(expectedPayload.end(), frame3Payload.begin(), frame3Payload.end());
+
+    FrameHeader frame1Header(ChannelId::BLUETOOTH, FrameType::FIRST, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    transport::ITransport::ReceivePromise::Pointer frame1SizeTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameSize::getSizeOf(FrameSizeType::EXTENDED), _)).WillOnce(SaveArg<1>(&frame1SizeTransportPromise));
+    shortTransportPromise->resolve(frame1Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame1PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame1Payload.size(), _)).WillOnce(SaveArg<1>(&frame1PayloadTransportPromise));
+    FrameSize frame1Size(frame1Payload.size(), frame1Payload.size() + frame3Payload.size());
+    frame1SizeTransportPromise->resolve(frame1Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    frame1PayloadTransportPromise->resolve(frame1Payload);
+
+    ioService_.run();
+    ioService_.reset();
+
+    FrameHeader frame2Header(ChannelId::VIDEO, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    shortTransportPromise->resolve(frame2Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame2PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame2Payload.size(), _)).WillOnce(SaveArg<1>(&frame2PayloadTransportPromise));
+    FrameSize frame2Size(frame2Payload.size());
+    shortTransportPromise->resolve(frame2Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer videoMessage;
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(_)).WillOnce(SaveArg<0>(&videoMessage));
+    frame2PayloadTransportPromise->resolve(frame2Payload);
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK(videoMessage->getChannelId() == ChannelId::VIDEO);
+    const auto& videoPayload = videoMessage->getPayload();
+    BOOST_CHECK_EQUAL_COLLECTIONS(videoPayload.begin(), videoPayload.end(), frame2Payload.begin(), frame2Payload.end());
+
+    ReceivePromiseHandlerMock secondReceivePromiseHandlerMock;
+    auto secondReceivePromise = ReceivePromise::defer(ioService_);
+    secondReceivePromise->then(std::bind(&ReceivePromiseHandlerMock::onResolve, &secondReceivePromiseHandlerMock, std::placeholders::_1),
+                              std::bind(&ReceivePromiseHandlerMock::onReject, &secondReceivePromiseHandlerMock, std::placeholders::_1));
+    messageInStream->startReceive(std::move(secondReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    FrameHeader frame3Header(ChannelId::BLUETOOTH, FrameType::LAST, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    shortTransportPromise->resolve(frame3Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame3PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame3Payload.size(), _)).WillOnce(SaveArg<1>(&frame3PayloadTransportPromise));
+    FrameSize frame3Size(frame3Payload.size());
+    shortTransportPromise->resolve(frame3Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer bluetoothMessage;
+    EXPECT_CALL(secondReceivePromiseHandlerMock, onReject(_)).Times(0);
+    EXPECT_CALL(secondReceivePromiseHandlerMock, onResolve(_)).WillOnce(SaveArg<0>(&bluetoothMessage));
+    frame3PayloadTransportPromise->resolve(frame3Payload);
+
+    ioService_.run();
+
+    BOOST_CHECK(bluetoothMessage->getChannelId() == ChannelId::BLUETOOTH);
+    const auto& bluetoothPayload = bluetoothMessage->getPayload();
+    BOOST_CHECK_EQUAL_COLLECTIONS(bluetoothPayload.begin(), bluetoothPayload.end(), expectedPayload.begin(), expectedPayload.end());
+    BOOST_CHECK(bluetoothPayload.capacity() >= expectedPayload.size());
+}
+
+BOOST_FIXTURE_TEST_CASE(MessageInStream_BulkBetweenFirstAndLast, MessageInStreamUnitTest)
+{
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
+
+    // Frame header and short frame size have the same length, they are received one after another.
+    static_assert(FrameHeader::getSizeOf() == 2, "Unexpected frame header size");
+    transport::ITransport::ReceivePromise::Pointer shortTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameHeader::getSizeOf(), _)).Times(5).WillRepeatedly(SaveArg<1>(&shortTransportPromise));
+
+    messageInStream->startReceive(std::move(receivePromise_));
+
+    ioService_.run();
+    ioService_.reset();
+
+    common::Data frame1Payload(1000, 0x5E);
+    common::Data frame2Payload(2000, 0x5F);
+    common::Data frame3Payload(500, 0x60);
+    common::Data expectedPayload(frame1Payload.begin(), frame1Payload.end());
+    expectedPayload.insert(expectedPayload.end(), frame3Payload.begin(), frame3Payload.end());
+
+    FrameHeader frame1Header(ChannelId::BLUETOOTH, FrameType::FIRST, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    transport::ITransport::ReceivePromise::Pointer frame1SizeTransportPromise;
+    EXPECT_CALL(transportMock_, receive(FrameSize::getSizeOf(FrameSizeType::EXTENDED), _)).WillOnce(SaveArg<1>(&frame1SizeTransportPromise));
+    shortTransportPromise->resolve(frame1Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame1PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame1Payload.size(), _)).WillOnce(SaveArg<1>(&frame1PayloadTransportPromise));
+    FrameSize frame1Size(frame1Payload.size(), frame1Payload.size() + frame3Payload.size());
+    frame1SizeTransportPromise->resolve(frame1Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    frame1PayloadTransportPromise->resolve(frame1Payload);
+
+    ioService_.run();
+    ioService_.reset();
+
+    FrameHeader frame2Header(ChannelId::BLUETOOTH, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    shortTransportPromise->resolve(frame2Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame2PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame2Payload.size(), _)).WillOnce(SaveArg<1>(&frame2PayloadTransportPromise));
+    FrameSize frame2Size(frame2Payload.size());
+    shortTransportPromise->resolve(frame2Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer bulkMessage;
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(_)).WillOnce(SaveArg<0>(&bulkMessage));
+    frame2PayloadTransportPromise->resolve(frame2Payload);
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK(bulkMessage->getChannelId() == ChannelId::BLUETOOTH);
+    const auto& bulkPayload = bulkMessage->getPayload();
+    BOOST_CHECK_EQUAL_COLLECTIONS(bulkPayload.begin(), bulkPayload.end(), frame2Payload.begin(), frame2Payload.end());
+
+    ReceivePromiseHandlerMock secondReceivePromiseHandlerMock;
+    auto secondReceivePromise = ReceivePromise::defer(ioService_);
+    secondReceivePromise->then(std::bind(&ReceivePromiseHandlerMock::onResolve, &secondReceivePromiseHandlerMock, std::placeholders::_1),
+                              std::bind(&ReceivePromiseHandlerMock::onReject, &secondReceivePromiseHandlerMock, std::placeholders::_1));
+    messageInStream->startReceive(std::move(secondReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    FrameHeader frame3Header(ChannelId::BLUETOOTH, FrameType::LAST, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    shortTransportPromise->resolve(frame3Header.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    transport::ITransport::ReceivePromise::Pointer frame3PayloadTransportPromise;
+    EXPECT_CALL(transportMock_, receive(frame3Payload.size(), _)).WillOnce(SaveArg<1>(&frame3PayloadTransportPromise));
+    FrameSize frame3Size(frame3Payload.size());
+    shortTransportPromise->resolve(frame3Size.getData());
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer splittedMessage;
+    EXPECT_CALL(secondReceivePromiseHandlerMock, onReject(_)).Times(0);
+    EXPECT_CALL(secondReceivePromiseHandlerMock, onResolve(_)).WillOnce(SaveArg<0>(&splittedMessage));
+    frame3PayloadTransportPromise->resolve(frame3Payload);
+
+    ioService_.run();
+
+    BOOST_CHECK(splittedMessage->getChannelId() == ChannelId::BLUETOOTH);
+    const auto& splittedPayload = splittedMessage->getPayload();
+    BOOST_CHECK_EQUAL_COLLECTIONS(splittedPayload.begin(), splittedPayload.end(), expectedPayload.begin(), expectedPayload.end());
+    BOOST_CHECK(splittedPayload.capacity() >= expectedPayload.size());
+}
+
 BOOST_FIXTURE_TEST_CASE(MessageInStream_RejectWhenInProgress, MessageInStreamUnitTest)
 {
-    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_));
+    MessageInStream::Pointer messageInStream(std::make_shared<MessageInStream>(ioService_, transport_, cryptor_, messagePool_));
 
     FrameHeader frameHeader(ChannelId::BLUETOOTH, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
     transport::ITransport::ReceivePromise::Pointer frameHeaderTransportPromise;
@@ -0,0 +1,170 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace bench
+{
+
+static std::chrono::nanoseconds getDuration(size_t size, size_t bytesPerSecond)
+{
+    return std::chrono::nanoseconds(size * 1000000000ull / bytesPerSecond);
+}
+
+// Wire of limited bandwidth, completes sends in order on its own thread. Transfer does not use the CPU, as with DMA.
+class LoopbackTransport: public transport::ITransport
+{
+public:
+    LoopbackTransport(boost::asio::io_service& wireService, size_t bytesPerSecond)
+        : wireStrand_(wireService)
+        , bytesPerSecond_(bytesPerSecond)
+    {
+
+    }
+
+    void receive(size_t, ReceivePromise::Pointer promise) override
+    {
+        promise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+    }
+
+    void send(common::Data data, SendPromise::Pointer promise) override
+    {
+        wireStrand_.post([this, size = data.size(), promise = std::move(promise)]() {
+            std::this_thread::sleep_for(getDuration(size, bytesPerSecond_));
+            promise->resolve();
+        });
+    }
+
+    void stop() override
+    {
+
+    }
+
+private:
+    boost::asio::io_service::strand wireStrand_;
+    size_t bytesPerSecond_;
+};
+
+// Stands in for TLS record encryption, costs CPU time in proportion to the payload.
+class LoopbackCryptor: public ICryptor
+{
+public:
+    LoopbackCryptor(size_t bytesPerSecond)
+        : bytesPerSecond_(bytesPerSecond)
+    {
+
+    }
+
+    void init() override {}
+    void deinit() override {}
+    bool doHandshake() override { return true; }
+    common::Data readHandshakeBuffer() override { return common::Data(); }
+    void writeHandshakeBuffer(const common::DataConstBuffer&) override {}
+    bool isActive() const override { return true; }
+
+    size_t encrypt(common::Data& output, const common::DataConstBuffer& buffer) override
+    {
+        const auto end = std::chrono::steady_clock::now() + getDuration(buffer.size, bytesPerSecond_);
+        while(std::chrono::steady_clock::now() < end);
+
+        output.insert(output.end(), buffer.cdata, buffer.cdata + buffer.size);
+        return buffer.size;
+    }
+
+    size_t decrypt(common::Data& output, const common::DataConstBuffer& buffer) override
+    {
+        output.insert(output.end(), buffer.cdata, buffer.cdata + buffer.size);
+        return buffer.size;
+    }
+
+private:
+    size_t bytesPerSecond_;
+};
+
+BOOST_AUTO_TEST_CASE(MessageOutStream_SendWindowThroughput)
+{
+    // Roughly USB 2.0 bulk throughput and software AES on a small ARM board.
+    const size_t wireBytesPerSecond = 35 * 1024 * 1024;
+    const size_t cryptorBytesPerSecond = 50 * 1024 * 1024;
+    const size_t messagesCount = 200;
+    const size_t messageSize = 64 * 1024;
+
+    for(size_t windowSize : {1, 2, 4, 8})
+    {
+        boost::asio::io_service ioService;
+        boost::asio::io_service wireService;
+        auto ioWork = std::make_shared<boost::asio::io_service::work>(ioService);
+        auto wireWork = std::make_shared<boost::asio::io_service::work>(wireService);
+        std::thread ioThread([&ioService]() { ioService.run(); });
+        std::thread wireThread([&wireService]() { wireService.run(); });
+
+        auto transport(std::make_shared<LoopbackTransport>(wireService, wireBytesPerSecond));
+        auto cryptor(std::make_shared<LoopbackCryptor>(cryptorBytesPerSecond));
+        auto messageOutStream(std::make_shared<MessageOutStream>(ioService, transport, cryptor));
+        auto messenger(std::make_shared<Messenger>(ioService, std::make_shared<MessageInStream>(ioService, transport, cryptor, std::make_shared<MessagePool>()), messageOutStream));
+        messageOutStream->setWindowSize(windowSize);
+        messenger->setSendWindow(windowSize);
+
+        std::atomic<size_t> sentCount(0);
+        const auto begin = std::chrono::steady_clock::now();
+
+        for(size_t i = 0; i < messagesCount; ++i)
+        {
+            auto message(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+            message->insertPayload(common::Data(messageSize, 0x5E));
+
+            auto promise = SendPromise::defer(ioService);
+            promise->then([&sentCount]() { ++sentCount; }, [](const error::Error&) {});
+            messenger->enqueueSend(std::move(message), std::move(promise));
+        }
+
+        while(sentCount < messagesCount)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+        std::cout << "[MessageOutStream] window: " << windowSize
+                  << ", throughput: " << (messagesCount * messageSize) / elapsed << " bytes/us" << std::endl;
+
+        ioWork.reset();
+        wireWork.reset();
+        ioThread.join();
+        wireThread.join();
+
+        BOOST_CHECK_EQUAL(sentCount, messagesCount);
+    }
+}
+
+}
+}
+}
+}
@@ -17,7 +17,6 @@
 */
 
 #include <boost/endian/conversion.hpp>
-#include <f1x/aasdk/IO/PromiseLink.hpp>
 #include <f1x/aasdk/Messenger/MessageOutStream.hpp>
 
 namespace f1x
@@ -31,8 +30,8 @@ MessageOutStream::MessageOutStream(boost::asio::io_service& ioService, transport
     : strand_(ioService)
     , transport_(std::move(transport))
     , cryptor_(std::move(cryptor))
-    , offset_(0)
-    , remainingSize_(0)
+    , inFlightFramesCount_(0)
+    , windowSize_(cDefaultWindowSize)
 {
 
 }
@@ -40,117 +39,146 @@ MessageOutStream::MessageOutStream(boost::asio::io_service& ioService, transport
 void MessageOutStream::stream(Message::Pointer message, SendPromise::Pointer promise)
 {
     strand_.dispatch([this, self = this->shared_from_this(), message = std::move(message), promise = std::move(promise)]() mutable {
-        if(promise_ != nullptr)
+        pendingMessages_.push_back(PendingMessage{std::move(message), std::move(promise), 0});
+        this->streamFrames();
+    });
+}
+
+void MessageOutStream::setWindowSize(size_t windowSize)
+{
+    strand_.dispatch([this, self = this->shared_from_this(), windowSize]() {
+        windowSize_ = windowSize > 0 ? windowSize : 1;
+        this->streamFrames();
+    });
+}
+
+void MessageOutStream::streamFrames()
+{
+    while(!pendingMessages_.empty() && inFlightFramesCount_ < windowSize_)
+    {
+        auto& pendingMessage = pendingMessages_.front();
+        auto promise = pendingMessage.promise;
+        const auto frameHeadroom = pendingMessage.message->getFrameHeadroom();
+        const auto payloadSize = pendingMessage.message->getFrameBuffer().size() - frameHeadroom;
+        const auto remainingSize = payloadSize - pendingMessage.offset;
+        const auto size = remainingSize < cMaxFramePayloadSize ? remainingSize : cMaxFramePayloadSize;
+
+        FrameType frameType = FrameType::BULK;
+
+        if(payloadSize >= cMaxFramePayloadSize)
         {
-            promise->reject(error::Error(error::ErrorCode::OPERATION_IN_PROGRESS));
-            return;
+            frameType = pendingMessage.offset == 0 ? FrameType::FIRST : (remainingSize - size > 0 ? FrameType::MIDDLE : FrameType::LAST);
         }
 
-        message_ = std::move(message);
-        promise_ = std::move(promise);
+        common::Data data;
 
-        if(message_->getPayload().size() >= cMaxFramePayloadSize)
+        try
         {
-            offset_ = 0;
-            remainingSize_ = message_->getPayload().size();
-            this->streamSplittedMessage();
+            const auto& payload = pendingMessage.message->getFrameBuffer();
+            data = this->compoundFrame(*pendingMessage.message, frameType, common::DataConstBuffer(payload.data() + frameHeadroom + pendingMessage.offset, size));
         }
-        else
+        catch(const error::Error& e)
         {
-            try
-            {
-                auto data(this->compoundFrame(FrameType::BULK, common::DataConstBuffer(message_->getPayload())));
-
-                auto transportPromise = transport::ITransport::SendPromise::defer(strand_);
-                io::PromiseLink<>::forward(*transportPromise, std::move(promise_));
-                transport_->send(std::move(data), std::move(transportPromise));
-            }
-            catch(const error::Error& e)
-            {
-                promise_->reject(e);
-                promise_.reset();
-            }
-
-            this->reset();
+            pendingMessages_.pop_front();
+            promise->reject(e);
+            continue;
         }
-    });
-}
-
-void MessageOutStream::streamSplittedMessage()
-{
-    try
-    {
-        const auto& payload = message_->getPayload();
-        auto ptr = &payload[offset_];
-        auto size = remainingSize_ < cMaxFramePayloadSize ? remainingSize_ : cMaxFramePayloadSize;
 
-        FrameType frameType = offset_ == 0 ? FrameType::FIRST : (remainingSize_ - size > 0 ? FrameType::MIDDLE : FrameType::LAST);
-        auto data(this->compoundFrame(frameType, common::DataConstBuffer(ptr, size)));
+        const bool lastFrame = frameType == FrameType::BULK || frameType == FrameType::LAST;
+        pendingMessage.offset += size;
 
-        auto transportPromise = transport::ITransport::SendPromise::defer(strand_);
-
-        if(frameType == FrameType::LAST)
+        if(lastFrame)
         {
-            this->reset();
-            io::PromiseLink<>::forward(*transportPromise, std::move(promise_));
+            pendingMessages_.pop_front();
         }
-        else
+
+        if(inFlightFramesCount_++ == 0)
         {
-            transportPromise->then([this, self = this->shared_from_this(), size]() mutable {
-                    offset_ += size;
-                    remainingSize_ -= size;
-                    this->streamSplittedMessage();
-                },
-                [this, self = this->shared_from_this()](const error::Error& e) mutable {
-                    this->reset();
-                    promise_->reject(e);
-                    promise_.reset();
-                });
+            self_ = this->shared_from_this();
         }
 
+        auto transportPromise = transport::ITransport::SendPromise::defer(strand_);
+        transportPromise->then([this, promise, lastFrame]() mutable {
+                this->frameSentHandler(promise, lastFrame);
+            },
+            [this, promise](const error::Error& e) mutable {
+                this->frameSendErrorHandler(promise, e);
+            });
+
         transport_->send(std::move(data), std::move(transportPromise));
     }
-    catch(const error::Error& e)
+}
+
+void MessageOutStream::frameSentHandler(const SendPromise::Pointer& promise, bool lastFrame)
+{
+    auto self = this->frameCompleted();
+
+    if(lastFrame)
+    {
+        promise->resolve();
+    }
+
+    this->streamFrames();
+}
+
+void MessageOutStream::frameSendErrorHandler(const SendPromise::Pointer& promise, const error::Error& e)
+{
+    auto self = this->frameCompleted();
+
+    // Remaining frames of a message that lost one of its frames must not reach the wire.
+    if(!pendingMessages_.empty() && pendingMessages_.front().promise == promise)
     {
-        this->reset();
-        promise_->reject(e);
-        promise_.reset();
+        pendingMessages_.pop_front();
     }
+
+    promise->reject(e);
+    this->streamFrames();
+}
+
+MessageOutStream::Pointer MessageOutStream::frameCompleted()
+{
+    // Last frame on the wire releases the stream, the caller holds it until its handler returns.
+    return --inFlightFramesCount_ == 0 ? std::move(self_) : nullptr;
 }
 
-common::Data MessageOutStream::compoundFrame(FrameType frameType, const common::DataConstBuffer& payloadBuffer)
+common::Data MessageOutStream::compoundFrame(Message& message, FrameType frameType, const common::DataConstBuffer& payloadBuffer)
 {
-    const FrameHeader frameHeader(message_->getChannelId(), frameType, message_->getEncryptionType(), message_->getType());
-    common::Data data(frameHeader.getData());
-    data.resize(data.size() + FrameSize::getSizeOf(frameType == FrameType::FIRST ? FrameSizeType::EXTENDED : FrameSizeType::SHORT));
+    const FrameHeader frameHeader(message.getChannelId(), frameType, message.getEncryptionType(), message.getType());
+    const size_t headerSize = FrameHeader::getSizeOf() + FrameSize::getSizeOf(frameType == FrameType::FIRST ? FrameSizeType::EXTENDED : FrameSizeType::SHORT);
+    const size_t totalSize = message.getFrameBuffer().size() - message.getFrameHeadroom();
+    common::Data data;
     size_t payloadSize = 0;
 
-    if(message_->getEncryptionType() == EncryptionType::ENCRYPTED)
+    if(message.getEncryptionType() == EncryptionType::ENCRYPTED)
     {
+        data.reserve(headerSize + payloadBuffer.size + cMaxEncryptionOverhead);
+        data.resize(headerSize, common::cDefaultInit);
         payloadSize = cryptor_->encrypt(data, payloadBuffer);
     }
+    else if(frameType == FrameType::BULK && message.getFrameHeadroom() == headerSize)
+    {
+        // Payload built behind frame headroom (see MessageBuilder) becomes the frame itself, the header is written in front of it.
+        data = std::move(message.getFrameBuffer());
+        message.setFrameHeadroom(0);
+        payloadSize = totalSize;
+    }
     else
     {
+        data.reserve(headerSize + payloadBuffer.size);
+        data.resize(headerSize, common::cDefaultInit);
         data.insert(data.end(), payloadBuffer.cdata, payloadBuffer.cdata + payloadBuffer.size);
         payloadSize = payloadBuffer.size;
     }
 
-    this->setFrameSize(data, frameType, payloadSize, message_->getPayload().size());
+    frameHeader.write(common::DataBuffer(data));
+    this->setFrameSize(data, frameType, payloadSize, totalSize);
     return data;
 }
 
 void MessageOutStream::setFrameSize(common::Data& data, FrameType frameType, size_t payloadSize, size_t totalSize)
 {
     const auto& frameSize = frameType == FrameType::FIRST ? FrameSize(payloadSize, totalSize) : FrameSize(payloadSize);
-    const auto& frameSizeData = frameSize.getData();
-    memcpy(&data[FrameHeader::getSizeOf()], &frameSizeData[0], frameSizeData.size());
-}
-
-void MessageOutStream::reset()
-{
-    offset_ = 0;
-    remainingSize_ = 0;
-    message_.reset();
+    frameSize.write(common::DataBuffer(data, FrameHeader::getSizeOf()));
 }
 
 }
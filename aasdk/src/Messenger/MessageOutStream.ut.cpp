@@ -22,6 +22,7 @@
 #include <f1x/aasdk/Messenger/UT/SendPromiseHandler.mock.hpp>
 #include <f1x/aasdk/Messenger/Promise.hpp>
 #include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
 
 namespace f1x
 {
@@ -93,6 +94,41 @@ BOOST_FIXTURE_TEST_CASE(MessageOutStream_SendPlainMessage, MessageOutStreamUnitT
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(MessageOutStream_SendBuiltPlainMessage, MessageOutStreamUnitTest)
+{
+    const common::Data payload(1000, 0x5E);
+    auto message = MessageBuilder(ChannelId::INPUT, EncryptionType::PLAIN, MessageType::SPECIFIC)
+            .setId(0x8001)
+            .setPayload(common::DataConstBuffer(payload))
+            .build();
+
+    const FrameHeader frameHeader(ChannelId::INPUT, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    const FrameSize frameSize(MessageId::getSizeOf() + payload.size());
+    common::Data expectedData(frameHeader.getData());
+    const auto& frameSizeData = frameSize.getData();
+    expectedData.insert(expectedData.end(), frameSizeData.begin(), frameSizeData.end());
+    const auto& messageIdData = MessageId(0x8001).getData();
+    expectedData.insert(expectedData.end(), messageIdData.begin(), messageIdData.end());
+    expectedData.insert(expectedData.end(), payload.begin(), payload.end());
+
+    transport::ITransport::SendPromise::Pointer transportSendPromise;
+    EXPECT_CALL(transportMock_, send(expectedData, _)).WillOnce(SaveArg<1>(&transportSendPromise));
+
+    MessageOutStream::Pointer messageOutStream(std::make_shared<MessageOutStream>(ioService_, transport_, cryptor_));
+    messageOutStream->stream(message, std::move(sendPromise_));
+
+    ioService_.run();
+    ioService_.reset();
+
+    // Frame buffer of the message became the frame.
+    BOOST_CHECK(message->getFrameBuffer().empty());
+
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
+    transportSendPromise->resolve();
+    ioService_.run();
+}
+
 BOOST_FIXTURE_TEST_CASE(MessageOutStream_SendEncryptedMessage, MessageOutStreamUnitTest)
 {
     const FrameHeader frameHeader(ChannelId::VIDEO, FrameType::BULK, EncryptionType::ENCRYPTED, MessageType::CONTROL);
@@ -193,34 +229,86 @@ BOOST_FIXTURE_TEST_CASE(MessageOutStream_SendSplittedMessage, MessageOutStreamUn
     expectedData1.insert(expectedData1.end(), frame1Payload.begin(), frame1Payload.end());
     EXPECT_CALL(transportMock_, send(expectedData1, _)).WillOnce(SaveArg<1>(&transportSendPromise));
 
-    MessageOutStream::Pointer messageOutStream(std::make_shared<MessageOutStream>(ioService_, transport_, cryptor_));
+    auto messageOutStream(std::make_shared<MessageOutStream>(ioService_, transport_, cryptor_));
+    messageOutStream->setWindowSize(1);
     messageOutStream->stream(message, std::move(sendPromise_));
 
     ioService_.run();
     ioService_.reset();
 
-    common::Data expectedData2(frame2HeaderData.begin(), frame2HeaderData.end());
-    expectedData2.insert(expectedData2.end(), frame2SizeData.begin(), frame2SizeData.end());
-    expectedData2.insert(expectedData2.end(), frame2Payload.begin(), frame2Payload.end());
-    EXPECT_CALL(transportMock_, send(expectedData2, _)).WillOnce(SaveArg<1>(&transportSendPromise));
+    const common::Data secondMessagePayload(10, 0x3A);
+    Message::Pointer secondMessage(std::make_shared<Message>(ChannelId::INPUT, EncryptionType::PLAIN, MessageType::SPECIFIC));
+    secondMessage->insertPayload(secondMessagePayload);
 
     auto secondSendPromise = SendPromise::defer(ioService_);
     SendPromiseHandlerMock secondSendPromiseHandlerMock;
     secondSendPromise->then(std::bind(&SendPromiseHandlerMock::onResolve, &secondSendPromiseHandlerMock),
                            std::bind(&SendPromiseHandlerMock::onReject, &secondSendPromiseHandlerMock, std::placeholders::_1));
 
-    EXPECT_CALL(secondSendPromiseHandlerMock, onResolve()).Times(0);
-    EXPECT_CALL(secondSendPromiseHandlerMock, onReject(error::Error(error::ErrorCode::OPERATION_IN_PROGRESS)));
-    messageOutStream->stream(message, std::move(secondSendPromise));
+    // Window is full, second message waits behind the frames of the first one.
+    messageOutStream->stream(secondMessage, std::move(secondSendPromise));
+    ioService_.run();
+    ioService_.reset();
+
+    common::Data expectedData2(frame2HeaderData.begin(), frame2HeaderData.end());
+    expectedData2.insert(expectedData2.end(), frame2SizeData.begin(), frame2SizeData.end());
+    expectedData2.insert(expectedData2.end(), frame2Payload.begin(), frame2Payload.end());
+    EXPECT_CALL(transportMock_, send(expectedData2, _)).WillOnce(SaveArg<1>(&transportSendPromise));
 
     transportSendPromise->resolve();
     ioService_.run();
     ioService_.reset();
 
+    const auto& secondMessageHeaderData = FrameHeader(ChannelId::INPUT, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC).getData();
+    const auto& secondMessageSizeData = FrameSize(secondMessagePayload.size()).getData();
+    common::Data expectedData3(secondMessageHeaderData.begin(), secondMessageHeaderData.end());
+    expectedData3.insert(expectedData3.end(), secondMessageSizeData.begin(), secondMessageSizeData.end());
+    expectedData3.insert(expectedData3.end(), secondMessagePayload.begin(), secondMessagePayload.end());
+    EXPECT_CALL(transportMock_, send(expectedData3, _)).WillOnce(SaveArg<1>(&transportSendPromise));
+
     EXPECT_CALL(sendPromiseHandlerMock_, onReject(_)).Times(0);
     EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
     transportSendPromise->resolve();
     ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(secondSendPromiseHandlerMock, onReject(_)).Times(0);
+    EXPECT_CALL(secondSendPromiseHandlerMock, onResolve());
+    transportSendPromise->resolve();
+    ioService_.run();
+}
+
+BOOST_FIXTURE_TEST_CASE(MessageOutStream_PipelinedFrames, MessageOutStreamUnitTest)
+{
+    const size_t maxFramePayloadSize = 0x4000;
+
+    Message::Pointer message(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::PLAIN, MessageType::SPECIFIC));
+    message->insertPayload(common::Data(maxFramePayloadSize * 3, 0x5E));
+
+    transport::ITransport::SendPromise::Pointer firstTransportSendPromise;
+    transport::ITransport::SendPromise::Pointer secondTransportSendPromise;
+    transport::ITransport::SendPromise::Pointer thirdTransportSendPromise;
+    EXPECT_CALL(transportMock_, send(_, _)).WillOnce(SaveArg<1>(&firstTransportSendPromise))
+            .WillOnce(SaveArg<1>(&secondTransportSendPromise))
+            .WillOnce(SaveArg<1>(&thirdTransportSendPromise));
+
+    MessageOutStream::Pointer messageOutStream(std::make_shared<MessageOutStream>(ioService_, transport_, cryptor_));
+    messageOutStream->stream(message, std::move(sendPromise_));
+
+    // All frames are on their way before the first one completes.
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve()).Times(0);
+    firstTransportSendPromise->resolve();
+    secondTransportSendPromise->resolve();
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
+    thirdTransportSendPromise->resolve();
+    ioService_.run();
 }
 
 }
@@ -0,0 +1,253 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Messenger/MessagePool.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+MessagePool::MessagePool(common::SessionArena::Pointer arena)
+    : arena_(std::move(arena))
+    , statistics_{}
+    , mutex_("MessagePool")
+{
+
+}
+
+MessagePool::~MessagePool()
+{
+    for(auto message : messages_)
+    {
+        destroy(arena_.get(), message);
+    }
+}
+
+Message::Pointer MessagePool::acquire(ChannelId channelId, EncryptionType encryptionType, MessageType type)
+{
+    Message* message = nullptr;
+
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+        if(!messages_.empty())
+        {
+            message = messages_.back();
+            messages_.pop_back();
+            ++statistics_.messageHits;
+        }
+        else
+        {
+            ++statistics_.messageMisses;
+        }
+    }
+
+    if(message == nullptr)
+    {
+        message = arena_ == nullptr ? new Message(channelId, encryptionType, type)
+                                    : new(arena_->allocate(sizeof(Message))) Message(channelId, encryptionType, type);
+    }
+    else
+    {
+        *message = Message(channelId, encryptionType, type);
+    }
+
+    std::weak_ptr<MessagePool> pool(this->shared_from_this());
+
+    if(arena_ == nullptr)
+    {
+        return Message::Pointer(message, [pool](Message* message) { MessagePool::release(pool, nullptr, message); });
+    }
+
+    // The allocator stored with the reference count keeps the arena alive until the deleter has run.
+    return Message::Pointer(message, [pool, arena = arena_.get()](Message* message) { MessagePool::release(pool, arena, message); },
+                            common::SessionArenaAllocator<Message>(arena_));
+}
+
+void MessagePool::reserve(Message& message, size_t size)
+{
+    auto& payload = message.getPayload();
+
+    if(payload.capacity() >= size)
+    {
+        return;
+    }
+
+    for(size_t i = 0; i < cPayloadSizeClassesCount; ++i)
+    {
+        const auto sizeClass = static_cast<PayloadSizeClass>(i);
+        const auto capacity = getPayloadCapacity(sizeClass);
+
+        if(size <= capacity)
+        {
+            common::Data buffer;
+
+            {
+                std::lock_guard<decltype(mutex_)> lock(mutex_);
+                auto& freeList = payloads_[i];
+
+                if(!freeList.empty())
+                {
+                    buffer = std::move(freeList.back());
+                    freeList.pop_back();
+                    ++statistics_.payloadHits[i];
+                }
+                else
+                {
+                    ++statistics_.payloadMisses[i];
+                }
+            }
+
+            buffer.reserve(capacity);
+            buffer.insert(buffer.end(), payload.begin(), payload.end());
+            payload.swap(buffer);
+            return;
+        }
+    }
+
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        ++statistics_.unpooledPayloads;
+    }
+
+    payload.reserve(size);
+}
+
+MessagePool::Statistics MessagePool::getStatistics() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return statistics_;
+}
+
+void MessagePool::dump() const
+{
+    const auto statistics = this->getStatistics();
+
+    AASDK_LOG(info) << "[MessagePool] messages, hits: " << statistics.messageHits
+                    << ", misses: " << statistics.messageMisses
+                    << ", unpooled payloads: " << statistics.unpooledPayloads;
+
+    for(size_t i = 0; i < cPayloadSizeClassesCount; ++i)
+    {
+        AASDK_LOG(info) << "[MessagePool] payload capacity: " << getPayloadCapacity(static_cast<PayloadSizeClass>(i))
+                        << ", hits: " << statistics.payloadHits[i]
+                        << ", misses: " << statistics.payloadMisses[i];
+    }
+}
+
+size_t MessagePool::getPayloadCapacity(PayloadSizeClass sizeClass)
+{
+    switch(sizeClass)
+    {
+    case PayloadSizeClass::SMALL:
+        return 1024;
+    case PayloadSizeClass::AUDIO:
+        return 16 * 1024;
+    default:
+        return 512 * 1024;
+    }
+}
+
+size_t MessagePool::getMaxPooledPayloads(PayloadSizeClass sizeClass)
+{
+    switch(sizeClass)
+    {
+    case PayloadSizeClass::SMALL:
+        return 64;
+    case PayloadSizeClass::AUDIO:
+        return 32;
+    default:
+        return 8;
+    }
+}
+
+void MessagePool::release(std::weak_ptr<MessagePool> pool, common::SessionArena* arena, Message* message)
+{
+    auto lockedPool = pool.lock();
+
+    if(lockedPool != nullptr)
+    {
+        lockedPool->release(message);
+    }
+    else
+    {
+        destroy(arena, message);
+    }
+}
+
+void MessagePool::destroy(common::SessionArena* arena, Message* message)
+{
+    if(arena == nullptr)
+    {
+        delete message;
+    }
+    else
+    {
+        message->~Message();
+        arena->deallocate(message, sizeof(Message));
+    }
+}
+
+void MessagePool::release(Message* message)
+{
+    // Buffers outside of the size classes are freed here, after the lock is released.
+    common::Data payload;
+    payload.swap(message->getPayload());
+    payload.clear();
+
+    bool pooled = false;
+
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+        for(size_t i = cPayloadSizeClassesCount; i-- > 0;)
+        {
+            const auto sizeClass = static_cast<PayloadSizeClass>(i);
+            const auto capacity = getPayloadCapacity(sizeClass);
+
+            if(payload.capacity() >= capacity)
+            {
+                if(payload.capacity() < capacity * 2 && payloads_[i].size() < getMaxPooledPayloads(sizeClass))
+                {
+                    payloads_[i].push_back(std::move(payload));
+                }
+
+                break;
+            }
+        }
+
+        if(messages_.size() < cMaxPooledMessages)
+        {
+            messages_.push_back(message);
+            pooled = true;
+        }
+    }
+
+    if(!pooled)
+    {
+        destroy(arena_.get(), message);
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,122 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Messenger/MessagePool.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(MessagePool_ReuseReleasedMessage)
+{
+    auto messagePool = std::make_shared<MessagePool>();
+
+    auto message = messagePool->acquire(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    messagePool->reserve(*message, 20000);
+    message->getPayload().resize(20000, 0x5A);
+    message->getHopCounter().addPosted();
+
+    const auto* rawMessage = message.get();
+    const auto* rawPayload = message->getPayload().data();
+    message.reset();
+
+    message = messagePool->acquire(ChannelId::CONTROL, EncryptionType::PLAIN, MessageType::CONTROL);
+    BOOST_CHECK_EQUAL(message.get(), rawMessage);
+    BOOST_CHECK(message->getChannelId() == ChannelId::CONTROL);
+    BOOST_CHECK(message->getEncryptionType() == EncryptionType::PLAIN);
+    BOOST_CHECK(message->getType() == MessageType::CONTROL);
+    BOOST_CHECK(message->getPayload().empty());
+    BOOST_CHECK_EQUAL(message->getHopCounter().getPostedCount(), 0u);
+
+    messagePool->reserve(*message, 30000);
+    BOOST_CHECK_EQUAL(message->getPayload().data(), rawPayload);
+    BOOST_CHECK_EQUAL(message->getPayload().capacity(), MessagePool::getPayloadCapacity(PayloadSizeClass::VIDEO));
+
+    const auto statistics = messagePool->getStatistics();
+    BOOST_CHECK_EQUAL(statistics.messageHits, 1u);
+    BOOST_CHECK_EQUAL(statistics.messageMisses, 1u);
+    BOOST_CHECK_EQUAL(statistics.payloadHits[static_cast<size_t>(PayloadSizeClass::VIDEO)], 1u);
+    BOOST_CHECK_EQUAL(statistics.payloadMisses[static_cast<size_t>(PayloadSizeClass::VIDEO)], 1u);
+}
+
+BOOST_AUTO_TEST_CASE(MessagePool_SelectSizeClass)
+{
+    auto messagePool = std::make_shared<MessagePool>();
+
+    auto smallMessage = messagePool->acquire(ChannelId::INPUT, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    messagePool->reserve(*smallMessage, 10);
+    auto audioMessage = messagePool->acquire(ChannelId::MEDIA_AUDIO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    messagePool->reserve(*audioMessage, 4000);
+    auto hugeMessage = messagePool->acquire(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    messagePool->reserve(*hugeMessage, 1024 * 1024);
+
+    BOOST_CHECK_EQUAL(smallMessage->getPayload().capacity(), MessagePool::getPayloadCapacity(PayloadSizeClass::SMALL));
+    BOOST_CHECK_EQUAL(audioMessage->getPayload().capacity(), MessagePool::getPayloadCapacity(PayloadSizeClass::AUDIO));
+    BOOST_CHECK(hugeMessage->getPayload().capacity() >= 1024u * 1024u);
+
+    const auto statistics = messagePool->getStatistics();
+    BOOST_CHECK_EQUAL(statistics.payloadMisses[static_cast<size_t>(PayloadSizeClass::SMALL)], 1u);
+    BOOST_CHECK_EQUAL(statistics.payloadMisses[static_cast<size_t>(PayloadSizeClass::AUDIO)], 1u);
+    BOOST_CHECK_EQUAL(statistics.payloadMisses[static_cast<size_t>(PayloadSizeClass::VIDEO)], 0u);
+    BOOST_CHECK_EQUAL(statistics.unpooledPayloads, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(MessagePool_ReleaseMessageAfterPoolDestroyed)
+{
+    auto messagePool = std::make_shared<MessagePool>();
+    auto message = messagePool->acquire(ChannelId::CONTROL, EncryptionType::PLAIN, MessageType::CONTROL);
+    messagePool->reserve(*message, 100);
+    message->getPayload().resize(100);
+
+    messagePool.reset();
+    BOOST_CHECK(message->getChannelId() == ChannelId::CONTROL);
+    message.reset();
+}
+
+BOOST_AUTO_TEST_CASE(MessagePool_AllocateMessagesFromSessionArena)
+{
+    auto arena = std::make_shared<common::SessionArena>();
+    std::weak_ptr<common::SessionArena> weakArena(arena);
+    auto messagePool = std::make_shared<MessagePool>(arena);
+    arena.reset();
+
+    auto message = messagePool->acquire(ChannelId::CONTROL, EncryptionType::PLAIN, MessageType::CONTROL);
+    // Message and its reference count.
+    BOOST_CHECK_EQUAL(weakArena.lock()->getStatistics().allocatedBlocksCount, 2u);
+
+    message.reset();
+    message = messagePool->acquire(ChannelId::INPUT, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    BOOST_CHECK_EQUAL(weakArena.lock()->getStatistics().allocatedBlocksCount, 2u);
+
+    messagePool.reset();
+    BOOST_CHECK(!weakArena.expired());
+
+    message.reset();
+    BOOST_CHECK(weakArena.expired());
+}
+
+}
+}
+}
+}
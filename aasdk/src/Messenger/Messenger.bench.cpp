@@ -0,0 +1,285 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+#include <f1x/aasdk/TCP/ITCPEndpoint.hpp>
+#include <f1x/aasdk/Transport/TCPTransport.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace bench
+{
+
+// Replays the same plain frame the given number of times and swallows everything sent.
+// All operations complete immediately, so only the cost of the handler chains is measured.
+// Once the frames run out the receive stays pending until stop().
+class ReplayTransport: public transport::ITransport
+{
+public:
+    ReplayTransport(common::Data frame, size_t framesCount)
+        : frame_(std::move(frame))
+        , remainingFramesCount_(framesCount)
+        , offset_(0)
+    {
+
+    }
+
+    void receive(size_t size, ReceivePromise::Pointer promise) override
+    {
+        if(remainingFramesCount_ == 0)
+        {
+            pendingPromise_ = std::move(promise);
+            return;
+        }
+
+        common::Data data(frame_.begin() + offset_, frame_.begin() + offset_ + size);
+        offset_ += size;
+
+        if(offset_ == frame_.size())
+        {
+            offset_ = 0;
+            --remainingFramesCount_;
+        }
+
+        promise->resolve(std::move(data));
+    }
+
+    void send(common::Data, SendPromise::Pointer promise) override
+    {
+        promise->resolve();
+    }
+
+    void stop() override
+    {
+        if(pendingPromise_ != nullptr)
+        {
+            pendingPromise_->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+            pendingPromise_.reset();
+        }
+    }
+
+private:
+    common::Data frame_;
+    size_t remainingFramesCount_;
+    size_t offset_;
+    ReceivePromise::Pointer pendingPromise_;
+};
+
+// Endpoint under a real TCPTransport which fills every read with the next bytes of the frame stream
+// and completes all reads and writes immediately.
+class ReplayTCPEndpoint: public tcp::ITCPEndpoint
+{
+public:
+    ReplayTCPEndpoint(common::Data frame, size_t framesCount)
+        : frame_(std::move(frame))
+        , remainingSize_(frame_.size() * framesCount)
+        , offset_(0)
+    {
+
+    }
+
+    void send(common::DataConstBuffer buffer, Promise::Pointer promise) override
+    {
+        promise->resolve(buffer.size);
+    }
+
+    void receive(common::DataBuffer buffer, Promise::Pointer promise) override
+    {
+        if(remainingSize_ == 0)
+        {
+            pendingPromise_ = std::move(promise);
+            return;
+        }
+
+        const auto size = std::min(buffer.size, remainingSize_);
+
+        for(size_t copied = 0; copied < size;)
+        {
+            const auto chunkSize = std::min(size - copied, frame_.size() - offset_);
+            memcpy(buffer.data + copied, frame_.data() + offset_, chunkSize);
+            copied += chunkSize;
+            offset_ = (offset_ + chunkSize) % frame_.size();
+        }
+
+        remainingSize_ -= size;
+        promise->resolve(size);
+    }
+
+    void stop() override
+    {
+        if(pendingPromise_ != nullptr)
+        {
+            pendingPromise_->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+            pendingPromise_.reset();
+        }
+    }
+
+private:
+    common::Data frame_;
+    size_t remainingSize_;
+    size_t offset_;
+    Promise::Pointer pendingPromise_;
+};
+
+static common::Data createFrame(size_t payloadSize)
+{
+    common::Data frame(FrameHeader(ChannelId::SENSOR, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC).getData());
+    const auto frameSize = FrameSize(payloadSize).getData();
+    frame.insert(frame.end(), frameSize.begin(), frameSize.end());
+    frame.resize(frame.size() + payloadSize, 0x5E);
+    return frame;
+}
+
+BOOST_AUTO_TEST_CASE(Messenger_ReceiveCostPerMessage)
+{
+    const size_t messagesCount = 200000;
+
+    boost::asio::io_service ioService;
+    boost::asio::io_service::strand strand(ioService);
+    auto transport(std::make_shared<ReplayTransport>(createFrame(64), messagesCount));
+    auto messenger(std::make_shared<Messenger>(ioService,
+                                               std::make_shared<MessageInStream>(ioService, transport, nullptr, std::make_shared<MessagePool>()),
+                                               std::make_shared<MessageOutStream>(ioService, transport, nullptr)));
+
+    size_t receivedCount = 0;
+    messenger->subscribe(ChannelId::SENSOR, std::make_shared<ChannelSubscription>(strand, [&receivedCount](Message::Pointer) { ++receivedCount; },
+                                                                                  [](const error::Error&) {}));
+
+    const auto begin = std::chrono::steady_clock::now();
+    ioService.run();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "[Messenger] receive, messages: " << receivedCount << ", ns per message: " << elapsed / messagesCount << std::endl;
+    BOOST_CHECK_EQUAL(receivedCount, messagesCount);
+
+    transport->stop();
+    ioService.reset();
+    ioService.run();
+}
+
+BOOST_AUTO_TEST_CASE(Messenger_SendCostPerMessage)
+{
+    const size_t messagesCount = 200000;
+
+    boost::asio::io_service ioService;
+    auto transport(std::make_shared<ReplayTransport>(common::Data(), 0));
+    auto messenger(std::make_shared<Messenger>(ioService,
+                                               std::make_shared<MessageInStream>(ioService, transport, nullptr, std::make_shared<MessagePool>()),
+                                               std::make_shared<MessageOutStream>(ioService, transport, nullptr)));
+
+    size_t sentCount = 0;
+    const auto begin = std::chrono::steady_clock::now();
+
+    for(size_t i = 0; i < messagesCount; ++i)
+    {
+        auto message(std::make_shared<Message>(ChannelId::SENSOR, EncryptionType::PLAIN, MessageType::SPECIFIC));
+        message->insertPayload(common::Data(64, 0x5E));
+
+        auto promise = SendPromise::defer(ioService);
+        promise->then([&sentCount]() { ++sentCount; }, [](const error::Error&) {});
+        messenger->enqueueSend(std::move(message), std::move(promise));
+
+        // Keeps the send queue short, as in a session where the transport keeps up.
+        ioService.poll();
+        ioService.reset();
+    }
+
+    ioService.run();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "[Messenger] send, messages: " << sentCount << ", ns per message: " << elapsed / messagesCount << std::endl;
+    BOOST_CHECK_EQUAL(sentCount, messagesCount);
+}
+
+BOOST_AUTO_TEST_CASE(Messenger_ReceiveCostPerMessageThroughTransport)
+{
+    const size_t messagesCount = 200000;
+
+    boost::asio::io_service ioService;
+    boost::asio::io_service::strand strand(ioService);
+    auto tcpEndpoint(std::make_shared<ReplayTCPEndpoint>(createFrame(64), messagesCount));
+    auto transport(std::make_shared<transport::TCPTransport>(ioService, tcpEndpoint));
+    auto messenger(std::make_shared<Messenger>(ioService,
+                                               std::make_shared<MessageInStream>(ioService, transport, nullptr, std::make_shared<MessagePool>()),
+                                               std::make_shared<MessageOutStream>(ioService, transport, nullptr)));
+
+    size_t receivedCount = 0;
+    messenger->subscribe(ChannelId::SENSOR, std::make_shared<ChannelSubscription>(strand, [&receivedCount](Message::Pointer) { ++receivedCount; },
+                                                                                  [](const error::Error&) {}));
+
+    const auto begin = std::chrono::steady_clock::now();
+    ioService.run();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "[Messenger] receive through TCPTransport, messages: " << receivedCount << ", ns per message: " << elapsed / messagesCount << std::endl;
+    BOOST_CHECK_EQUAL(receivedCount, messagesCount);
+
+    transport->stop();
+    ioService.reset();
+    ioService.run();
+}
+
+BOOST_AUTO_TEST_CASE(Messenger_SendCostPerMessageThroughTransport)
+{
+    const size_t messagesCount = 200000;
+
+    boost::asio::io_service ioService;
+    auto tcpEndpoint(std::make_shared<ReplayTCPEndpoint>(createFrame(64), 0));
+    auto transport(std::make_shared<transport::TCPTransport>(ioService, tcpEndpoint));
+    auto messenger(std::make_shared<Messenger>(ioService,
+                                               std::make_shared<MessageInStream>(ioService, transport, nullptr, std::make_shared<MessagePool>()),
+                                               std::make_shared<MessageOutStream>(ioService, transport, nullptr)));
+
+    size_t sentCount = 0;
+    const auto begin = std::chrono::steady_clock::now();
+
+    for(size_t i = 0; i < messagesCount; ++i)
+    {
+        auto message(std::make_shared<Message>(ChannelId::SENSOR, EncryptionType::PLAIN, MessageType::SPECIFIC));
+        message->insertPayload(common::Data(64, 0x5E));
+
+        auto promise = SendPromise::defer(ioService);
+        promise->then([&sentCount]() { ++sentCount; }, [](const error::Error&) {});
+        messenger->enqueueSend(std::move(message), std::move(promise));
+
+        ioService.poll();
+        ioService.reset();
+    }
+
+    ioService.run();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "[Messenger] send through TCPTransport, messages: " << sentCount << ", ns per message: " << elapsed / messagesCount << std::endl;
+    BOOST_CHECK_EQUAL(sentCount, messagesCount);
+}
+
+}
+}
+}
+}
@@ -16,8 +16,10 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <bitset>
 #include <boost/endian/conversion.hpp>
 #include <f1x/aasdk/Error/Error.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
 #include <f1x/aasdk/Messenger/Messenger.hpp>
 
 namespace f1x
@@ -32,6 +34,16 @@ Messenger::Messenger(boost::asio::io_service& ioService, IMessageInStream::Point
     , sendStrand_(ioService)
     , messageInStream_(std::move(messageInStream))
     , messageOutStream_(std::move(messageOutStream))
+    , channelSendPromiseQueue_(cDefaultSendQueueCapacity)
+    , hopProfiler_(std::make_shared<HopProfiler>())
+    , subscriptionsCount_(0)
+    , blockedSubscriptionsCount_(0)
+    , inStreamReceiveInProgress_(false)
+    , inFlightSendsCount_(0)
+    , sendWindow_(cDefaultSendWindow)
+    , sendGeneration_(0)
+    , outStreamSendsCount_(0)
+    , unreportedSendErrorsCount_(0)
 {
 
 }
@@ -41,20 +53,14 @@ void Messenger::enqueueReceive(ChannelId channelId, ReceivePromise::Pointer prom
     receiveStrand_.dispatch([this, self = this->shared_from_this(), channelId, promise = std::move(promise)]() mutable {
         if(!channelReceiveMessageQueue_.empty(channelId))
         {
-            promise->resolve(std::move(channelReceiveMessageQueue_.pop(channelId)));
+            this->resolveReceivePromise(std::move(promise), channelReceiveMessageQueue_.pop(channelId));
         }
         else
         {
             channelReceivePromiseQueue_.push(channelId, std::move(promise));
-
-            if(channelReceivePromiseQueue_.size() == 1)
-            {
-                auto inStreamPromise = ReceivePromise::defer(receiveStrand_);
-                inStreamPromise->then(std::bind(&Messenger::inStreamMessageHandler, this->shared_from_this(), std::placeholders::_1),
-                                     std::bind(&Messenger::rejectReceivePromiseQueue, this->shared_from_this(), std::placeholders::_1));
-                messageInStream_->startReceive(std::move(inStreamPromise));
-            }
         }
+
+        this->receiveFromInStream();
     });
 }
 
@@ -62,72 +68,281 @@ void Messenger::enqueueSend(Message::Pointer message, SendPromise::Pointer promi
 {
     sendStrand_.dispatch([this, self = this->shared_from_this(), message = std::move(message), promise = std::move(promise)]() mutable {
         channelSendPromiseQueue_.emplace_back(std::make_pair(std::move(message), std::move(promise)));
+        this->doSend();
+    });
+}
+
+void Messenger::enqueueSend(Message::Pointer message)
+{
+    this->enqueueSend(std::move(message), nullptr);
+}
 
-        if(channelSendPromiseQueue_.size() == 1)
+void Messenger::setSendErrorHandler(ChannelId channelId, SendErrorHandler errorHandler)
+{
+    sendStrand_.dispatch([this, self = this->shared_from_this(), channelId, errorHandler = std::move(errorHandler)]() mutable {
+        channelSendErrorHandlers_[static_cast<size_t>(channelId)] = std::move(errorHandler);
+    });
+}
+
+void Messenger::subscribe(ChannelId channelId, ChannelSubscription::Pointer subscription)
+{
+    receiveStrand_.dispatch([this, self = this->shared_from_this(), channelId, subscription = std::move(subscription)]() mutable {
+        auto& channelSubscription = channelSubscriptions_[static_cast<size_t>(channelId)];
+
+        if(channelSubscription != nullptr)
+        {
+            this->cancelSubscription(channelSubscription);
+        }
+        else
         {
-            this->doSend();
+            ++subscriptionsCount_;
+        }
+
+        std::weak_ptr<Messenger> weakSelf(self);
+        subscription->setDrainHandler([this, weakSelf]() {
+            if(auto self = weakSelf.lock())
+            {
+                receiveStrand_.dispatch(std::bind(&Messenger::subscriptionDrainHandler, std::move(self)));
+            }
+        });
+        subscription->setHopProfiler(hopProfiler_);
+        channelSubscription = std::move(subscription);
+
+        while(!channelReceiveMessageQueue_.empty(channelId))
+        {
+            this->deliverToSubscription(channelReceiveMessageQueue_.pop(channelId));
+        }
+
+        this->receiveFromInStream();
+    });
+}
+
+void Messenger::unsubscribe(ChannelId channelId)
+{
+    receiveStrand_.dispatch([this, self = this->shared_from_this(), channelId]() {
+        auto& channelSubscription = channelSubscriptions_[static_cast<size_t>(channelId)];
+
+        if(channelSubscription != nullptr)
+        {
+            this->cancelSubscription(channelSubscription);
+            channelSubscription.reset();
+            --subscriptionsCount_;
+            this->receiveFromInStream();
         }
     });
 }
 
+void Messenger::receiveFromInStream()
+{
+    const bool receiverAvailable = !channelReceivePromiseQueue_.empty() || subscriptionsCount_ > 0;
+
+    if(!inStreamReceiveInProgress_ && receiverAvailable && !channelReceiveMessageQueue_.isBlocked() && blockedSubscriptionsCount_ == 0)
+    {
+        inStreamReceiveInProgress_ = true;
+
+        if(receiveSelf_ == nullptr)
+        {
+            receiveSelf_ = this->shared_from_this();
+        }
+
+        auto inStreamPromise = ReceivePromise::defer(receiveStrand_);
+        inStreamPromise->then([this](Message::Pointer message) { this->inStreamMessageHandler(std::move(message)); },
+                              [this](const error::Error& e) { this->rejectReceivePromiseQueue(e); });
+        messageInStream_->startReceive(std::move(inStreamPromise));
+    }
+}
+
 void Messenger::inStreamMessageHandler(Message::Pointer message)
 {
+    inStreamReceiveInProgress_ = false;
     auto channelId = message->getChannelId();
 
     if(channelReceivePromiseQueue_.isPending(channelId))
     {
-        channelReceivePromiseQueue_.pop(channelId)->resolve(std::move(message));
+        this->resolveReceivePromise(channelReceivePromiseQueue_.pop(channelId), std::move(message));
+    }
+    else if(channelSubscriptions_[static_cast<size_t>(channelId)] != nullptr)
+    {
+        this->deliverToSubscription(std::move(message));
     }
     else
     {
         channelReceiveMessageQueue_.push(std::move(message));
     }
 
-    if(!channelReceivePromiseQueue_.empty())
+    this->receiveFromInStream();
+
+    if(!inStreamReceiveInProgress_)
     {
-        auto inStreamPromise = ReceivePromise::defer(receiveStrand_);
-        inStreamPromise->then(std::bind(&Messenger::inStreamMessageHandler, this->shared_from_this(), std::placeholders::_1),
-                             std::bind(&Messenger::rejectReceivePromiseQueue, this->shared_from_this(), std::placeholders::_1));
-        messageInStream_->startReceive(std::move(inStreamPromise));
+        auto self = std::move(receiveSelf_);
+    }
+}
+
+void Messenger::resolveReceivePromise(ReceivePromise::Pointer promise, Message::Pointer message)
+{
+    // The receiver owns the message once the promise is settled, so the hop onto its strand is counted into a copy.
+    io::HopCounter hopCounter(message->getHopCounter());
+    const auto channelId = message->getChannelId();
+    const auto messageId = HopProfiler::getMessageId(*message);
+
+    promise->setHopCounter(&hopCounter);
+    promise->resolve(std::move(message));
+    hopProfiler_->record(channelId, messageId, hopCounter);
+}
+
+void Messenger::deliverToSubscription(Message::Pointer message)
+{
+    auto channelId = message->getChannelId();
+    auto& subscription = channelSubscriptions_[static_cast<size_t>(channelId)];
+
+    if(subscription->push(std::move(message), channelReceiveMessageQueue_.getCapacity(channelId), channelReceiveMessageQueue_.getPolicy(channelId)))
+    {
+        ++blockedSubscriptionsCount_;
+    }
+}
+
+void Messenger::subscriptionDrainHandler()
+{
+    if(blockedSubscriptionsCount_ > 0)
+    {
+        --blockedSubscriptionsCount_;
     }
+
+    this->receiveFromInStream();
+}
+
+void Messenger::cancelSubscription(const ChannelSubscription::Pointer& subscription)
+{
+    if(subscription->cancel() && blockedSubscriptionsCount_ > 0)
+    {
+        --blockedSubscriptionsCount_;
+    }
+}
+
+void Messenger::clearSubscriptions()
+{
+    for(auto& subscription : channelSubscriptions_)
+    {
+        if(subscription != nullptr)
+        {
+            subscription->cancel();
+            subscription.reset();
+        }
+    }
+
+    subscriptionsCount_ = 0;
+    blockedSubscriptionsCount_ = 0;
 }
 
 void Messenger::doSend()
 {
-    auto queueElementIter = channelSendPromiseQueue_.begin();
-    auto outStreamPromise = SendPromise::defer(sendStrand_);
-    outStreamPromise->then(std::bind(&Messenger::outStreamMessageHandler, this->shared_from_this(), queueElementIter),
-                           std::bind(&Messenger::rejectSendPromiseQueue, this->shared_from_this(), std::placeholders::_1));
+    while(inFlightSendsCount_ < sendWindow_ && inFlightSendsCount_ < channelSendPromiseQueue_.size())
+    {
+        auto queueElementIter = std::next(channelSendPromiseQueue_.begin(), inFlightSendsCount_);
+        ++inFlightSendsCount_;
+
+        if(outStreamSendsCount_++ == 0)
+        {
+            sendSelf_ = this->shared_from_this();
+        }
+
+        auto outStreamPromise = SendPromise::defer(sendStrand_);
+        outStreamPromise->then([this, queueElementIter, sendGeneration = sendGeneration_]() { this->outStreamMessageHandler(queueElementIter, sendGeneration); },
+                               [this, sendGeneration = sendGeneration_](const error::Error& e) { this->outStreamErrorHandler(sendGeneration, e); });
 
-    messageOutStream_->stream(std::move(queueElementIter->first), std::move(outStreamPromise));
+        messageOutStream_->stream(queueElementIter->first, std::move(outStreamPromise));
+    }
 }
 
-void Messenger::outStreamMessageHandler(ChannelSendQueue::iterator queueElement)
+void Messenger::outStreamMessageHandler(ChannelSendQueue::iterator queueElement, size_t sendGeneration)
 {
-    queueElement->second->resolve();
+    auto self = this->outStreamSendCompleted();
+
+    // Queue was already rejected, the element does not exist anymore.
+    if(sendGeneration != sendGeneration_)
+    {
+        return;
+    }
+
+    if(queueElement->second != nullptr)
+    {
+        queueElement->second->resolve();
+    }
+
     channelSendPromiseQueue_.erase(queueElement);
+    --inFlightSendsCount_;
+    this->doSend();
+}
+
+void Messenger::outStreamErrorHandler(size_t sendGeneration, const error::Error& e)
+{
+    auto self = this->outStreamSendCompleted();
 
-    if(!channelSendPromiseQueue_.empty())
+    if(sendGeneration == sendGeneration_)
     {
-        this->doSend();
+        this->rejectSendPromiseQueue(e);
     }
 }
 
+Messenger::Pointer Messenger::outStreamSendCompleted()
+{
+    // Messenger stays alive while any out stream promise is outstanding, the caller holds it until its handler returns.
+    return --outStreamSendsCount_ == 0 ? std::move(sendSelf_) : nullptr;
+}
+
 void Messenger::rejectReceivePromiseQueue(const error::Error& e)
 {
+    auto self = std::move(receiveSelf_);
+    inStreamReceiveInProgress_ = false;
+
     while(!channelReceivePromiseQueue_.empty())
     {
         channelReceivePromiseQueue_.pop()->reject(e);
     }
+
+    for(auto& subscription : channelSubscriptions_)
+    {
+        if(subscription != nullptr)
+        {
+            subscription->reject(e);
+        }
+    }
+
+    this->clearSubscriptions();
 }
 
 void Messenger::rejectSendPromiseQueue(const error::Error& e)
 {
+    ++sendGeneration_;
+    inFlightSendsCount_ = 0;
+    std::bitset<256> notifiedChannels;
+
     while(!channelSendPromiseQueue_.empty())
     {
         auto queueElement(std::move(channelSendPromiseQueue_.front()));
         channelSendPromiseQueue_.pop_front();
-        queueElement.second->reject(e);
+
+        if(queueElement.second != nullptr)
+        {
+            queueElement.second->reject(e);
+        }
+        else
+        {
+            const auto channelIndex = static_cast<size_t>(queueElement.first->getChannelId());
+            auto& errorHandler = channelSendErrorHandlers_[channelIndex];
+
+            if(errorHandler == nullptr)
+            {
+                ++unreportedSendErrorsCount_;
+                AASDK_LOG(error) << "[Messenger] send failed without an error handler, channel: " << channelIdToString(queueElement.first->getChannelId())
+                                 << ", error: " << e.what();
+            }
+            else if(!notifiedChannels.test(channelIndex))
+            {
+                notifiedChannels.set(channelIndex);
+                errorHandler(e);
+            }
+        }
     }
 }
 
@@ -135,9 +350,55 @@ void Messenger::stop()
 {
     receiveStrand_.dispatch([this, self = this->shared_from_this()]() {
         channelReceiveMessageQueue_.clear();
+        this->clearSubscriptions();
+
+        if(HopProfiler::isEnabled())
+        {
+            hopProfiler_->dump();
+        }
+    });
+
+    sendStrand_.dispatch([this, self = this->shared_from_this()]() {
+        channelSendErrorHandlers_.fill(SendErrorHandler());
+    });
+}
+
+void Messenger::setReceiveQueuePolicy(ChannelId channelId, size_t capacity, ReceiveQueuePolicy policy)
+{
+    receiveStrand_.dispatch([this, self = this->shared_from_this(), channelId, capacity, policy]() {
+        channelReceiveMessageQueue_.setPolicy(channelId, capacity, policy);
+        this->receiveFromInStream();
     });
 }
 
+void Messenger::setSendWindow(size_t sendWindow)
+{
+    sendStrand_.dispatch([this, self = this->shared_from_this(), sendWindow]() {
+        sendWindow_ = sendWindow > 0 ? sendWindow : 1;
+        this->doSend();
+    });
+}
+
+size_t Messenger::getReceiveQueueSize(ChannelId channelId) const
+{
+    return channelReceiveMessageQueue_.getSize(channelId);
+}
+
+size_t Messenger::getReceiveQueueDroppedCount(ChannelId channelId) const
+{
+    return channelReceiveMessageQueue_.getDroppedCount(channelId);
+}
+
+size_t Messenger::getUnreportedSendErrorsCount() const
+{
+    return unreportedSendErrorsCount_;
+}
+
+HopProfiler::Pointer Messenger::getHopProfiler() const
+{
+    return hopProfiler_;
+}
+
 }
 }
 }
@@ -35,6 +35,8 @@ namespace ut
 using ::testing::_;
 using ::testing::SaveArg;
 using ::testing::Return;
+using ::testing::DoAll;
+using ::testing::InvokeWithoutArgs;
 
 class MessengerUnitTest
 {
@@ -146,6 +148,217 @@ BOOST_FIXTURE_TEST_CASE(Messenger_OnlyOneReceiveAtATime, MessengerUnitTest)
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(Messenger_ReceiveQueueBackpressure, MessengerUnitTest)
+{
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->setReceiveQueuePolicy(ChannelId::VIDEO, 1, ReceiveQueuePolicy::BLOCK);
+    themessenger->enqueueReceive(ChannelId::MEDIA_AUDIO, std::move(receivePromise_));
+
+    ReceivePromise::Pointer inStreamReceivePromise;
+    EXPECT_CALL(messageInStreamMock_, startReceive(_)).WillOnce(SaveArg<0>(&inStreamReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer videoChannelMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    inStreamReceivePromise->resolve(videoChannelMessage);
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK_EQUAL(themessenger->getReceiveQueueSize(ChannelId::VIDEO), 1);
+
+    ReceivePromiseHandlerMock videoReceivePromiseHandlerMock;
+    auto videoReceivePromise = ReceivePromise::defer(ioService_);
+    videoReceivePromise->then(std::bind(&ReceivePromiseHandlerMock::onResolve, &videoReceivePromiseHandlerMock, std::placeholders::_1),
+                             std::bind(&ReceivePromiseHandlerMock::onReject, &videoReceivePromiseHandlerMock, std::placeholders::_1));
+
+    EXPECT_CALL(messageInStreamMock_, startReceive(_)).WillOnce(SaveArg<0>(&inStreamReceivePromise));
+    EXPECT_CALL(videoReceivePromiseHandlerMock, onReject(_)).Times(0);
+    EXPECT_CALL(videoReceivePromiseHandlerMock, onResolve(videoChannelMessage));
+    themessenger->enqueueReceive(ChannelId::VIDEO, std::move(videoReceivePromise));
+
+    ioService_.run();
+
+    BOOST_CHECK_EQUAL(themessenger->getReceiveQueueSize(ChannelId::VIDEO), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(Messenger_UnconsumedChannelDoesNotStallOtherChannels, MessengerUnitTest)
+{
+    const size_t sensorMessagesCount = ChannelReceiveMessageQueue::cDefaultCapacity + 10;
+
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->enqueueReceive(ChannelId::CONTROL, std::move(receivePromise_));
+
+    ReceivePromise::Pointer inStreamReceivePromise;
+    EXPECT_CALL(messageInStreamMock_, startReceive(_)).Times(sensorMessagesCount + 1).WillRepeatedly(SaveArg<0>(&inStreamReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    for(size_t i = 0; i < sensorMessagesCount; ++i)
+    {
+        inStreamReceivePromise->resolve(std::make_shared<Message>(ChannelId::SENSOR, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+
+        ioService_.run();
+        ioService_.reset();
+    }
+
+    BOOST_CHECK_EQUAL(themessenger->getReceiveQueueSize(ChannelId::SENSOR), sensorMessagesCount);
+    BOOST_CHECK_EQUAL(themessenger->getReceiveQueueDroppedCount(ChannelId::SENSOR), 0);
+
+    Message::Pointer controlChannelMessage(std::make_shared<Message>(ChannelId::CONTROL, EncryptionType::PLAIN, MessageType::SPECIFIC));
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(controlChannelMessage));
+    inStreamReceivePromise->resolve(controlChannelMessage);
+
+    ioService_.run();
+}
+
+BOOST_FIXTURE_TEST_CASE(Messenger_ReceiveQueueDropNewest, MessengerUnitTest)
+{
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->setReceiveQueuePolicy(ChannelId::VIDEO, 1, ReceiveQueuePolicy::DROP_NEWEST);
+    themessenger->enqueueReceive(ChannelId::MEDIA_AUDIO, std::move(receivePromise_));
+
+    ReceivePromise::Pointer inStreamReceivePromise;
+    EXPECT_CALL(messageInStreamMock_, startReceive(_)).Times(3).WillRepeatedly(SaveArg<0>(&inStreamReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer firstVideoChannelMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    inStreamReceivePromise->resolve(firstVideoChannelMessage);
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer secondVideoChannelMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    inStreamReceivePromise->resolve(secondVideoChannelMessage);
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK_EQUAL(themessenger->getReceiveQueueSize(ChannelId::VIDEO), 1);
+    BOOST_CHECK_EQUAL(themessenger->getReceiveQueueDroppedCount(ChannelId::VIDEO), 1);
+
+    ReceivePromiseHandlerMock videoReceivePromiseHandlerMock;
+    auto videoReceivePromise = ReceivePromise::defer(ioService_);
+    videoReceivePromise->then(std::bind(&ReceivePromiseHandlerMock::onResolve, &videoReceivePromiseHandlerMock, std::placeholders::_1),
+                             std::bind(&ReceivePromiseHandlerMock::onReject, &videoReceivePromiseHandlerMock, std::placeholders::_1));
+
+    EXPECT_CALL(videoReceivePromiseHandlerMock, onReject(_)).Times(0);
+    EXPECT_CALL(videoReceivePromiseHandlerMock, onResolve(firstVideoChannelMessage));
+    themessenger->enqueueReceive(ChannelId::VIDEO, std::move(videoReceivePromise));
+
+    ioService_.run();
+}
+
+BOOST_FIXTURE_TEST_CASE(Messenger_Subscription, MessengerUnitTest)
+{
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->enqueueReceive(ChannelId::MEDIA_AUDIO, std::move(receivePromise_));
+
+    ReceivePromise::Pointer inStreamReceivePromise;
+    EXPECT_CALL(messageInStreamMock_, startReceive(_)).Times(4).WillRepeatedly(SaveArg<0>(&inStreamReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer firstVideoChannelMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    inStreamReceivePromise->resolve(firstVideoChannelMessage);
+
+    ioService_.run();
+    ioService_.reset();
+
+    Message::Pointer secondVideoChannelMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    inStreamReceivePromise->resolve(secondVideoChannelMessage);
+
+    ioService_.run();
+    ioService_.reset();
+
+    boost::asio::io_service::strand strand(ioService_);
+    ReceivePromiseHandlerMock videoReceiveHandlerMock;
+    auto subscription = std::make_shared<ChannelSubscription>(strand,
+                                                              std::bind(&ReceivePromiseHandlerMock::onResolve, &videoReceiveHandlerMock, std::placeholders::_1),
+                                                              std::bind(&ReceivePromiseHandlerMock::onReject, &videoReceiveHandlerMock, std::placeholders::_1));
+
+    ::testing::InSequence sequence;
+    EXPECT_CALL(videoReceiveHandlerMock, onReject(_)).Times(0);
+    EXPECT_CALL(videoReceiveHandlerMock, onResolve(firstVideoChannelMessage));
+    EXPECT_CALL(videoReceiveHandlerMock, onResolve(secondVideoChannelMessage));
+    themessenger->subscribe(ChannelId::VIDEO, subscription);
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK_EQUAL(themessenger->getReceiveQueueSize(ChannelId::VIDEO), 0);
+
+    Message::Pointer thirdVideoChannelMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    EXPECT_CALL(videoReceiveHandlerMock, onResolve(thirdVideoChannelMessage));
+    inStreamReceivePromise->resolve(thirdVideoChannelMessage);
+
+    ioService_.run();
+
+    BOOST_CHECK_EQUAL(thirdVideoChannelMessage->getHopCounter().getPostedCount(), 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(Messenger_BlockedSubscriptionIsReleasedAfterBatchIsHandled, MessengerUnitTest)
+{
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->setReceiveQueuePolicy(ChannelId::VIDEO, 1, ReceiveQueuePolicy::BLOCK);
+
+    size_t startReceiveCount = 0;
+    ReceivePromise::Pointer inStreamReceivePromise;
+    EXPECT_CALL(messageInStreamMock_, startReceive(_)).Times(2).WillRepeatedly(DoAll(SaveArg<0>(&inStreamReceivePromise),
+                                                                                      InvokeWithoutArgs([&]() { ++startReceiveCount; })));
+
+    boost::asio::io_service::strand strand(ioService_);
+    std::vector<size_t> startReceiveCountsWhenHandled;
+    auto subscription = std::make_shared<ChannelSubscription>(strand,
+                                                              [&](Message::Pointer) { startReceiveCountsWhenHandled.push_back(startReceiveCount); },
+                                                              [](const error::Error&) {});
+    themessenger->subscribe(ChannelId::VIDEO, subscription);
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK_EQUAL(startReceiveCount, 1);
+    inStreamReceivePromise->resolve(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+
+    ioService_.run();
+
+    // No message is pulled from the stream while the blocking batch is still being handled.
+    BOOST_REQUIRE_EQUAL(startReceiveCountsWhenHandled.size(), 1);
+    BOOST_CHECK_EQUAL(startReceiveCountsWhenHandled[0], 1);
+    BOOST_CHECK_EQUAL(startReceiveCount, 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(Messenger_SubscriptionRejected, MessengerUnitTest)
+{
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+
+    boost::asio::io_service::strand strand(ioService_);
+    ReceivePromiseHandlerMock videoReceiveHandlerMock;
+    auto subscription = std::make_shared<ChannelSubscription>(strand,
+                                                              std::bind(&ReceivePromiseHandlerMock::onResolve, &videoReceiveHandlerMock, std::placeholders::_1),
+                                                              std::bind(&ReceivePromiseHandlerMock::onReject, &videoReceiveHandlerMock, std::placeholders::_1));
+    themessenger->subscribe(ChannelId::VIDEO, subscription);
+
+    ReceivePromise::Pointer inStreamReceivePromise;
+    EXPECT_CALL(messageInStreamMock_, startReceive(_)).WillOnce(SaveArg<0>(&inStreamReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    error::Error e(error::ErrorCode::OPERATION_ABORTED);
+    EXPECT_CALL(videoReceiveHandlerMock, onResolve(_)).Times(0);
+    EXPECT_CALL(videoReceiveHandlerMock, onReject(e));
+    inStreamReceivePromise->reject(e);
+
+    ioService_.run();
+}
+
 BOOST_FIXTURE_TEST_CASE(Messenger_Send, MessengerUnitTest)
 {
     Messenger::Pointer themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
@@ -168,7 +381,8 @@ BOOST_FIXTURE_TEST_CASE(Messenger_Send, MessengerUnitTest)
 
 BOOST_FIXTURE_TEST_CASE(Messenger_OnlyOneSendAtATime, MessengerUnitTest)
 {
-    Messenger::Pointer themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->setSendWindow(1);
 
     Message::Pointer message(std::make_shared<Message>(ChannelId::MEDIA_AUDIO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
     themessenger->enqueueSend(message, std::move(sendPromise_));
@@ -197,6 +411,49 @@ BOOST_FIXTURE_TEST_CASE(Messenger_OnlyOneSendAtATime, MessengerUnitTest)
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(Messenger_PipelinedSend, MessengerUnitTest)
+{
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->setSendWindow(2);
+
+    Message::Pointer firstMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    Message::Pointer secondMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    Message::Pointer thirdMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+
+    SendPromiseHandlerMock secondSendPromiseHandlerMock;
+    auto secondSendPromise = SendPromise::defer(ioService_);
+    secondSendPromise->then(std::bind(&SendPromiseHandlerMock::onResolve, &secondSendPromiseHandlerMock),
+                           std::bind(&SendPromiseHandlerMock::onReject, &secondSendPromiseHandlerMock, std::placeholders::_1));
+
+    themessenger->enqueueSend(firstMessage, std::move(sendPromise_));
+    themessenger->enqueueSend(secondMessage, std::move(secondSendPromise));
+    themessenger->enqueueSend(thirdMessage);
+
+    SendPromise::Pointer firstOutStreamSendPromise;
+    SendPromise::Pointer secondOutStreamSendPromise;
+    SendPromise::Pointer thirdOutStreamSendPromise;
+    EXPECT_CALL(messageOutStreamMock_, stream(firstMessage, _)).WillOnce(SaveArg<1>(&firstOutStreamSendPromise));
+    EXPECT_CALL(messageOutStreamMock_, stream(secondMessage, _)).WillOnce(SaveArg<1>(&secondOutStreamSendPromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
+    EXPECT_CALL(messageOutStreamMock_, stream(thirdMessage, _)).WillOnce(SaveArg<1>(&thirdOutStreamSendPromise));
+    firstOutStreamSendPromise->resolve();
+
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(secondSendPromiseHandlerMock, onReject(_)).Times(0);
+    EXPECT_CALL(secondSendPromiseHandlerMock, onResolve());
+    secondOutStreamSendPromise->resolve();
+    thirdOutStreamSendPromise->resolve();
+
+    ioService_.run();
+}
+
 BOOST_FIXTURE_TEST_CASE(Messenger_SendFailed, MessengerUnitTest)
 {
     Messenger::Pointer themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
@@ -205,7 +462,8 @@ BOOST_FIXTURE_TEST_CASE(Messenger_SendFailed, MessengerUnitTest)
     themessenger->enqueueSend(message, std::move(sendPromise_));
 
     SendPromise::Pointer outStreamSendPromise;
-    EXPECT_CALL(messageOutStreamMock_, stream(message, _)).WillOnce(SaveArg<1>(&outStreamSendPromise));
+    SendPromise::Pointer secondOutStreamSendPromise;
+    EXPECT_CALL(messageOutStreamMock_, stream(message, _)).WillOnce(SaveArg<1>(&outStreamSendPromise)).WillOnce(SaveArg<1>(&secondOutStreamSendPromise));
 
     ioService_.run();
     ioService_.reset();
@@ -220,12 +478,70 @@ BOOST_FIXTURE_TEST_CASE(Messenger_SendFailed, MessengerUnitTest)
 
     error::Error e(error::ErrorCode::USB_TRANSFER, 67);
     outStreamSendPromise->reject(e);
+    // In-flight message of the already rejected queue must not be reported again.
+    secondOutStreamSendPromise->reject(e);
 
     EXPECT_CALL(sendPromiseHandlerMock_, onReject(e)).Times(2);
     EXPECT_CALL(sendPromiseHandlerMock_, onResolve()).Times(0);
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(Messenger_SendWithoutPromise, MessengerUnitTest)
+{
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->setSendErrorHandler(ChannelId::VIDEO, std::bind(&SendPromiseHandlerMock::onReject, &sendPromiseHandlerMock_, std::placeholders::_1));
+
+    Message::Pointer firstMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    Message::Pointer secondMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    themessenger->enqueueSend(firstMessage);
+    themessenger->enqueueSend(secondMessage);
+
+    SendPromise::Pointer firstOutStreamSendPromise;
+    SendPromise::Pointer outStreamSendPromise;
+    EXPECT_CALL(messageOutStreamMock_, stream(firstMessage, _)).WillOnce(SaveArg<1>(&firstOutStreamSendPromise));
+    EXPECT_CALL(messageOutStreamMock_, stream(secondMessage, _)).WillOnce(SaveArg<1>(&outStreamSendPromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    firstOutStreamSendPromise->resolve();
+
+    ioService_.run();
+    ioService_.reset();
+
+    error::Error e(error::ErrorCode::USB_TRANSFER, 67);
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(e)).Times(1);
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve()).Times(0);
+    outStreamSendPromise->reject(e);
+
+    ioService_.run();
+}
+
+BOOST_FIXTURE_TEST_CASE(Messenger_SendWithoutPromiseOnUnsubscribedChannel, MessengerUnitTest)
+{
+    // Channels driven through enqueueReceive() never register a send error handler.
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+
+    Message::Pointer firstMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    Message::Pointer secondMessage(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    themessenger->enqueueSend(firstMessage);
+    themessenger->enqueueSend(secondMessage);
+
+    SendPromise::Pointer outStreamSendPromise;
+    EXPECT_CALL(messageOutStreamMock_, stream(firstMessage, _)).WillOnce(SaveArg<1>(&outStreamSendPromise));
+    EXPECT_CALL(messageOutStreamMock_, stream(secondMessage, _));
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK_EQUAL(themessenger->getUnreportedSendErrorsCount(), 0);
+    outStreamSendPromise->reject(error::Error(error::ErrorCode::USB_TRANSFER, 67));
+
+    ioService_.run();
+
+    BOOST_CHECK_EQUAL(themessenger->getUnreportedSendErrorsCount(), 2);
+}
+
 }
 }
 }
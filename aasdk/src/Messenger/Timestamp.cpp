@@ -40,9 +40,21 @@ Timestamp::Timestamp(const common::DataConstBuffer& buffer)
 
 common::Data Timestamp::getData() const
 {
+    common::Data data(getSizeOf());
+    this->write(common::DataBuffer(data));
+    return data;
+}
+
+size_t Timestamp::write(common::DataBuffer buffer) const
+{
+    if(buffer.size < getSizeOf())
+    {
+        return 0;
+    }
+
     const ValueType timestampBig = boost::endian::native_to_big(stamp_);
-    const common::DataConstBuffer timestampBuffer(&timestampBig, sizeof(timestampBig));
-    return common::createData(timestampBuffer);
+    memcpy(buffer.data, &timestampBig, sizeof(timestampBig));
+    return sizeof(timestampBig);
 }
 
 Timestamp::ValueType Timestamp::getValue() const
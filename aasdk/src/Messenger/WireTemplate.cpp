@@ -0,0 +1,119 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Messenger/WireTemplate.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+bool WireTemplate<proto::messages::AVMediaAckIndication>::matches(const proto::messages::AVMediaAckIndication& message)
+{
+    return message.has_session() && message.has_value();
+}
+
+size_t WireTemplate<proto::messages::AVMediaAckIndication>::write(const proto::messages::AVMediaAckIndication& message, uint8_t* output)
+{
+    auto position = output;
+    *position++ = cSessionTag;
+    position = WireFormat::writeSignedVarint(message.session(), position);
+    *position++ = cValueTag;
+    position = WireFormat::writeVarint(message.value(), position);
+
+    return position - output;
+}
+
+bool WireTemplate<proto::messages::PingRequest>::matches(const proto::messages::PingRequest& message)
+{
+    return message.has_timestamp();
+}
+
+size_t WireTemplate<proto::messages::PingRequest>::write(const proto::messages::PingRequest& message, uint8_t* output)
+{
+    auto position = output;
+    *position++ = cTimestampTag;
+    position = WireFormat::writeSignedVarint(message.timestamp(), position);
+
+    return position - output;
+}
+
+bool WireTemplate<proto::messages::InputEventIndication>::matches(const proto::messages::InputEventIndication& message)
+{
+    if(!message.has_timestamp() || message.has_disp_channel() || !message.has_touch_event()
+            || message.has_button_event() || message.has_absolute_input_event() || message.has_relative_input_event())
+    {
+        return false;
+    }
+
+    const auto& touchEvent = message.touch_event();
+
+    if(touchEvent.touch_location_size() != 1 || !touchEvent.has_touch_action())
+    {
+        return false;
+    }
+
+    const auto& touchLocation = touchEvent.touch_location(0);
+    return touchLocation.has_x() && touchLocation.has_y() && touchLocation.has_pointer_id();
+}
+
+size_t WireTemplate<proto::messages::InputEventIndication>::write(const proto::messages::InputEventIndication& message, uint8_t* output)
+{
+    const auto& touchEvent = message.touch_event();
+    const auto& touchLocation = touchEvent.touch_location(0);
+
+    const uint8_t touchLocationSize = 3 + WireFormat::getVarintSize(touchLocation.x())
+            + WireFormat::getVarintSize(touchLocation.y())
+            + WireFormat::getVarintSize(touchLocation.pointer_id());
+
+    const uint8_t touchEventSize = 2 + touchLocationSize
+            + (touchEvent.has_action_index() ? 1 + WireFormat::getVarintSize(touchEvent.action_index()) : 0)
+            + 1 + WireFormat::getVarintSize(static_cast<uint64_t>(static_cast<int64_t>(touchEvent.touch_action())));
+
+    auto position = output;
+    *position++ = cTimestampTag;
+    position = WireFormat::writeVarint(message.timestamp(), position);
+
+    *position++ = cTouchEventTag;
+    *position++ = touchEventSize;
+    *position++ = cTouchLocationTag;
+    *position++ = touchLocationSize;
+    *position++ = cXTag;
+    position = WireFormat::writeVarint(touchLocation.x(), position);
+    *position++ = cYTag;
+    position = WireFormat::writeVarint(touchLocation.y(), position);
+    *position++ = cPointerIdTag;
+    position = WireFormat::writeVarint(touchLocation.pointer_id(), position);
+
+    if(touchEvent.has_action_index())
+    {
+        *position++ = cActionIndexTag;
+        position = WireFormat::writeVarint(touchEvent.action_index(), position);
+    }
+
+    *position++ = cTouchActionTag;
+    position = WireFormat::writeSignedVarint(touchEvent.touch_action(), position);
+
+    return position - output;
+}
+
+}
+}
+}
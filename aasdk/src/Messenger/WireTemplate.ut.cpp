@@ -0,0 +1,140 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <limits>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Messenger/WireTemplate.hpp>
+#include <f1x/aasdk/Messenger/MessageBuilder.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace ut
+{
+
+template<typename MessageType>
+void checkWireTemplate(const MessageType& message)
+{
+    BOOST_REQUIRE(WireTemplate<MessageType>::matches(message));
+
+    common::Data expectedData(message.ByteSizeLong());
+    message.SerializeToArray(expectedData.data(), expectedData.size());
+
+    common::Data data(WireTemplate<MessageType>::cMaxSize);
+    data.resize(WireTemplate<MessageType>::write(message, data.data()));
+    BOOST_CHECK_EQUAL_COLLECTIONS(data.begin(), data.end(), expectedData.begin(), expectedData.end());
+}
+
+BOOST_AUTO_TEST_CASE(WireTemplate_AVMediaAckIndicationMatchesProtobuf)
+{
+    const int32_t sessions[] = {0, 1, 127, 128, 300, -1, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min()};
+    const uint32_t values[] = {0, 1, 128, 16384, std::numeric_limits<uint32_t>::max()};
+
+    for(const auto session : sessions)
+    {
+        for(const auto value : values)
+        {
+            proto::messages::AVMediaAckIndication indication;
+            indication.set_session(session);
+            indication.set_value(value);
+            checkWireTemplate(indication);
+        }
+    }
+
+    proto::messages::AVMediaAckIndication incompleteIndication;
+    incompleteIndication.set_value(1);
+    BOOST_CHECK(!WireTemplate<proto::messages::AVMediaAckIndication>::matches(incompleteIndication));
+}
+
+BOOST_AUTO_TEST_CASE(WireTemplate_PingRequestMatchesProtobuf)
+{
+    const int64_t timestamps[] = {0, 1, 1540000000000000, -1, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()};
+
+    for(const auto timestamp : timestamps)
+    {
+        proto::messages::PingRequest request;
+        request.set_timestamp(timestamp);
+        checkWireTemplate(request);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(WireTemplate_TouchEventMatchesProtobuf)
+{
+    const uint32_t coordinates[] = {0, 127, 128, 1919, std::numeric_limits<uint32_t>::max()};
+    const proto::enums::TouchAction::Enum actions[] = {proto::enums::TouchAction::PRESS, proto::enums::TouchAction::DRAG,
+                                                       proto::enums::TouchAction::POINTER_UP};
+
+    for(const auto coordinate : coordinates)
+    {
+        for(const auto action : actions)
+        {
+            proto::messages::InputEventIndication indication;
+            indication.set_timestamp(1540000000000000 + coordinate);
+
+            auto touchEvent = indication.mutable_touch_event();
+            touchEvent->set_touch_action(action);
+            auto touchLocation = touchEvent->add_touch_location();
+            touchLocation->set_x(coordinate);
+            touchLocation->set_y(coordinate / 2);
+            touchLocation->set_pointer_id(0);
+            checkWireTemplate(indication);
+
+            touchEvent->set_action_index(coordinate);
+            checkWireTemplate(indication);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(WireTemplate_OtherInputEventsUseProtobuf)
+{
+    proto::messages::InputEventIndication indication;
+    indication.set_timestamp(1);
+
+    auto touchEvent = indication.mutable_touch_event();
+    touchEvent->set_touch_action(proto::enums::TouchAction::POINTER_DOWN);
+
+    for(uint32_t i = 0; i < 2; ++i)
+    {
+        auto touchLocation = touchEvent->add_touch_location();
+        touchLocation->set_x(i);
+        touchLocation->set_y(i);
+        touchLocation->set_pointer_id(i);
+    }
+
+    BOOST_CHECK(!WireTemplate<proto::messages::InputEventIndication>::matches(indication));
+
+    Message expectedMessage(ChannelId::INPUT, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+    expectedMessage.insertPayload(MessageId(0x8001).getData());
+    expectedMessage.insertPayload(indication);
+
+    auto message = MessageBuilder(ChannelId::INPUT, EncryptionType::ENCRYPTED, MessageType::SPECIFIC)
+            .setId(0x8001)
+            .setPayload(indication)
+            .build();
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(message->getPayload().begin(), message->getPayload().end(),
+                                  expectedMessage.getPayload().begin(), expectedMessage.getPayload().end());
+}
+
+}
+}
+}
+}
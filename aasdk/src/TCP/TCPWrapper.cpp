@@ -18,6 +18,7 @@
 
 #include <boost/asio.hpp>
 #include <f1x/aasdk/TCP/TCPWrapper.hpp>
+#include <f1x/aasdk/IO/StallDetector.hpp>
 
 namespace f1x
 {
@@ -28,12 +29,12 @@ namespace tcp
 
 void TCPWrapper::asyncWrite(boost::asio::ip::tcp::socket& socket, common::DataConstBuffer buffer, Handler handler)
 {
-    boost::asio::async_write(socket, boost::asio::buffer(buffer.cdata, buffer.size), std::move(handler));
+    boost::asio::async_write(socket, boost::asio::buffer(buffer.cdata, buffer.size), io::StallDetector::wrap(std::move(handler)));
 }
 
 void TCPWrapper::asyncRead(boost::asio::ip::tcp::socket& socket, common::DataBuffer buffer, Handler handler)
 {
-    socket.async_receive(boost::asio::buffer(buffer.data, buffer.size), std::move(handler));
+    socket.async_receive(boost::asio::buffer(buffer.data, buffer.size), io::StallDetector::wrap(std::move(handler)));
 }
 
 void TCPWrapper::close(boost::asio::ip::tcp::socket& socket)
@@ -45,7 +46,7 @@ void TCPWrapper::close(boost::asio::ip::tcp::socket& socket)
 
 void TCPWrapper::asyncConnect(boost::asio::ip::tcp::socket& socket, const std::string& hostname, uint16_t port, ConnectHandler handler)
 {
-    socket.async_connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(hostname), port), std::move(handler));
+    socket.async_connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(hostname), port), io::StallDetector::wrap(std::move(handler)));
 }
 
 boost::system::error_code TCPWrapper::connect(boost::asio::ip::tcp::socket& socket, const std::string& hostname, uint16_t port)
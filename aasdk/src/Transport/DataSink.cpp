@@ -16,6 +16,7 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <f1x/aasdk/Transport/DataSink.hpp>
 #include <f1x/aasdk/Error/Error.hpp>
@@ -28,13 +29,21 @@ namespace transport
 {
 
 DataSink::DataSink()
-    : data_(common::cStaticDataSize)
+    : reservation_(common::MemoryBudget::getInstance().reserve("DataSink", cDesiredCapacity, cChunkSize * 4))
+    , data_(reservation_.getSize())
 {
 }
 
 common::DataBuffer DataSink::fill()
 {
     const auto offset = data_.size();
+
+    if(offset + cChunkSize > data_.capacity())
+    {
+        data_.set_capacity(std::max(data_.capacity() * 2, offset + cChunkSize));
+        reservation_.resize(data_.capacity());
+    }
+
     data_.resize(data_.size() + cChunkSize);
 
     auto ptr = data_.is_linearized() ? &data_[offset] : data_.linearize() + offset;
@@ -63,7 +72,7 @@ common::Data DataSink::consume(common::Data::size_type size)
         throw error::Error(error::ErrorCode::DATA_SINK_CONSUME_UNDERFLOW);
     }
 
-    common::Data data(size, 0);
+    common::Data data(size, common::cDefaultInit);
     std::copy(data_.begin(), data_.begin() + size, data.begin());
     data_.erase_begin(size);
 
@@ -0,0 +1,61 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Transport/DataSink.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(DataSink_GrowBeyondReservation)
+{
+    const auto initialSize = common::MemoryBudget::getInstance().getTotalStatistics().currentSize;
+    common::Data expectedData;
+
+    {
+        DataSink dataSink;
+        const auto reservedSize = common::MemoryBudget::getInstance().getTotalStatistics().currentSize - initialSize;
+
+        for(uint8_t i = 0; expectedData.size() <= reservedSize; ++i)
+        {
+            auto buffer = dataSink.fill();
+            std::fill(buffer.data, buffer.data + buffer.size, i);
+            dataSink.commit(buffer.size);
+            expectedData.resize(expectedData.size() + buffer.size, i);
+        }
+
+        BOOST_CHECK(common::MemoryBudget::getInstance().getTotalStatistics().currentSize - initialSize > reservedSize);
+
+        const auto data = dataSink.consume(expectedData.size());
+        BOOST_CHECK_EQUAL(dataSink.getAvailableSize(), 0u);
+        BOOST_CHECK(data == expectedData);
+    }
+
+    BOOST_CHECK_EQUAL(common::MemoryBudget::getInstance().getTotalStatistics().currentSize, initialSize);
+}
+
+}
+}
+}
+}
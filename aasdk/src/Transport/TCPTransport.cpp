@@ -35,11 +35,11 @@ TCPTransport::TCPTransport(boost::asio::io_service& ioService, tcp::ITCPEndpoint
 void TCPTransport::enqueueReceive(common::DataBuffer buffer)
 {
     auto receivePromise = tcp::ITCPEndpoint::Promise::defer(receiveStrand_);
-    receivePromise->then([this, self = this->shared_from_this()](auto bytesTransferred) {
+    receivePromise->then([this](auto bytesTransferred) {
             this->receiveHandler(bytesTransferred);
         },
-        [this, self = this->shared_from_this()](auto e) {
-            this->rejectReceivePromises(e);
+        [this](auto e) {
+            this->receiveErrorHandler(e);
         });
 
     tcpEndpoint_->receive(buffer, std::move(receivePromise));
@@ -49,10 +49,10 @@ void TCPTransport::enqueueSend(SendQueue::iterator queueElement)
 {
     auto sendPromise = tcp::ITCPEndpoint::Promise::defer(sendStrand_);
 
-    sendPromise->then([this, self = this->shared_from_this(), queueElement](auto) {
+    sendPromise->then([this, queueElement](auto) {
         this->sendHandler(queueElement, error::Error());
     },
-    [this, self = this->shared_from_this(), queueElement](auto e) {
+    [this, queueElement](auto e) {
         this->sendHandler(queueElement, e);
     });
 
@@ -81,6 +81,8 @@ void TCPTransport::sendHandler(SendQueue::iterator queueElement, const error::Er
     {
         this->enqueueSend(sendQueue_.begin());
     }
+
+    auto self = this->sendCompleted();
 }
 
 }
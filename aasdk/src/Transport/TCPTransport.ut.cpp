@@ -273,6 +273,48 @@ BOOST_FIXTURE_TEST_CASE(TCPTransport_SendError, TCPTransportUnitTest)
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(TCPTransport_KeptAliveOnlyWhileReceiveIsOutstanding, TCPTransportUnitTest)
+{
+    tcp::ITCPEndpoint::Promise::Pointer tcpEndpointPromise;
+    EXPECT_CALL(tcpEndpointMock_, receive(_, _)).WillOnce(SaveArg<1>(&tcpEndpointPromise));
+
+    auto transport(std::make_shared<TCPTransport>(ioService_, tcpEndpoint_));
+    std::weak_ptr<TCPTransport> weakTransport(transport);
+    transport->receive(100, std::move(receivePromise_));
+    transport.reset();
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK(!weakTransport.expired());
+
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(_));
+    tcpEndpointPromise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+    ioService_.run();
+
+    BOOST_CHECK(weakTransport.expired());
+}
+
+BOOST_FIXTURE_TEST_CASE(TCPTransport_KeptAliveOnlyWhileSendIsOutstanding, TCPTransportUnitTest)
+{
+    tcp::ITCPEndpoint::Promise::Pointer tcpEndpointPromise;
+    EXPECT_CALL(tcpEndpointMock_, send(_, _)).WillOnce(SaveArg<1>(&tcpEndpointPromise));
+
+    auto transport(std::make_shared<TCPTransport>(ioService_, tcpEndpoint_));
+    std::weak_ptr<TCPTransport> weakTransport(transport);
+    transport->send(common::Data(100, 0x5E), std::move(sendPromise_));
+    transport.reset();
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_CHECK(!weakTransport.expired());
+
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
+    tcpEndpointPromise->resolve(100);
+    ioService_.run();
+
+    BOOST_CHECK(weakTransport.expired());
+}
+
 }
 }
 }
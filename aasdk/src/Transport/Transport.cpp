@@ -27,7 +27,9 @@ namespace transport
 
 Transport::Transport(boost::asio::io_service& ioService)
     : receiveStrand_(ioService)
+    , receiveQueue_(cDefaultQueueCapacity)
     , sendStrand_(ioService)
+    , sendQueue_(cDefaultQueueCapacity)
 {}
 
 void Transport::receive(size_t size, ReceivePromise::Pointer promise)
@@ -37,6 +39,8 @@ void Transport::receive(size_t size, ReceivePromise::Pointer promise)
 
         if(receiveQueue_.size() == 1)
         {
+            receiveSelf_ = std::move(self);
+
             try
             {
                 this->distributeReceivedData();
@@ -45,6 +49,8 @@ void Transport::receive(size_t size, ReceivePromise::Pointer promise)
             {
                 this->rejectReceivePromises(e);
             }
+
+            auto completedSelf = this->receiveCompleted();
         }
     });
 }
@@ -60,6 +66,14 @@ void Transport::receiveHandler(size_t bytesTransferred)
     {
         this->rejectReceivePromises(e);
     }
+
+    auto self = this->receiveCompleted();
+}
+
+void Transport::receiveErrorHandler(const error::Error& e)
+{
+    this->rejectReceivePromises(e);
+    auto self = this->receiveCompleted();
 }
 
 void Transport::distributeReceivedData()
@@ -99,11 +113,23 @@ void Transport::send(common::Data data, SendPromise::Pointer promise)
 
         if(sendQueue_.size() == 1)
         {
+            sendSelf_ = std::move(self);
             this->enqueueSend(sendQueue_.begin());
         }
     });
 }
 
+Transport::Pointer Transport::receiveCompleted()
+{
+    // Emptied queue releases the transport, the caller holds it until its handler returns.
+    return receiveQueue_.empty() ? std::move(receiveSelf_) : nullptr;
+}
+
+Transport::Pointer Transport::sendCompleted()
+{
+    return sendQueue_.empty() ? std::move(sendSelf_) : nullptr;
+}
+
 }
 }
 }
@@ -33,11 +33,11 @@ USBTransport::USBTransport(boost::asio::io_service& ioService, usb::IAOAPDevice:
 void USBTransport::enqueueReceive(common::DataBuffer buffer)
 {
     auto usbEndpointPromise = usb::IUSBEndpoint::Promise::defer(receiveStrand_);
-    usbEndpointPromise->then([this, self = this->shared_from_this()](auto bytesTransferred) {
+    usbEndpointPromise->then([this](auto bytesTransferred) {
             this->receiveHandler(bytesTransferred);
         },
-        [this, self = this->shared_from_this()](auto e) {
-            this->rejectReceivePromises(e);
+        [this](auto e) {
+            this->receiveErrorHandler(e);
         });
 
     aoapDevice_->getInEndpoint().bulkTransfer(buffer, cReceiveTimeoutMs, std::move(usbEndpointPromise));
@@ -51,10 +51,10 @@ void USBTransport::enqueueSend(SendQueue::iterator queueElement)
 void USBTransport::doSend(SendQueue::iterator queueElement, common::Data::size_type offset)
 {
     auto usbEndpointPromise = usb::IUSBEndpoint::Promise::defer(sendStrand_);
-    usbEndpointPromise->then([this, self = this->shared_from_this(), queueElement, offset](size_t bytesTransferred) mutable {
+    usbEndpointPromise->then([this, queueElement, offset](size_t bytesTransferred) mutable {
             this->sendHandler(queueElement, offset, bytesTransferred);
         },
-        [this, self = this->shared_from_this(), queueElement](const error::Error& e) mutable {
+        [this, queueElement](const error::Error& e) mutable {
             queueElement->second->reject(e);
             sendQueue_.erase(queueElement);
 
@@ -62,6 +62,8 @@ void USBTransport::doSend(SendQueue::iterator queueElement, common::Data::size_t
             {
                 this->doSend(sendQueue_.begin(), 0);
             }
+
+            auto self = this->sendCompleted();
         });
 
     aoapDevice_->getOutEndpoint().bulkTransfer(common::DataBuffer(queueElement->first, offset), cSendTimeoutMs, std::move(usbEndpointPromise));
@@ -82,6 +84,8 @@ void USBTransport::sendHandler(SendQueue::iterator queueElement, common::Data::s
         {
             this->doSend(sendQueue_.begin(), 0);
         }
+
+        auto self = this->sendCompleted();
     }
 }
 
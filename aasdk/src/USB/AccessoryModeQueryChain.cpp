@@ -19,6 +19,7 @@
 #include <f1x/aasdk/USB/AccessoryModeQueryChain.hpp>
 #include <f1x/aasdk/Error/Error.hpp>
 #include <f1x/aasdk/USB/USBEndpoint.hpp>
+#include <f1x/aasdk/USB/USBEndpointAwaitables.hpp>
 
 namespace f1x
 {
@@ -48,6 +49,13 @@ void AccessoryModeQueryChain::start(DeviceHandle handle, Promise::Pointer promis
         {
             promise_ = std::move(promise);
 
+#ifdef AASDK_COROUTINES
+#if BOOST_VERSION < 106600
+            this->run(std::make_shared<USBEndpoint>(usbWrapper_, strand_.get_io_service(), std::move(handle)));
+#else
+            this->run(std::make_shared<USBEndpoint>(usbWrapper_, strand_.context(), std::move(handle)));
+#endif
+#else
             auto queryPromise = IAccessoryModeQuery::Promise::defer(strand_);
             queryPromise->then([this, self = this->shared_from_this()](IUSBEndpoint::Pointer usbEndpoint) mutable {
                     this->protocolVersionQueryHandler(std::move(usbEndpoint));
@@ -64,6 +72,7 @@ void AccessoryModeQueryChain::start(DeviceHandle handle, Promise::Pointer promis
                              std::make_shared<USBEndpoint>(usbWrapper_, strand_.context(), std::move(handle)),
 #endif
                              std::move(queryPromise));
+#endif
         }
     });
 }
@@ -79,6 +88,38 @@ void AccessoryModeQueryChain::cancel()
     });
 }
 
+#ifdef AASDK_COROUTINES
+io::Coroutine AccessoryModeQueryChain::run(IUSBEndpoint::Pointer usbEndpoint)
+{
+    auto self = this->shared_from_this();
+
+    try
+    {
+        for(auto queryType : {AccessoryModeQueryType::PROTOCOL_VERSION,
+                              AccessoryModeQueryType::SEND_MANUFACTURER,
+                              AccessoryModeQueryType::SEND_MODEL,
+                              AccessoryModeQueryType::SEND_DESCRIPTION,
+                              AccessoryModeQueryType::SEND_VERSION,
+                              AccessoryModeQueryType::SEND_URI,
+                              AccessoryModeQueryType::SEND_SERIAL,
+                              AccessoryModeQueryType::START})
+        {
+            activeQuery_ = queryFactory_.createQuery(queryType, std::move(usbEndpoint));
+            usbEndpoint = co_await asyncQuery(*activeQuery_, strand_);
+        }
+
+        activeQuery_.reset();
+        promise_->resolve(usbEndpoint->getDeviceHandle());
+    }
+    catch(const error::Error& e)
+    {
+        promise_->reject(e);
+    }
+
+    promise_.reset();
+}
+
+#else
 void AccessoryModeQueryChain::startQuery(AccessoryModeQueryType queryType, IUSBEndpoint::Pointer usbEndpoint, IAccessoryModeQuery::Promise::Pointer queryPromise)
 {
     activeQuery_ = queryFactory_.createQuery(queryType, std::move(usbEndpoint));
@@ -203,6 +244,7 @@ void AccessoryModeQueryChain::startQueryHandler(IUSBEndpoint::Pointer usbEndpoin
     promise_->resolve(usbEndpoint->getDeviceHandle());
     promise_.reset();
 }
+#endif
 
 }
 }
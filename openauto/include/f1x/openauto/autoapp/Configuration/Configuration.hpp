@@ -71,11 +71,34 @@ public:
     void setSpeechAudioChannelEnabled(bool value) override;
     AudioOutputBackendType getAudioOutputBackendType() const override;
     void setAudioOutputBackendType(AudioOutputBackendType value) override;
+    // Video and media audio are handed to the outputs frame by frame instead of as whole messages.
+    bool mediaStreamingEnabled() const override;
+    void setMediaStreamingEnabled(bool value) override;
+
+    ExecutorGroupSettings getControlExecutorSettings() const override;
+    void setControlExecutorSettings(const ExecutorGroupSettings& value) override;
+    ExecutorGroupSettings getMediaExecutorSettings() const override;
+    void setMediaExecutorSettings(const ExecutorGroupSettings& value) override;
+
+    // Limit of the buffer reservations of all components in megabytes, 0 for no limit.
+    size_t getMemoryBudget() const override;
+    void setMemoryBudget(size_t value) override;
+
+    // Diagnostics, all off by default.
+    bool stallDetectorEnabled() const override;
+    void setStallDetectorEnabled(bool value) override;
+    // SIGUSR1 dumps memory budget usage and the profilers built into aasdk.
+    bool profilerSignalEnabled() const override;
+    void setProfilerSignalEnabled(bool value) override;
 
 private:
     void readButtonCodes(boost::property_tree::ptree& iniConfig);
     void insertButtonCode(boost::property_tree::ptree& iniConfig, const std::string& buttonCodeKey, aasdk::proto::enums::ButtonCode::Enum buttonCode);
     void writeButtonCodes(boost::property_tree::ptree& iniConfig);
+    ExecutorGroupSettings readExecutorSettings(boost::property_tree::ptree& iniConfig, const std::string& threadsKey,
+                                               const std::string& cpuAffinityKey, const std::string& realtimePriorityKey);
+    void writeExecutorSettings(boost::property_tree::ptree& iniConfig, const ExecutorGroupSettings& settings, const std::string& threadsKey,
+                               const std::string& cpuAffinityKey, const std::string& realtimePriorityKey);
 
     HandednessOfTrafficType handednessOfTrafficType_;
     bool showClock_;
@@ -91,6 +114,12 @@ private:
     bool musicAudioChannelEnabled_;
     bool speechAudiochannelEnabled_;
     AudioOutputBackendType audioOutputBackendType_;
+    bool mediaStreamingEnabled_;
+    ExecutorGroupSettings controlExecutorSettings_;
+    ExecutorGroupSettings mediaExecutorSettings_;
+    size_t memoryBudget_;
+    bool stallDetectorEnabled_;
+    bool profilerSignalEnabled_;
 
     static const std::string cConfigFileName;
 
@@ -107,6 +136,7 @@ private:
     static const std::string cAudioMusicAudioChannelEnabled;
     static const std::string cAudioSpeechAudioChannelEnabled;
     static const std::string cAudioOutputBackendType;
+    static const std::string cMediaStreamingEnabledKey;
 
     static const std::string cBluetoothAdapterTypeKey;
     static const std::string cBluetoothRemoteAdapterAddressKey;
@@ -123,6 +153,22 @@ private:
     static const std::string cInputCharsButtonKey;
     static const std::string cInputLettersButtonKey;
     static const std::string cInputNumbersButtonKey;
+
+    static const std::string cExecutorsControlThreadsKey;
+    static const std::string cExecutorsControlCpuAffinityKey;
+    static const std::string cExecutorsControlRealtimePriorityKey;
+    static const std::string cExecutorsMediaThreadsKey;
+    static const std::string cExecutorsMediaCpuAffinityKey;
+    static const std::string cExecutorsMediaRealtimePriorityKey;
+
+    static const std::string cMemoryBudgetKey;
+
+    static const std::string cDiagnosticsStallDetectorEnabledKey;
+    static const std::string cDiagnosticsProfilerSignalEnabledKey;
+
+    static const ExecutorGroupSettings cDefaultControlExecutorSettings;
+    static const ExecutorGroupSettings cDefaultMediaExecutorSettings;
+    static const size_t cDefaultMemoryBudget;
 };
 
 }
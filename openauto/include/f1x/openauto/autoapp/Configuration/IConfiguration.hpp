@@ -26,6 +26,7 @@
 #include <f1x/openauto/autoapp/Configuration/BluetootAdapterType.hpp>
 #include <f1x/openauto/autoapp/Configuration/HandednessOfTrafficType.hpp>
 #include <f1x/openauto/autoapp/Configuration/AudioOutputBackendType.hpp>
+#include <f1x/openauto/autoapp/Configuration/ExecutorGroupSettings.hpp>
 
 namespace f1x
 {
@@ -80,6 +81,21 @@ public:
     virtual void setSpeechAudioChannelEnabled(bool value) = 0;
     virtual AudioOutputBackendType getAudioOutputBackendType() const = 0;
     virtual void setAudioOutputBackendType(AudioOutputBackendType value) = 0;
+    virtual bool mediaStreamingEnabled() const = 0;
+    virtual void setMediaStreamingEnabled(bool value) = 0;
+
+    virtual ExecutorGroupSettings getControlExecutorSettings() const = 0;
+    virtual void setControlExecutorSettings(const ExecutorGroupSettings& value) = 0;
+    virtual ExecutorGroupSettings getMediaExecutorSettings() const = 0;
+    virtual void setMediaExecutorSettings(const ExecutorGroupSettings& value) = 0;
+
+    virtual size_t getMemoryBudget() const = 0;
+    virtual void setMemoryBudget(size_t value) = 0;
+
+    virtual bool stallDetectorEnabled() const = 0;
+    virtual void setStallDetectorEnabled(bool value) = 0;
+    virtual bool profilerSignalEnabled() const = 0;
+    virtual void setProfilerSignalEnabled(bool value) = 0;
 };
 
 }
@@ -0,0 +1,62 @@
+/*
+*  This file is part of openauto project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  openauto is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  openauto is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with openauto. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include <f1x/openauto/autoapp/Configuration/ExecutorGroupSettings.hpp>
+
+namespace f1x
+{
+namespace openauto
+{
+namespace autoapp
+{
+
+// Pool of threads running its own io_service, optionally pinned to a set of CPUs
+// and scheduled with a realtime priority.
+class ExecutorGroup
+{
+public:
+    ExecutorGroup(std::string name, configuration::ExecutorGroupSettings settings);
+    ~ExecutorGroup();
+
+    ExecutorGroup(const ExecutorGroup&) = delete;
+    ExecutorGroup& operator=(const ExecutorGroup&) = delete;
+
+    boost::asio::io_service& getIOService();
+    void start();
+    void stop();
+
+private:
+    void applySchedulingSettings(std::thread& thread);
+
+    std::string name_;
+    configuration::ExecutorGroupSettings settings_;
+    boost::asio::io_service ioService_;
+    std::unique_ptr<boost::asio::io_service::work> work_;
+    std::vector<std::thread> threadPool_;
+};
+
+}
+}
+}
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <f1x/aasdk/Messenger/Timestamp.hpp>
+#include <f1x/aasdk/Messenger/MessageBuffer.hpp>
 #include <f1x/aasdk/Common/Data.hpp>
 
 namespace f1x
@@ -41,6 +42,8 @@ public:
 
     virtual bool open() = 0;
     virtual void write(aasdk::messenger::Timestamp::ValueType timestamp, const aasdk::common::DataConstBuffer& buffer) = 0;
+    // Takes over the received message, the output may hold it until the data is played.
+    virtual void write(aasdk::messenger::Timestamp::ValueType timestamp, aasdk::messenger::MessageBuffer buffer) = 0;
     virtual void start() = 0;
     virtual void stop() = 0;
     virtual void suspend() = 0;
@@ -23,6 +23,7 @@
 #include <aasdk_proto/VideoFPSEnum.pb.h>
 #include <aasdk_proto/VideoResolutionEnum.pb.h>
 #include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/Messenger/MessageBuffer.hpp>
 
 namespace f1x
 {
@@ -44,6 +45,8 @@ public:
     virtual bool open() = 0;
     virtual bool init() = 0;
     virtual void write(uint64_t timestamp, const aasdk::common::DataConstBuffer& buffer) = 0;
+    // Takes over the received message, the output may hold it until the data is decoded.
+    virtual void write(uint64_t timestamp, aasdk::messenger::MessageBuffer buffer) = 0;
     virtual void stop() = 0;
     virtual aasdk::proto::enums::VideoFPS::Enum getVideoFPS() const = 0;
     virtual aasdk::proto::enums::VideoResolution::Enum getVideoResolution() const = 0;
@@ -20,6 +20,7 @@
 
 #include <QObject>
 #include <QKeyEvent>
+#include <f1x/aasdk/Common/ProfiledMutex.hpp>
 #include <f1x/openauto/autoapp/Projection/IInputDevice.hpp>
 #include <f1x/openauto/autoapp/Configuration/IConfiguration.hpp>
 
@@ -57,7 +58,7 @@ private:
     QRect touchscreenGeometry_;
     QRect displayGeometry_;
     IInputDeviceEventHandler* eventHandler_;
-    std::mutex mutex_;
+    aasdk::common::ProfiledMutex<std::mutex> mutex_;
 };
 
 }
@@ -21,6 +21,7 @@
 #include <mutex>
 #include <QAudioSource>
 #include <QAudioFormat>
+#include <f1x/aasdk/Common/ProfiledMutex.hpp>
 #include <f1x/openauto/autoapp/Projection/IAudioInput.hpp>
 
 namespace f1x
@@ -62,7 +63,7 @@ private:
     QIODevice* ioDevice_;
     std::unique_ptr<QAudioSource> audioInput_;
     ReadPromise::Pointer readPromise_;
-    mutable std::mutex mutex_;
+    mutable aasdk::common::ProfiledMutex<std::mutex> mutex_;
 
     static constexpr size_t cSampleSize = 2056;
 };
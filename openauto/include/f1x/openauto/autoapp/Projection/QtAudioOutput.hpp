@@ -40,6 +40,7 @@ public:
     QtAudioOutput(uint32_t channelCount, uint32_t sampleSize, uint32_t sampleRate);
     bool open() override;
     void write(aasdk::messenger::Timestamp::ValueType, const aasdk::common::DataConstBuffer& buffer) override;
+    void write(aasdk::messenger::Timestamp::ValueType, aasdk::messenger::MessageBuffer buffer) override;
     void start() override;
     void stop() override;
     void suspend() override;
@@ -60,6 +61,7 @@ protected slots:
 
 private:
     QAudioFormat audioFormat_;
+    // Holds up to one second of PCM.
     SequentialBuffer audioBuffer_;
     std::unique_ptr<QAudioSink> audioOutput_;
     bool playbackStarted_;
@@ -42,6 +42,7 @@ public:
     bool open() override;
     bool init() override;
     void write(uint64_t timestamp, const aasdk::common::DataConstBuffer& buffer) override;
+    void write(uint64_t timestamp, aasdk::messenger::MessageBuffer buffer) override;
     void stop() override;
 
 signals:
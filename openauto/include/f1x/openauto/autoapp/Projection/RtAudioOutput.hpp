@@ -37,6 +37,7 @@ public:
     RtAudioOutput(uint32_t channelCount, uint32_t sampleSize, uint32_t sampleRate);
     bool open() override;
     void write(aasdk::messenger::Timestamp::ValueType timestamp, const aasdk::common::DataConstBuffer& buffer) override;
+    void write(aasdk::messenger::Timestamp::ValueType timestamp, aasdk::messenger::MessageBuffer buffer) override;
     void start() override;
     void stop() override;
     void suspend() override;
@@ -52,9 +53,10 @@ private:
     uint32_t channelCount_;
     uint32_t sampleSize_;
     uint32_t sampleRate_;
+    // Holds up to one second of PCM.
     SequentialBuffer audioBuffer_;
     std::unique_ptr<RtAudio> dac_;
-    std::mutex mutex_;
+    aasdk::common::ProfiledMutex<std::mutex> mutex_;
 };
 
 }
@@ -20,8 +20,12 @@
 
 #include <QIODevice>
 #include <mutex>
+#include <deque>
 #include <boost/circular_buffer.hpp>
 #include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/Messenger/MessageBuffer.hpp>
+#include <f1x/aasdk/Common/ProfiledMutex.hpp>
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
 
 namespace f1x
 {
@@ -32,10 +36,15 @@ namespace autoapp
 namespace projection
 {
 
+// Data is queued as chunks. Chunks appended from received messages reference the message
+// and are released once read, so only the reader copies the bytes. Bytes written through
+// the QIODevice interface are copied into a ring preallocated at construction.
+// Queued data is bounded by the size granted by the MemoryBudget to the named component.
 class SequentialBuffer: public QIODevice
 {
 public:
-    SequentialBuffer();
+    SequentialBuffer(const std::string& name, size_t capacity, size_t minimumCapacity);
+    void append(aasdk::messenger::MessageBuffer buffer);
     bool isSequential() const override;
     qint64 size() const override;
     qint64 pos() const override;
@@ -51,8 +60,24 @@ protected:
     qint64 writeData(const char *data, qint64 len) override;
 
 private:
-    boost::circular_buffer<aasdk::common::Data::value_type> data_;
-    mutable std::mutex mutex_;
+    struct Chunk
+    {
+        std::shared_ptr<const void> owner;
+        // Null for bytes held in ring_.
+        const aasdk::common::Data::value_type* cdata;
+        size_t size;
+    };
+
+    void push(Chunk chunk);
+    void pushRing(const char* data, size_t len);
+    void trim();
+    void popFront();
+
+    aasdk::common::MemoryReservation reservation_;
+    boost::circular_buffer<aasdk::common::Data::value_type> ring_;
+    std::deque<Chunk> chunks_;
+    size_t size_;
+    mutable aasdk::common::ProfiledMutex<std::mutex> mutex_;
 };
 
 }
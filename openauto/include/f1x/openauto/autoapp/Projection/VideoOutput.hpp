@@ -41,7 +41,15 @@ public:
     QRect getVideoMargins() const override;
 
 protected:
+    // Room for about one second of the encoded stream at the negotiated resolution and frame rate.
+    size_t getVideoBufferSize() const;
+    // Never less than one decoded frame, so a single key frame always fits.
+    size_t getMinimumVideoBufferSize() const;
+
     configuration::IConfiguration::Pointer configuration_;
+
+private:
+    size_t getPixelsCount() const;
 };
 
 }
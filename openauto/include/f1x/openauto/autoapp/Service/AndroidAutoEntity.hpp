@@ -23,6 +23,7 @@
 #include <f1x/aasdk/Channel/Control/IControlServiceChannel.hpp>
 #include <f1x/aasdk/Channel/Control/IControlServiceChannelEventHandler.hpp>
 #include <f1x/aasdk/Channel/AV/VideoServiceChannel.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 #include <f1x/openauto/autoapp/Configuration/IConfiguration.hpp>
 #include <f1x/openauto/autoapp/Service/IAndroidAutoEntity.hpp>
 #include <f1x/openauto/autoapp/Service/IService.hpp>
@@ -68,7 +69,7 @@ private:
     void schedulePing();
     void sendPing();
 
-    boost::asio::io_service::strand strand_;
+    aasdk::io::Strand strand_;
     aasdk::messenger::ICryptor::Pointer cryptor_;
     aasdk::transport::ITransport::Pointer transport_;
     aasdk::messenger::IMessenger::Pointer messenger_;
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <boost/asio.hpp>
+#include <f1x/aasdk/Common/SessionArena.hpp>
 #include <f1x/aasdk/Transport/ITransport.hpp>
 #include <f1x/openauto/autoapp/Configuration/IConfiguration.hpp>
 #include <f1x/openauto/autoapp/Service/IAndroidAutoEntityFactory.hpp>
@@ -44,11 +45,13 @@ public:
     IAndroidAutoEntity::Pointer create(aasdk::tcp::ITCPEndpoint::Pointer tcpEndpoint) override;
 
 private:
-    IAndroidAutoEntity::Pointer create(aasdk::transport::ITransport::Pointer transport);
+    IAndroidAutoEntity::Pointer create(aasdk::transport::ITransport::Pointer transport, aasdk::common::SessionArena::Pointer arena);
 
     boost::asio::io_service& ioService_;
     configuration::IConfiguration::Pointer configuration_;
     IServiceFactory& serviceFactory_;
+
+    static constexpr size_t cVideoReceiveQueueCapacity = 32;
 };
 
 }
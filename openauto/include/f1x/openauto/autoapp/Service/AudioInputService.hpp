@@ -19,6 +19,7 @@
 #pragma once
 
 #include <f1x/aasdk/Channel/AV/AVInputServiceChannel.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 #include <f1x/openauto/autoapp/Service/IService.hpp>
 #include <f1x/openauto/autoapp/Projection/IAudioInput.hpp>
 
@@ -53,7 +54,7 @@ private:
     void onAudioInputDataReady(aasdk::common::Data data);
     void readAudioInput();
 
-    boost::asio::io_service::strand strand_;
+    aasdk::io::Strand strand_;
     aasdk::channel::av::AVInputServiceChannel::Pointer channel_;
     projection::IAudioInput::Pointer audioInput_;
     int32_t session_;
@@ -20,6 +20,7 @@
 
 #include <f1x/aasdk/Channel/AV/IAudioServiceChannel.hpp>
 #include <f1x/aasdk/Channel/AV/IAudioServiceChannelEventHandler.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 #include <f1x/openauto/autoapp/Projection/IAudioOutput.hpp>
 #include <f1x/openauto/autoapp/Service/IService.hpp>
 
@@ -48,12 +49,15 @@ public:
     void onAVChannelStopIndication(const aasdk::proto::messages::AVChannelStopIndication& indication) override;
     void onAVMediaWithTimestampIndication(aasdk::messenger::Timestamp::ValueType timestamp, const aasdk::common::DataConstBuffer& buffer) override;
     void onAVMediaIndication(const aasdk::common::DataConstBuffer& buffer) override;
+    void onAVMediaWithTimestampBuffer(aasdk::messenger::Timestamp::ValueType timestamp, aasdk::messenger::MessageBuffer buffer) override;
+    void onAVMediaBuffer(aasdk::messenger::MessageBuffer buffer) override;
+    void onAVMediaFragment(aasdk::messenger::FrameType fragmentType, aasdk::messenger::Timestamp::ValueType timestamp, const aasdk::common::DataConstBuffer& buffer) override;
     void onChannelError(const aasdk::error::Error& e) override;
 
 protected:
     using std::enable_shared_from_this<AudioService>::shared_from_this;
 
-    boost::asio::io_service::strand strand_;
+    aasdk::io::Strand strand_;
     aasdk::channel::av::IAudioServiceChannel::Pointer channel_;
     projection::IAudioOutput::Pointer audioOutput_;
     int32_t session_;
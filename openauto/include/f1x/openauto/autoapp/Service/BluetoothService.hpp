@@ -19,6 +19,7 @@
 #pragma once
 
 #include <f1x/aasdk/Channel/Bluetooth/BluetoothServiceChannel.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 #include <f1x/openauto/autoapp/Projection/IBluetoothDevice.hpp>
 #include <f1x/openauto/autoapp/Service/IService.hpp>
 
@@ -45,7 +46,7 @@ public:
 private:
     using std::enable_shared_from_this<BluetoothService>::shared_from_this;
 
-    boost::asio::io_service::strand strand_;
+    aasdk::io::Strand strand_;
     aasdk::channel::bluetooth::BluetoothServiceChannel::Pointer channel_;
     projection::IBluetoothDevice::Pointer bluetoothDevice_;
 };
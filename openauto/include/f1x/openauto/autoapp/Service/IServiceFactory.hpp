@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <f1x/aasdk/Common/SessionArena.hpp>
 #include <f1x/aasdk/Messenger/IMessenger.hpp>
 #include <f1x/openauto/autoapp/Service/IService.hpp>
 
@@ -35,7 +36,7 @@ class IServiceFactory
 public:
     virtual ~IServiceFactory() = default;
 
-    virtual ServiceList create(aasdk::messenger::IMessenger::Pointer messenger) = 0;
+    virtual ServiceList create(aasdk::messenger::IMessenger::Pointer messenger, aasdk::common::SessionArena::Pointer arena) = 0;
 };
 
 }
@@ -20,6 +20,7 @@
 
 #include <aasdk_proto/ButtonCodeEnum.pb.h>
 #include <f1x/aasdk/Channel/Input/InputServiceChannel.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 #include <f1x/openauto/autoapp/Service/IService.hpp>
 #include <f1x/openauto/autoapp/Projection/IInputDevice.hpp>
 #include <f1x/openauto/autoapp/Projection/IInputDeviceEventHandler.hpp>
@@ -54,9 +55,11 @@ public:
 private:
     using std::enable_shared_from_this<InputService>::shared_from_this;
 
-    boost::asio::io_service::strand strand_;
+    aasdk::io::Strand strand_;
     aasdk::channel::input::InputServiceChannel::Pointer channel_;
     projection::IInputDevice::Pointer inputDevice_;
+    // Reused for every event sent, cleared messages keep the memory of their fields.
+    aasdk::proto::messages::InputEventIndication inputEventIndication_;
 };
 
 }
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <f1x/aasdk/IO/Strand.hpp>
 #include <f1x/openauto/autoapp/Service/IPinger.hpp>
 
 namespace f1x
@@ -43,7 +44,7 @@ private:
 
     void onTimerExceeded(const boost::system::error_code& error);
 
-    boost::asio::io_service::strand strand_;
+    aasdk::io::Strand strand_;
     boost::asio::deadline_timer timer_;
     time_t duration_;
     bool cancelled_;
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <f1x/aasdk/Channel/Sensor/SensorServiceChannel.hpp>
+#include <f1x/aasdk/IO/Strand.hpp>
 #include <f1x/openauto/autoapp/Service/IService.hpp>
 
 namespace f1x
@@ -47,7 +48,7 @@ private:
     void sendDrivingStatusUnrestricted();
     void sendNightData();
 
-    boost::asio::io_service::strand strand_;
+    aasdk::io::Strand strand_;
     aasdk::channel::sensor::SensorServiceChannel::Pointer channel_;
 };
 
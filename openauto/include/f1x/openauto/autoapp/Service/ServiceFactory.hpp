@@ -33,16 +33,17 @@ namespace service
 class ServiceFactory: public IServiceFactory
 {
 public:
-    ServiceFactory(boost::asio::io_service& ioService, configuration::IConfiguration::Pointer configuration);
-    ServiceList create(aasdk::messenger::IMessenger::Pointer messenger) override;
+    ServiceFactory(boost::asio::io_service& ioService, boost::asio::io_service& mediaIOService, configuration::IConfiguration::Pointer configuration);
+    ServiceList create(aasdk::messenger::IMessenger::Pointer messenger, aasdk::common::SessionArena::Pointer arena) override;
 
 private:
-    IService::Pointer createVideoService(aasdk::messenger::IMessenger::Pointer messenger);
-    IService::Pointer createBluetoothService(aasdk::messenger::IMessenger::Pointer messenger);
-    IService::Pointer createInputService(aasdk::messenger::IMessenger::Pointer messenger);
-    void createAudioServices(ServiceList& serviceList, aasdk::messenger::IMessenger::Pointer messenger);
+    IService::Pointer createVideoService(aasdk::messenger::IMessenger::Pointer messenger, const aasdk::common::SessionArena::Pointer& arena);
+    IService::Pointer createBluetoothService(aasdk::messenger::IMessenger::Pointer messenger, const aasdk::common::SessionArena::Pointer& arena);
+    IService::Pointer createInputService(aasdk::messenger::IMessenger::Pointer messenger, const aasdk::common::SessionArena::Pointer& arena);
+    void createAudioServices(ServiceList& serviceList, aasdk::messenger::IMessenger::Pointer messenger, const aasdk::common::SessionArena::Pointer& arena);
 
     boost::asio::io_service& ioService_;
+    boost::asio::io_service& mediaIOService_;
     configuration::IConfiguration::Pointer configuration_;
 };
 
@@ -16,6 +16,7 @@
 *  along with openauto. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <boost/algorithm/string.hpp>
 #include <f1x/openauto/autoapp/Configuration/Configuration.hpp>
 #include <f1x/openauto/Common/Log.hpp>
 
@@ -43,6 +44,7 @@ const std::string Configuration::cVideoMarginHeight = "Video.MarginHeight";
 const std::string Configuration::cAudioMusicAudioChannelEnabled = "Audio.MusicAudioChannelEnabled";
 const std::string Configuration::cAudioSpeechAudioChannelEnabled = "Audio.SpeechAudioChannelEnabled";
 const std::string Configuration::cAudioOutputBackendType = "Audio.OutputBackendType";
+const std::string Configuration::cMediaStreamingEnabledKey = "Media.StreamingEnabled";
 
 const std::string Configuration::cBluetoothAdapterTypeKey = "Bluetooth.AdapterType";
 const std::string Configuration::cBluetoothRemoteAdapterAddressKey = "Bluetooth.RemoteAdapterAddress";
@@ -60,6 +62,22 @@ const std::string Configuration::cInputCharsButtonKey = "Input.CharsButtons";
 const std::string Configuration::cInputLettersButtonKey = "Input.LettersButtons";
 const std::string Configuration::cInputNumbersButtonKey = "Input.NumbersButtons";
 
+const std::string Configuration::cExecutorsControlThreadsKey = "Executors.ControlThreads";
+const std::string Configuration::cExecutorsControlCpuAffinityKey = "Executors.ControlCpuAffinity";
+const std::string Configuration::cExecutorsControlRealtimePriorityKey = "Executors.ControlRealtimePriority";
+const std::string Configuration::cExecutorsMediaThreadsKey = "Executors.MediaThreads";
+const std::string Configuration::cExecutorsMediaCpuAffinityKey = "Executors.MediaCpuAffinity";
+const std::string Configuration::cExecutorsMediaRealtimePriorityKey = "Executors.MediaRealtimePriority";
+
+const std::string Configuration::cMemoryBudgetKey = "Memory.BudgetMB";
+
+const std::string Configuration::cDiagnosticsStallDetectorEnabledKey = "Diagnostics.StallDetectorEnabled";
+const std::string Configuration::cDiagnosticsProfilerSignalEnabledKey = "Diagnostics.ProfilerSignalEnabled";
+
+const ExecutorGroupSettings Configuration::cDefaultControlExecutorSettings{2, {}, 0};
+const ExecutorGroupSettings Configuration::cDefaultMediaExecutorSettings{2, {}, 0};
+const size_t Configuration::cDefaultMemoryBudget = 64;
+
 Configuration::Configuration()
 {
     this->load();
@@ -98,6 +116,15 @@ void Configuration::load()
         musicAudioChannelEnabled_ = iniConfig.get<bool>(cAudioMusicAudioChannelEnabled, true);
         speechAudiochannelEnabled_ = iniConfig.get<bool>(cAudioSpeechAudioChannelEnabled, true);
         audioOutputBackendType_ = static_cast<AudioOutputBackendType>(iniConfig.get<uint32_t>(cAudioOutputBackendType, static_cast<uint32_t>(AudioOutputBackendType::RTAUDIO)));
+        mediaStreamingEnabled_ = iniConfig.get<bool>(cMediaStreamingEnabledKey, false);
+
+        controlExecutorSettings_ = this->readExecutorSettings(iniConfig, cExecutorsControlThreadsKey, cExecutorsControlCpuAffinityKey, cExecutorsControlRealtimePriorityKey);
+        mediaExecutorSettings_ = this->readExecutorSettings(iniConfig, cExecutorsMediaThreadsKey, cExecutorsMediaCpuAffinityKey, cExecutorsMediaRealtimePriorityKey);
+
+        memoryBudget_ = iniConfig.get<size_t>(cMemoryBudgetKey, cDefaultMemoryBudget);
+
+        stallDetectorEnabled_ = iniConfig.get<bool>(cDiagnosticsStallDetectorEnabledKey, false);
+        profilerSignalEnabled_ = iniConfig.get<bool>(cDiagnosticsProfilerSignalEnabledKey, false);
     }
     catch(const boost::property_tree::ini_parser_error& e)
     {
@@ -124,6 +151,12 @@ void Configuration::reset()
     musicAudioChannelEnabled_ = true;
     speechAudiochannelEnabled_ = true;
     audioOutputBackendType_ = AudioOutputBackendType::RTAUDIO;
+    mediaStreamingEnabled_ = false;
+    controlExecutorSettings_ = cDefaultControlExecutorSettings;
+    mediaExecutorSettings_ = cDefaultMediaExecutorSettings;
+    memoryBudget_ = cDefaultMemoryBudget;
+    stallDetectorEnabled_ = false;
+    profilerSignalEnabled_ = false;
 }
 
 void Configuration::save()
@@ -148,6 +181,15 @@ void Configuration::save()
     iniConfig.put<bool>(cAudioMusicAudioChannelEnabled, musicAudioChannelEnabled_);
     iniConfig.put<bool>(cAudioSpeechAudioChannelEnabled, speechAudiochannelEnabled_);
     iniConfig.put<uint32_t>(cAudioOutputBackendType, static_cast<uint32_t>(audioOutputBackendType_));
+    iniConfig.put<bool>(cMediaStreamingEnabledKey, mediaStreamingEnabled_);
+
+    this->writeExecutorSettings(iniConfig, controlExecutorSettings_, cExecutorsControlThreadsKey, cExecutorsControlCpuAffinityKey, cExecutorsControlRealtimePriorityKey);
+    this->writeExecutorSettings(iniConfig, mediaExecutorSettings_, cExecutorsMediaThreadsKey, cExecutorsMediaCpuAffinityKey, cExecutorsMediaRealtimePriorityKey);
+
+    iniConfig.put<size_t>(cMemoryBudgetKey, memoryBudget_);
+
+    iniConfig.put<bool>(cDiagnosticsStallDetectorEnabledKey, stallDetectorEnabled_);
+    iniConfig.put<bool>(cDiagnosticsProfilerSignalEnabledKey, profilerSignalEnabled_);
     boost::property_tree::ini_parser::write_ini(cConfigFileName, iniConfig);
 }
 
@@ -291,6 +333,66 @@ void Configuration::setAudioOutputBackendType(AudioOutputBackendType value)
     audioOutputBackendType_ = value;
 }
 
+bool Configuration::mediaStreamingEnabled() const
+{
+    return mediaStreamingEnabled_;
+}
+
+void Configuration::setMediaStreamingEnabled(bool value)
+{
+    mediaStreamingEnabled_ = value;
+}
+
+ExecutorGroupSettings Configuration::getControlExecutorSettings() const
+{
+    return controlExecutorSettings_;
+}
+
+void Configuration::setControlExecutorSettings(const ExecutorGroupSettings& value)
+{
+    controlExecutorSettings_ = value;
+}
+
+ExecutorGroupSettings Configuration::getMediaExecutorSettings() const
+{
+    return mediaExecutorSettings_;
+}
+
+void Configuration::setMediaExecutorSettings(const ExecutorGroupSettings& value)
+{
+    mediaExecutorSettings_ = value;
+}
+
+size_t Configuration::getMemoryBudget() const
+{
+    return memoryBudget_;
+}
+
+void Configuration::setMemoryBudget(size_t value)
+{
+    memoryBudget_ = value;
+}
+
+bool Configuration::stallDetectorEnabled() const
+{
+    return stallDetectorEnabled_;
+}
+
+void Configuration::setStallDetectorEnabled(bool value)
+{
+    stallDetectorEnabled_ = value;
+}
+
+bool Configuration::profilerSignalEnabled() const
+{
+    return profilerSignalEnabled_;
+}
+
+void Configuration::setProfilerSignalEnabled(bool value)
+{
+    profilerSignalEnabled_ = value;
+}
+
 void Configuration::readButtonCodes(boost::property_tree::ptree& iniConfig)
 {
     if (iniConfig.get<bool>(cInputEnterButtonKey, false)) {
@@ -364,6 +466,49 @@ void Configuration::writeButtonCodes(boost::property_tree::ptree& iniConfig)
     iniConfig.put<bool>(cInputNumbersButtonKey, std::find(buttonCodes_.begin(), buttonCodes_.end(), aasdk::proto::enums::ButtonCode::NUMBER_0) != buttonCodes_.end());
 }
 
+ExecutorGroupSettings Configuration::readExecutorSettings(boost::property_tree::ptree& iniConfig, const std::string& threadsKey,
+                                                          const std::string& cpuAffinityKey, const std::string& realtimePriorityKey)
+{
+    ExecutorGroupSettings settings;
+    settings.threadsCount = std::max<size_t>(iniConfig.get<size_t>(threadsKey, 2), 1);
+    settings.realtimePriority = iniConfig.get<int32_t>(realtimePriorityKey, 0);
+
+    std::vector<std::string> cpus;
+    const auto cpuAffinity = iniConfig.get<std::string>(cpuAffinityKey, "");
+    boost::split(cpus, cpuAffinity, boost::is_any_of(","), boost::token_compress_on);
+
+    for(auto& cpu : cpus)
+    {
+        boost::trim(cpu);
+        if(cpu.empty())
+        {
+            continue;
+        }
+
+        try
+        {
+            settings.cpuAffinity.push_back(std::stoul(cpu));
+        }
+        catch(const std::exception&)
+        {
+            OPENAUTO_LOG(warning) << "[Configuration] invalid cpu index \"" << cpu << "\" in " << cpuAffinityKey;
+        }
+    }
+
+    return settings;
+}
+
+void Configuration::writeExecutorSettings(boost::property_tree::ptree& iniConfig, const ExecutorGroupSettings& settings, const std::string& threadsKey,
+                                          const std::string& cpuAffinityKey, const std::string& realtimePriorityKey)
+{
+    std::vector<std::string> cpus;
+    std::transform(settings.cpuAffinity.begin(), settings.cpuAffinity.end(), std::back_inserter(cpus), [](size_t cpu) { return std::to_string(cpu); });
+
+    iniConfig.put<size_t>(threadsKey, settings.threadsCount);
+    iniConfig.put<std::string>(cpuAffinityKey, boost::join(cpus, ","));
+    iniConfig.put<int32_t>(realtimePriorityKey, settings.realtimePriority);
+}
+
 }
 }
 }
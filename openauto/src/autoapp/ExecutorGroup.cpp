@@ -0,0 +1,124 @@
+/*
+*  This file is part of openauto project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  openauto is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  openauto is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with openauto. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <f1x/openauto/autoapp/ExecutorGroup.hpp>
+#include <f1x/openauto/Common/Log.hpp>
+
+namespace f1x
+{
+namespace openauto
+{
+namespace autoapp
+{
+
+ExecutorGroup::ExecutorGroup(std::string name, configuration::ExecutorGroupSettings settings)
+    : name_(std::move(name))
+    , settings_(std::move(settings))
+    , ioService_(settings_.threadsCount)
+{
+
+}
+
+ExecutorGroup::~ExecutorGroup()
+{
+    this->stop();
+}
+
+boost::asio::io_service& ExecutorGroup::getIOService()
+{
+    return ioService_;
+}
+
+void ExecutorGroup::start()
+{
+    if(work_ != nullptr)
+    {
+        return;
+    }
+
+    work_ = std::make_unique<boost::asio::io_service::work>(ioService_);
+
+    for(size_t i = 0; i < settings_.threadsCount; ++i)
+    {
+        threadPool_.emplace_back([this]() { ioService_.run(); });
+        this->applySchedulingSettings(threadPool_.back());
+    }
+
+    OPENAUTO_LOG(info) << "[ExecutorGroup] " << name_ << " started, threads: " << settings_.threadsCount
+                       << ", pinned cpus: " << settings_.cpuAffinity.size()
+                       << ", realtime priority: " << settings_.realtimePriority;
+}
+
+void ExecutorGroup::stop()
+{
+    work_.reset();
+    ioService_.stop();
+
+    std::for_each(threadPool_.begin(), threadPool_.end(), std::bind(&std::thread::join, std::placeholders::_1));
+    threadPool_.clear();
+}
+
+void ExecutorGroup::applySchedulingSettings(std::thread& thread)
+{
+#ifdef __linux__
+    if(!settings_.cpuAffinity.empty())
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+
+        for(const auto cpu : settings_.cpuAffinity)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+
+        const auto result = pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet);
+        if(result != 0)
+        {
+            OPENAUTO_LOG(warning) << "[ExecutorGroup] " << name_ << " failed to set cpu affinity: " << std::strerror(result);
+        }
+    }
+
+    if(settings_.realtimePriority > 0)
+    {
+        sched_param param;
+        param.sched_priority = settings_.realtimePriority;
+
+        const auto result = pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &param);
+        if(result != 0)
+        {
+            OPENAUTO_LOG(warning) << "[ExecutorGroup] " << name_ << " failed to set realtime priority: " << std::strerror(result);
+        }
+    }
+#else
+    if(!settings_.cpuAffinity.empty() || settings_.realtimePriority > 0)
+    {
+        OPENAUTO_LOG(warning) << "[ExecutorGroup] " << name_ << " scheduling settings are not supported on this platform.";
+    }
+#endif
+}
+
+}
+}
+}
@@ -35,6 +35,7 @@ InputDevice::InputDevice(QObject& parent, configuration::IConfiguration::Pointer
     , touchscreenGeometry_(touchscreenGeometry)
     , displayGeometry_(displayGeometry)
     , eventHandler_(nullptr)
+    , mutex_("InputDevice")
 {
     this->moveToThread(parent.thread());
 }
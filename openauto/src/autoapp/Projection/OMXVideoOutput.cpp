@@ -177,6 +177,12 @@ void OMXVideoOutput::write(uint64_t timestamp, const aasdk::common::DataConstBuf
     }
 }
 
+void OMXVideoOutput::write(uint64_t timestamp, aasdk::messenger::MessageBuffer buffer)
+{
+    // Input buffers are allocated by the decoder component, the data has to be copied into them anyway.
+    this->write(timestamp, buffer.getData());
+}
+
 void OMXVideoOutput::stop()
 {
     OPENAUTO_LOG(info) << "[OMXVideoOutput] stop.";
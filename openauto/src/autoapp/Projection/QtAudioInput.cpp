@@ -32,6 +32,7 @@ namespace projection
 
 QtAudioInput::QtAudioInput(uint32_t channelCount, uint32_t sampleSize, uint32_t sampleRate)
     : ioDevice_(nullptr)
+    , mutex_("QtAudioInput")
 {
     qRegisterMetaType<IAudioInput::StartPromise::Pointer>("StartPromise::Pointer");
 
@@ -155,7 +156,7 @@ void QtAudioInput::onReadyRead()
         return;
     }
 
-    aasdk::common::Data data(cSampleSize, 0);
+    aasdk::common::Data data(cSampleSize, aasdk::common::cDefaultInit);
     aasdk::common::DataBuffer buffer(data);
     auto readSize = ioDevice_->read(reinterpret_cast<char*>(buffer.data), buffer.size);
 
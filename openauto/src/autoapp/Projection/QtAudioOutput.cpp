@@ -31,7 +31,8 @@ namespace projection
 {
 
 QtAudioOutput::QtAudioOutput(uint32_t channelCount, uint32_t sampleSize, uint32_t sampleRate) // TODO remove sampleSize
-    : playbackStarted_(false)
+    : audioBuffer_("QtAudioOutput", channelCount * sampleSize / 8 * sampleRate, channelCount * sampleSize / 8 * sampleRate / 10)
+    , playbackStarted_(false)
 {
     audioFormat_.setChannelCount(channelCount);
     audioFormat_.setSampleRate(sampleRate);
@@ -61,6 +62,11 @@ void QtAudioOutput::write(aasdk::messenger::Timestamp::ValueType, const aasdk::c
     audioBuffer_.write(reinterpret_cast<const char*>(buffer.cdata), buffer.size);
 }
 
+void QtAudioOutput::write(aasdk::messenger::Timestamp::ValueType, aasdk::messenger::MessageBuffer buffer)
+{
+    audioBuffer_.append(std::move(buffer));
+}
+
 void QtAudioOutput::start()
 {
     emit startPlayback();
@@ -31,6 +31,7 @@ namespace projection
 
 QtVideoOutput::QtVideoOutput(configuration::IConfiguration::Pointer configuration)
     : VideoOutput(std::move(configuration))
+    , videoBuffer_("QtVideoOutput", this->getVideoBufferSize(), this->getMinimumVideoBufferSize())
 {
     this->moveToThread(QApplication::instance()->thread());
     connect(this, &QtVideoOutput::startPlayback, this, &QtVideoOutput::onStartPlayback, Qt::QueuedConnection);
@@ -68,6 +69,11 @@ void QtVideoOutput::write(uint64_t, const aasdk::common::DataConstBuffer& buffer
     videoBuffer_.write(reinterpret_cast<const char*>(buffer.cdata), buffer.size);
 }
 
+void QtVideoOutput::write(uint64_t, aasdk::messenger::MessageBuffer buffer)
+{
+    videoBuffer_.append(std::move(buffer));
+}
+
 void QtVideoOutput::onStartPlayback()
 {
     videoWidget_->setAspectRatioMode(Qt::IgnoreAspectRatio);
@@ -32,6 +32,8 @@ RtAudioOutput::RtAudioOutput(uint32_t channelCount, uint32_t sampleSize, uint32_
     : channelCount_(channelCount)
     , sampleSize_(sampleSize)
     , sampleRate_(sampleRate)
+    , audioBuffer_("RtAudioOutput", channelCount * sampleSize / 8 * sampleRate, channelCount * sampleSize / 8 * sampleRate / 10)
+    , mutex_("RtAudioOutput")
 {
     std::vector<RtAudio::Api> apis;
     RtAudio::getCompiledApi(apis);
@@ -75,6 +77,11 @@ void RtAudioOutput::write(aasdk::messenger::Timestamp::ValueType timestamp, cons
     audioBuffer_.write(reinterpret_cast<const char*>(buffer.cdata), buffer.size);
 }
 
+void RtAudioOutput::write(aasdk::messenger::Timestamp::ValueType, aasdk::messenger::MessageBuffer buffer)
+{
+    audioBuffer_.append(std::move(buffer));
+}
+
 void RtAudioOutput::start()
 {
     std::lock_guard<decltype(mutex_)> lock(mutex_);
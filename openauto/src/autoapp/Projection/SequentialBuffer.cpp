@@ -27,11 +27,20 @@ namespace autoapp
 namespace projection
 {
 
-SequentialBuffer::SequentialBuffer()
-    : data_(aasdk::common::cStaticDataSize)
+SequentialBuffer::SequentialBuffer(const std::string& name, size_t capacity, size_t minimumCapacity)
+    : reservation_(aasdk::common::MemoryBudget::getInstance().reserve(name, capacity, minimumCapacity))
+    , ring_(reservation_.getSize())
+    , size_(0)
+    , mutex_("SequentialBuffer")
 {
 }
 
+void SequentialBuffer::append(aasdk::messenger::MessageBuffer buffer)
+{
+    const auto data = buffer.getData();
+    this->push(Chunk{buffer.getMessage(), data.cdata, data.size});
+}
+
 bool SequentialBuffer::isSequential() const
 {
     return true;
@@ -48,25 +57,111 @@ qint64 SequentialBuffer::readData(char *data, qint64 maxlen)
 {
     std::lock_guard<decltype(mutex_)> lock(mutex_);
 
-    if(data_.empty())
+    size_t len = 0;
+
+    while(len < static_cast<size_t>(maxlen) && !chunks_.empty())
     {
-        return 0;
+        auto& chunk = chunks_.front();
+        const auto count = std::min<size_t>(maxlen - len, chunk.size);
+
+        if(chunk.cdata == nullptr)
+        {
+            std::copy(ring_.begin(), ring_.begin() + count, data + len);
+            ring_.erase_begin(count);
+        }
+        else
+        {
+            std::copy(chunk.cdata, chunk.cdata + count, data + len);
+            chunk.cdata += count;
+        }
+
+        len += count;
+        chunk.size -= count;
+
+        if(chunk.size == 0)
+        {
+            chunks_.pop_front();
+        }
     }
 
-    const auto len = std::min<size_t>(maxlen, data_.size());
-    std::copy(data_.begin(), data_.begin() + len, data);
-    data_.erase_begin(len);
-
+    size_ -= len;
     return len;
 }
 
 qint64 SequentialBuffer::writeData(const char *data, qint64 len)
 {
-    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    this->pushRing(data, len);
+    return len;
+}
+
+void SequentialBuffer::push(Chunk chunk)
+{
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+        size_ += chunk.size;
+        chunks_.push_back(std::move(chunk));
+        this->trim();
+    }
 
-    data_.insert(data_.end(), data, data + len);
     emit readyRead();
-    return len;
+}
+
+void SequentialBuffer::pushRing(const char* data, size_t len)
+{
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+        // Only the newest bytes are kept when a single write exceeds the ring.
+        if(len > ring_.capacity())
+        {
+            data += len - ring_.capacity();
+            len = ring_.capacity();
+        }
+
+        while(ring_.reserve() < len)
+        {
+            this->popFront();
+        }
+
+        ring_.insert(ring_.end(), data, data + len);
+        size_ += len;
+
+        if(!chunks_.empty() && chunks_.back().cdata == nullptr)
+        {
+            chunks_.back().size += len;
+        }
+        else
+        {
+            chunks_.push_back(Chunk{nullptr, nullptr, len});
+        }
+
+        this->trim();
+    }
+
+    emit readyRead();
+}
+
+void SequentialBuffer::trim()
+{
+    // The oldest data is dropped when the reader falls behind.
+    while(size_ > reservation_.getSize() && chunks_.size() > 1)
+    {
+        this->popFront();
+    }
+}
+
+void SequentialBuffer::popFront()
+{
+    const auto& chunk = chunks_.front();
+
+    if(chunk.cdata == nullptr)
+    {
+        ring_.erase_begin(chunk.size);
+    }
+
+    size_ -= chunk.size;
+    chunks_.pop_front();
 }
 
 qint64 SequentialBuffer::size() const
@@ -92,7 +187,11 @@ bool SequentialBuffer::atEnd() const
 
 bool SequentialBuffer::reset()
 {
-    data_.clear();
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    chunks_.clear();
+    ring_.clear();
+    size_ = 0;
     return true;
 }
 
@@ -100,7 +199,7 @@ qint64 SequentialBuffer::bytesAvailable() const
 {
     std::lock_guard<decltype(mutex_)> lock(mutex_);
 
-    return QIODevice::bytesAvailable() + std::max<qint64>(1, data_.size());
+    return QIODevice::bytesAvailable() + std::max<qint64>(1, size_);
 }
 
 bool SequentialBuffer::canReadLine() const
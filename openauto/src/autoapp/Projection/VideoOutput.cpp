@@ -16,6 +16,7 @@
 *  along with openauto. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <f1x/openauto/autoapp/Projection/VideoOutput.hpp>
 
 namespace f1x
@@ -53,6 +54,35 @@ QRect VideoOutput::getVideoMargins() const
     return configuration_->getVideoMargins();
 }
 
+size_t VideoOutput::getVideoBufferSize() const
+{
+    const size_t framesCount = configuration_->getVideoFPS() == aasdk::proto::enums::VideoFPS::_60 ? 60 : 30;
+
+    // One bit per pixel is well above the bitrate of the H.264 stream sent by the phone.
+    return std::max(this->getPixelsCount() * framesCount / 8, this->getMinimumVideoBufferSize());
+}
+
+size_t VideoOutput::getMinimumVideoBufferSize() const
+{
+    // YUV 4:2:0
+    return this->getPixelsCount() * 3 / 2;
+}
+
+size_t VideoOutput::getPixelsCount() const
+{
+    switch(configuration_->getVideoResolution())
+    {
+    case aasdk::proto::enums::VideoResolution::_720p:
+        return 1280 * 720;
+
+    case aasdk::proto::enums::VideoResolution::_1080p:
+        return 1920 * 1080;
+
+    default:
+        return 800 * 480;
+    }
+}
+
 }
 }
 }
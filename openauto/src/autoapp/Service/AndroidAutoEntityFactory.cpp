@@ -49,29 +49,47 @@ AndroidAutoEntityFactory::AndroidAutoEntityFactory(boost::asio::io_service& ioSe
 
 IAndroidAutoEntity::Pointer AndroidAutoEntityFactory::create(aasdk::usb::IAOAPDevice::Pointer aoapDevice)
 {
-    auto transport(std::make_shared<aasdk::transport::USBTransport>(ioService_, std::move(aoapDevice)));
-    return create(std::move(transport));
+    auto arena(std::make_shared<aasdk::common::SessionArena>());
+    auto transport(aasdk::common::allocateShared<aasdk::transport::USBTransport>(arena, ioService_, std::move(aoapDevice)));
+    return create(std::move(transport), std::move(arena));
 }
 
 IAndroidAutoEntity::Pointer AndroidAutoEntityFactory::create(aasdk::tcp::ITCPEndpoint::Pointer tcpEndpoint)
 {
-    auto transport(std::make_shared<aasdk::transport::TCPTransport>(ioService_, std::move(tcpEndpoint)));
-    return create(std::move(transport));
+    auto arena(std::make_shared<aasdk::common::SessionArena>());
+    auto transport(aasdk::common::allocateShared<aasdk::transport::TCPTransport>(arena, ioService_, std::move(tcpEndpoint)));
+    return create(std::move(transport), std::move(arena));
 }
 
-IAndroidAutoEntity::Pointer AndroidAutoEntityFactory::create(aasdk::transport::ITransport::Pointer transport)
+IAndroidAutoEntity::Pointer AndroidAutoEntityFactory::create(aasdk::transport::ITransport::Pointer transport, aasdk::common::SessionArena::Pointer arena)
 {
-    auto sslWrapper(std::make_shared<aasdk::transport::SSLWrapper>());
-    auto cryptor(std::make_shared<aasdk::messenger::Cryptor>(std::move(sslWrapper)));
+    // Objects of the session are allocated from its arena, which is freed as a whole when the last of them is gone.
+    auto sslWrapper(aasdk::common::allocateShared<aasdk::transport::SSLWrapper>(arena));
+    auto cryptor(aasdk::common::allocateShared<aasdk::messenger::Cryptor>(arena, std::move(sslWrapper)));
     cryptor->init();
 
-    auto messenger(std::make_shared<aasdk::messenger::Messenger>(ioService_,
-                                                                 std::make_shared<aasdk::messenger::MessageInStream>(ioService_, transport, cryptor),
-                                                                 std::make_shared<aasdk::messenger::MessageOutStream>(ioService_, transport, cryptor)));
+    // Received messages and their payload buffers are recycled for as long as the session lasts.
+    auto messagePool(aasdk::common::allocateShared<aasdk::messenger::MessagePool>(arena, arena));
+    auto messageInStream(aasdk::common::allocateShared<aasdk::messenger::MessageInStream>(arena, ioService_, transport, cryptor, std::move(messagePool)));
+    // Opt-in: media handed to the outputs fragment by fragment starts decoding before a large frame is complete,
+    // but every fragment is copied. Whole messages are handed over without copying.
+    if(configuration_->mediaStreamingEnabled())
+    {
+        messageInStream->setStreamingEnabled(aasdk::messenger::ChannelId::VIDEO, true);
+        messageInStream->setStreamingEnabled(aasdk::messenger::ChannelId::MEDIA_AUDIO, true);
+    }
 
-    auto serviceList = serviceFactory_.create(messenger);
-    auto pinger(std::make_shared<Pinger>(ioService_, 5000));
-    return std::make_shared<AndroidAutoEntity>(ioService_, std::move(cryptor), std::move(transport), std::move(messenger), configuration_, std::move(serviceList), std::move(pinger));
+    auto messenger(aasdk::common::allocateShared<aasdk::messenger::Messenger>(arena,
+                                                                              ioService_,
+                                                                              messageInStream,
+                                                                              aasdk::common::allocateShared<aasdk::messenger::MessageOutStream>(arena, ioService_, transport, cryptor)));
+
+    // Stop reading from the transport when video output cannot keep up instead of buffering frames without limit.
+    messenger->setReceiveQueuePolicy(aasdk::messenger::ChannelId::VIDEO, cVideoReceiveQueueCapacity, aasdk::messenger::ReceiveQueuePolicy::BLOCK);
+
+    auto serviceList = serviceFactory_.create(messenger, arena);
+    auto pinger(aasdk::common::allocateShared<Pinger>(arena, ioService_, 5000));
+    return aasdk::common::allocateShared<AndroidAutoEntity>(arena, ioService_, std::move(cryptor), std::move(transport), std::move(messenger), configuration_, std::move(serviceList), std::move(pinger));
 }
 
 }
@@ -42,7 +42,7 @@ void AudioInputService::start()
 {
     strand_.dispatch([this, self = this->shared_from_this()]() {
         OPENAUTO_LOG(info) << "[AudioInputService] start.";
-        channel_->receive(this->shared_from_this());
+        channel_->subscribe(this->shared_from_this());
     });
 }
 
@@ -82,8 +82,6 @@ void AudioInputService::onChannelOpenRequest(const aasdk::proto::messages::Chann
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&AudioInputService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendChannelOpenResponse(response, std::move(promise));
-
-    channel_->receive(this->shared_from_this());
 }
 
 void AudioInputService::onAVChannelSetupRequest(const aasdk::proto::messages::AVChannelSetupRequest& request)
@@ -101,8 +99,6 @@ void AudioInputService::onAVChannelSetupRequest(const aasdk::proto::messages::AV
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&AudioInputService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendAVChannelSetupResponse(response, std::move(promise));
-
-    channel_->receive(this->shared_from_this());
 }
 
 void AudioInputService::onAVInputOpenRequest(const aasdk::proto::messages::AVInputOpenRequest& request)
@@ -142,13 +138,11 @@ void AudioInputService::onAVInputOpenRequest(const aasdk::proto::messages::AVInp
         sendPromise->then([]() {}, std::bind(&AudioInputService::onChannelError, this->shared_from_this(), std::placeholders::_1));
         channel_->sendAVInputOpenResponse(response, std::move(sendPromise));
     }
-
-    channel_->receive(this->shared_from_this());
 }
 
 void AudioInputService::onAVMediaAckIndication(const aasdk::proto::messages::AVMediaAckIndication&)
 {
-    channel_->receive(this->shared_from_this());
+
 }
 
 void AudioInputService::onChannelError(const aasdk::error::Error& e)
@@ -41,7 +41,7 @@ void AudioService::start()
 {
     strand_.dispatch([this, self = this->shared_from_this()]() {
         OPENAUTO_LOG(info) << "[AudioService] start, channel: " << aasdk::messenger::channelIdToString(channel_->getId());
-        channel_->receive(this->shared_from_this());
+        channel_->subscribe(this->shared_from_this());
     });
 }
 
@@ -109,7 +109,6 @@ void AudioService::onChannelOpenRequest(const aasdk::proto::messages::ChannelOpe
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&AudioService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendChannelOpenResponse(response, std::move(promise));
-    channel_->receive(this->shared_from_this());
 }
 
 void AudioService::onAVChannelSetupRequest(const aasdk::proto::messages::AVChannelSetupRequest& request)
@@ -129,7 +128,6 @@ void AudioService::onAVChannelSetupRequest(const aasdk::proto::messages::AVChann
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&AudioService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendAVChannelSetupResponse(response, std::move(promise));
-    channel_->receive(this->shared_from_this());
 }
 
 void AudioService::onAVChannelStartIndication(const aasdk::proto::messages::AVChannelStartIndication& indication)
@@ -139,7 +137,6 @@ void AudioService::onAVChannelStartIndication(const aasdk::proto::messages::AVCh
                        << ", session: " << indication.session();
     session_ = indication.session();
     audioOutput_->start();
-    channel_->receive(this->shared_from_this());
 }
 
 void AudioService::onAVChannelStopIndication(const aasdk::proto::messages::AVChannelStopIndication& indication)
@@ -149,7 +146,6 @@ void AudioService::onAVChannelStopIndication(const aasdk::proto::messages::AVCha
                        << ", session: " << session_;
     session_ = -1;
     audioOutput_->suspend();
-    channel_->receive(this->shared_from_this());
 }
 
 void AudioService::onAVMediaWithTimestampIndication(aasdk::messenger::Timestamp::ValueType timestamp, const aasdk::common::DataConstBuffer& buffer)
@@ -159,10 +155,7 @@ void AudioService::onAVMediaWithTimestampIndication(aasdk::messenger::Timestamp:
     indication.set_session(session_);
     indication.set_value(1);
 
-    auto promise = aasdk::channel::SendPromise::defer(strand_);
-    promise->then([]() {}, std::bind(&AudioService::onChannelError, this->shared_from_this(), std::placeholders::_1));
-    channel_->sendAVMediaAckIndication(indication, std::move(promise));
-    channel_->receive(this->shared_from_this());
+    channel_->sendAVMediaAckIndication(indication);
 }
 
 void AudioService::onAVMediaIndication(const aasdk::common::DataConstBuffer& buffer)
@@ -170,6 +163,35 @@ void AudioService::onAVMediaIndication(const aasdk::common::DataConstBuffer& buf
     this->onAVMediaWithTimestampIndication(0, buffer);
 }
 
+void AudioService::onAVMediaWithTimestampBuffer(aasdk::messenger::Timestamp::ValueType timestamp, aasdk::messenger::MessageBuffer buffer)
+{
+    audioOutput_->write(timestamp, std::move(buffer));
+    aasdk::proto::messages::AVMediaAckIndication indication;
+    indication.set_session(session_);
+    indication.set_value(1);
+
+    channel_->sendAVMediaAckIndication(indication);
+}
+
+void AudioService::onAVMediaBuffer(aasdk::messenger::MessageBuffer buffer)
+{
+    this->onAVMediaWithTimestampBuffer(0, std::move(buffer));
+}
+
+void AudioService::onAVMediaFragment(aasdk::messenger::FrameType fragmentType, aasdk::messenger::Timestamp::ValueType timestamp, const aasdk::common::DataConstBuffer& buffer)
+{
+    audioOutput_->write(timestamp, buffer);
+
+    if(fragmentType == aasdk::messenger::FrameType::LAST)
+    {
+        aasdk::proto::messages::AVMediaAckIndication indication;
+        indication.set_session(session_);
+        indication.set_value(1);
+
+        channel_->sendAVMediaAckIndication(indication);
+    }
+}
+
 void AudioService::onChannelError(const aasdk::error::Error& e)
 {
     OPENAUTO_LOG(error) << "[AudioService] channel error: " << e.what()
@@ -40,7 +40,7 @@ void BluetoothService::start()
 {
     strand_.dispatch([this, self = this->shared_from_this()]() {
         OPENAUTO_LOG(info) << "[BluetoothService] start.";
-        channel_->receive(this->shared_from_this());
+        channel_->subscribe(this->shared_from_this());
     });
 }
 
@@ -79,8 +79,6 @@ void BluetoothService::onChannelOpenRequest(const aasdk::proto::messages::Channe
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&BluetoothService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendChannelOpenResponse(response, std::move(promise));
-
-    channel_->receive(this->shared_from_this());
 }
 
 void BluetoothService::onBluetoothPairingRequest(const aasdk::proto::messages::BluetoothPairingRequest& request)
@@ -96,8 +94,6 @@ void BluetoothService::onBluetoothPairingRequest(const aasdk::proto::messages::B
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&BluetoothService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendBluetoothPairingResponse(response, std::move(promise));
-
-    channel_->receive(this->shared_from_this());
 }
 
 void BluetoothService::onChannelError(const aasdk::error::Error& e)
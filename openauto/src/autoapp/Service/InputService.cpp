@@ -41,7 +41,7 @@ void InputService::start()
 {
     strand_.dispatch([this, self = this->shared_from_this()]() {
         OPENAUTO_LOG(info) << "[InputService] start.";
-        channel_->receive(this->shared_from_this());
+        channel_->subscribe(this->shared_from_this());
     });
 }
 
@@ -91,8 +91,6 @@ void InputService::onChannelOpenRequest(const aasdk::proto::messages::ChannelOpe
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&InputService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendChannelOpenResponse(response, std::move(promise));
-
-    channel_->receive(this->shared_from_this());
 }
 
 void InputService::onBindingRequest(const aasdk::proto::messages::BindingRequest& request)
@@ -127,7 +125,6 @@ void InputService::onBindingRequest(const aasdk::proto::messages::BindingRequest
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&InputService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendBindingResponse(response, std::move(promise));
-    channel_->receive(this->shared_from_this());
 }
 
 void InputService::onChannelError(const aasdk::error::Error& e)
@@ -140,7 +137,8 @@ void InputService::onButtonEvent(const projection::ButtonEvent& event)
     auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now().time_since_epoch());
 
     strand_.dispatch([this, self = this->shared_from_this(), event = std::move(event), timestamp = std::move(timestamp)]() {
-        aasdk::proto::messages::InputEventIndication inputEventIndication;
+        auto& inputEventIndication = inputEventIndication_;
+        inputEventIndication.Clear();
         inputEventIndication.set_timestamp(timestamp.count());
 
         if(event.code == aasdk::proto::enums::ButtonCode::SCROLL_WHEEL)
@@ -158,9 +156,7 @@ void InputService::onButtonEvent(const projection::ButtonEvent& event)
             buttonEvent->set_scan_code(event.code);
         }
 
-        auto promise = aasdk::channel::SendPromise::defer(strand_);
-        promise->then([]() {}, std::bind(&InputService::onChannelError, this->shared_from_this(), std::placeholders::_1));
-        channel_->sendInputEventIndication(inputEventIndication, std::move(promise));
+        channel_->sendInputEventIndication(inputEventIndication);
     });
 }
 
@@ -170,7 +166,8 @@ void InputService::onTouchEvent(const projection::TouchEvent& event)
     auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now().time_since_epoch());
 
     strand_.dispatch([this, self = this->shared_from_this(), event = std::move(event), timestamp = std::move(timestamp)]() {
-        aasdk::proto::messages::InputEventIndication inputEventIndication;
+        auto& inputEventIndication = inputEventIndication_;
+        inputEventIndication.Clear();
         inputEventIndication.set_timestamp(timestamp.count());
 
         auto touchEvent = inputEventIndication.mutable_touch_event();
@@ -180,9 +177,7 @@ void InputService::onTouchEvent(const projection::TouchEvent& event)
         touchLocation->set_y(event.y);
         touchLocation->set_pointer_id(0);
 
-        auto promise = aasdk::channel::SendPromise::defer(strand_);
-        promise->then([]() {}, std::bind(&InputService::onChannelError, this->shared_from_this(), std::placeholders::_1));
-        channel_->sendInputEventIndication(inputEventIndication, std::move(promise));
+        channel_->sendInputEventIndication(inputEventIndication);
         //OPENAUTO_LOG(debug) << "[InputService] sendInputEventIndication";
     });
 }
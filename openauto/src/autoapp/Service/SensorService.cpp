@@ -40,7 +40,7 @@ void SensorService::start()
 {
     strand_.dispatch([this, self = this->shared_from_this()]() {
         OPENAUTO_LOG(info) << "[SensorService] start.";
-        channel_->receive(this->shared_from_this());
+        channel_->subscribe(this->shared_from_this());
     });
 }
 
@@ -76,8 +76,6 @@ void SensorService::onChannelOpenRequest(const aasdk::proto::messages::ChannelOp
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&SensorService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendChannelOpenResponse(response, std::move(promise));
-
-    channel_->receive(this->shared_from_this());
 }
 
 void SensorService::onSensorStartRequest(const aasdk::proto::messages::SensorStartRequestMessage& request)
@@ -105,7 +103,6 @@ void SensorService::onSensorStartRequest(const aasdk::proto::messages::SensorSta
     }
 
     channel_->sendSensorStartResponse(response, std::move(promise));
-    channel_->receive(this->shared_from_this());
 }
 
 void SensorService::sendDrivingStatusUnrestricted()
@@ -113,9 +110,7 @@ void SensorService::sendDrivingStatusUnrestricted()
     aasdk::proto::messages::SensorEventIndication indication;
     indication.add_driving_status()->set_status(aasdk::proto::enums::DrivingStatus::UNRESTRICTED);
 
-    auto promise = aasdk::channel::SendPromise::defer(strand_);
-    promise->then([]() {}, std::bind(&SensorService::onChannelError, this->shared_from_this(), std::placeholders::_1));
-    channel_->sendSensorEventIndication(indication, std::move(promise));
+    channel_->sendSensorEventIndication(indication);
 }
 
 void SensorService::sendNightData()
@@ -123,9 +118,7 @@ void SensorService::sendNightData()
     aasdk::proto::messages::SensorEventIndication indication;
     indication.add_night_mode()->set_is_night(false);
 
-    auto promise = aasdk::channel::SendPromise::defer(strand_);
-    promise->then([]() {}, std::bind(&SensorService::onChannelError, this->shared_from_this(), std::placeholders::_1));
-    channel_->sendSensorEventIndication(indication, std::move(promise));
+    channel_->sendSensorEventIndication(indication);
 }
 
 void SensorService::onChannelError(const aasdk::error::Error& e)
@@ -49,39 +49,40 @@ namespace autoapp
 namespace service
 {
 
-ServiceFactory::ServiceFactory(boost::asio::io_service& ioService, configuration::IConfiguration::Pointer configuration)
+ServiceFactory::ServiceFactory(boost::asio::io_service& ioService, boost::asio::io_service& mediaIOService, configuration::IConfiguration::Pointer configuration)
     : ioService_(ioService)
+    , mediaIOService_(mediaIOService)
     , configuration_(std::move(configuration))
 {
 
 }
 
-ServiceList ServiceFactory::create(aasdk::messenger::IMessenger::Pointer messenger)
+ServiceList ServiceFactory::create(aasdk::messenger::IMessenger::Pointer messenger, aasdk::common::SessionArena::Pointer arena)
 {
     ServiceList serviceList;
 
     projection::IAudioInput::Pointer audioInput(new projection::QtAudioInput(1, 16, 16000), std::bind(&QObject::deleteLater, std::placeholders::_1));
-    serviceList.emplace_back(std::make_shared<AudioInputService>(ioService_, messenger, std::move(audioInput)));
-    this->createAudioServices(serviceList, messenger);
-    serviceList.emplace_back(std::make_shared<SensorService>(ioService_, messenger));
-    serviceList.emplace_back(this->createVideoService(messenger));
-    serviceList.emplace_back(this->createBluetoothService(messenger));
-    serviceList.emplace_back(this->createInputService(messenger));
+    serviceList.emplace_back(aasdk::common::allocateShared<AudioInputService>(arena, mediaIOService_, messenger, std::move(audioInput)));
+    this->createAudioServices(serviceList, messenger, arena);
+    serviceList.emplace_back(aasdk::common::allocateShared<SensorService>(arena, ioService_, messenger));
+    serviceList.emplace_back(this->createVideoService(messenger, arena));
+    serviceList.emplace_back(this->createBluetoothService(messenger, arena));
+    serviceList.emplace_back(this->createInputService(messenger, arena));
 
     return serviceList;
 }
 
-IService::Pointer ServiceFactory::createVideoService(aasdk::messenger::IMessenger::Pointer messenger)
+IService::Pointer ServiceFactory::createVideoService(aasdk::messenger::IMessenger::Pointer messenger, const aasdk::common::SessionArena::Pointer& arena)
 {
 #ifdef USE_OMX
     auto videoOutput(std::make_shared<projection::OMXVideoOutput>(configuration_));
 #else
     projection::IVideoOutput::Pointer videoOutput(new projection::QtVideoOutput(configuration_), std::bind(&QObject::deleteLater, std::placeholders::_1));
 #endif
-    return std::make_shared<VideoService>(ioService_, messenger, std::move(videoOutput));
+    return aasdk::common::allocateShared<VideoService>(arena, mediaIOService_, messenger, std::move(videoOutput));
 }
 
-IService::Pointer ServiceFactory::createBluetoothService(aasdk::messenger::IMessenger::Pointer messenger)
+IService::Pointer ServiceFactory::createBluetoothService(aasdk::messenger::IMessenger::Pointer messenger, const aasdk::common::SessionArena::Pointer& arena)
 {
     projection::IBluetoothDevice::Pointer bluetoothDevice;
     switch(configuration_->getBluetoothAdapterType())
@@ -99,10 +100,10 @@ IService::Pointer ServiceFactory::createBluetoothService(aasdk::messenger::IMess
         break;
     }
 
-    return std::make_shared<BluetoothService>(ioService_, messenger, std::move(bluetoothDevice));
+    return aasdk::common::allocateShared<BluetoothService>(arena, ioService_, messenger, std::move(bluetoothDevice));
 }
 
-IService::Pointer ServiceFactory::createInputService(aasdk::messenger::IMessenger::Pointer messenger)
+IService::Pointer ServiceFactory::createInputService(aasdk::messenger::IMessenger::Pointer messenger, const aasdk::common::SessionArena::Pointer& arena)
 {
     QRect videoGeometry;
     switch(configuration_->getVideoResolution())
@@ -124,10 +125,10 @@ IService::Pointer ServiceFactory::createInputService(aasdk::messenger::IMessenge
     QRect screenGeometry = screen == nullptr ? QRect(0, 0, 1, 1) : screen->geometry();
     projection::IInputDevice::Pointer inputDevice(std::make_shared<projection::InputDevice>(*QApplication::instance(), configuration_, std::move(screenGeometry), std::move(videoGeometry)));
 
-    return std::make_shared<InputService>(ioService_, messenger, std::move(inputDevice));
+    return aasdk::common::allocateShared<InputService>(arena, ioService_, messenger, std::move(inputDevice));
 }
 
-void ServiceFactory::createAudioServices(ServiceList& serviceList, aasdk::messenger::IMessenger::Pointer messenger)
+void ServiceFactory::createAudioServices(ServiceList& serviceList, aasdk::messenger::IMessenger::Pointer messenger, const aasdk::common::SessionArena::Pointer& arena)
 {
     if(configuration_->musicAudioChannelEnabled())
     {
@@ -135,7 +136,7 @@ void ServiceFactory::createAudioServices(ServiceList& serviceList, aasdk::messen
                     std::make_shared<projection::RtAudioOutput>(2, 16, 48000) :
                     projection::IAudioOutput::Pointer(new projection::QtAudioOutput(2, 16, 48000), std::bind(&QObject::deleteLater, std::placeholders::_1));
 
-        serviceList.emplace_back(std::make_shared<MediaAudioService>(ioService_, messenger, std::move(mediaAudioOutput)));
+        serviceList.emplace_back(aasdk::common::allocateShared<MediaAudioService>(arena, mediaIOService_, messenger, std::move(mediaAudioOutput)));
     }
 
     if(configuration_->speechAudioChannelEnabled())
@@ -144,14 +145,14 @@ void ServiceFactory::createAudioServices(ServiceList& serviceList, aasdk::messen
                     std::make_shared<projection::RtAudioOutput>(1, 16, 16000) :
                     projection::IAudioOutput::Pointer(new projection::QtAudioOutput(1, 16, 16000), std::bind(&QObject::deleteLater, std::placeholders::_1));
 
-        serviceList.emplace_back(std::make_shared<SpeechAudioService>(ioService_, messenger, std::move(speechAudioOutput)));
+        serviceList.emplace_back(aasdk::common::allocateShared<SpeechAudioService>(arena, mediaIOService_, messenger, std::move(speechAudioOutput)));
     }
 
     auto systemAudioOutput = configuration_->getAudioOutputBackendType() == configuration::AudioOutputBackendType::RTAUDIO ?
                 std::make_shared<projection::RtAudioOutput>(1, 16, 16000) :
                 projection::IAudioOutput::Pointer(new projection::QtAudioOutput(1, 16, 16000), std::bind(&QObject::deleteLater, std::placeholders::_1));
 
-    serviceList.emplace_back(std::make_shared<SystemAudioService>(ioService_, messenger, std::move(systemAudioOutput)));
+    serviceList.emplace_back(aasdk::common::allocateShared<SystemAudioService>(arena, mediaIOService_, messenger, std::move(systemAudioOutput)));
 }
 
 }
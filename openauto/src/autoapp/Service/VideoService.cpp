@@ -41,7 +41,7 @@ void VideoService::start()
 {
     strand_.dispatch([this, self = this->shared_from_this()]() {
         OPENAUTO_LOG(info) << "[VideoService] start.";
-        channel_->receive(this->shared_from_this());
+        channel_->subscribe(this->shared_from_this());
     });
 }
 
@@ -65,8 +65,6 @@ void VideoService::onChannelOpenRequest(const aasdk::proto::messages::ChannelOpe
     auto promise = aasdk::channel::SendPromise::defer(strand_);
     promise->then([]() {}, std::bind(&VideoService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendChannelOpenResponse(response, std::move(promise));
-
-    channel_->receive(this->shared_from_this());
 }
 
 void VideoService::onAVChannelSetupRequest(const aasdk::proto::messages::AVChannelSetupRequest& request)
@@ -84,22 +82,17 @@ void VideoService::onAVChannelSetupRequest(const aasdk::proto::messages::AVChann
     promise->then(std::bind(&VideoService::sendVideoFocusIndication, this->shared_from_this()),
                  std::bind(&VideoService::onChannelError, this->shared_from_this(), std::placeholders::_1));
     channel_->sendAVChannelSetupResponse(response, std::move(promise));
-    channel_->receive(this->shared_from_this());
 }
 
 void VideoService::onAVChannelStartIndication(const aasdk::proto::messages::AVChannelStartIndication& indication)
 {
     OPENAUTO_LOG(info) << "[VideoService] start indication, session: " << indication.session();
     session_ = indication.session();
-
-    channel_->receive(this->shared_from_this());
 }
 
 void VideoService::onAVChannelStopIndication(const aasdk::proto::messages::AVChannelStopIndication& indication)
 {
     OPENAUTO_LOG(info) << "[VideoService] stop indication";
-
-    channel_->receive(this->shared_from_this());
 }
 
 void VideoService::onAVMediaWithTimestampIndication(aasdk::messenger::Timestamp::ValueType timestamp, const aasdk::common::DataConstBuffer& buffer)
@@ -110,11 +103,7 @@ void VideoService::onAVMediaWithTimestampIndication(aasdk::messenger::Timestamp:
     indication.set_session(session_);
     indication.set_value(1);
 
-    auto promise = aasdk::channel::SendPromise::defer(strand_);
-    promise->then([]() {}, std::bind(&VideoService::onChannelError, this->shared_from_this(), std::placeholders::_1));
-    channel_->sendAVMediaAckIndication(indication, std::move(promise));
-
-    channel_->receive(this->shared_from_this());
+    channel_->sendAVMediaAckIndication(indication);
 }
 
 void VideoService::onAVMediaIndication(const aasdk::common::DataConstBuffer& buffer)
@@ -125,11 +114,38 @@ void VideoService::onAVMediaIndication(const aasdk::common::DataConstBuffer& buf
     indication.set_session(session_);
     indication.set_value(1);
 
-    auto promise = aasdk::channel::SendPromise::defer(strand_);
-    promise->then([]() {}, std::bind(&VideoService::onChannelError, this->shared_from_this(), std::placeholders::_1));
-    channel_->sendAVMediaAckIndication(indication, std::move(promise));
+    channel_->sendAVMediaAckIndication(indication);
+}
+
+void VideoService::onAVMediaWithTimestampBuffer(aasdk::messenger::Timestamp::ValueType timestamp, aasdk::messenger::MessageBuffer buffer)
+{
+    videoOutput_->write(timestamp, std::move(buffer));
+
+    aasdk::proto::messages::AVMediaAckIndication indication;
+    indication.set_session(session_);
+    indication.set_value(1);
+
+    channel_->sendAVMediaAckIndication(indication);
+}
+
+void VideoService::onAVMediaBuffer(aasdk::messenger::MessageBuffer buffer)
+{
+    this->onAVMediaWithTimestampBuffer(0, std::move(buffer));
+}
+
+void VideoService::onAVMediaFragment(aasdk::messenger::FrameType fragmentType, aasdk::messenger::Timestamp::ValueType timestamp, const aasdk::common::DataConstBuffer& buffer)
+{
+    // Decoder is fed as fragments arrive, the frame is acknowledged once it is complete.
+    videoOutput_->write(timestamp, buffer);
+
+    if(fragmentType == aasdk::messenger::FrameType::LAST)
+    {
+        aasdk::proto::messages::AVMediaAckIndication indication;
+        indication.set_session(session_);
+        indication.set_value(1);
 
-    channel_->receive(this->shared_from_this());
+        channel_->sendAVMediaAckIndication(indication);
+    }
 }
 
 void VideoService::onChannelError(const aasdk::error::Error& e)
@@ -165,7 +181,6 @@ void VideoService::onVideoFocusRequest(const aasdk::proto::messages::VideoFocusR
                        << ", focus reason: " << request.focus_reason();
 
     this->sendVideoFocusIndication();
-    channel_->receive(this->shared_from_this());
 }
 
 void VideoService::sendVideoFocusIndication()
@@ -16,6 +16,7 @@
 *  along with openauto. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <csignal>
 #include <thread>
 #include <QApplication>
 #include <f1x/aasdk/USB/USBHub.hpp>
@@ -24,7 +25,13 @@
 #include <f1x/aasdk/USB/AccessoryModeQueryChainFactory.hpp>
 #include <f1x/aasdk/USB/AccessoryModeQueryFactory.hpp>
 #include <f1x/aasdk/TCP/TCPWrapper.hpp>
+#include <f1x/aasdk/Common/ThreadingPolicy.hpp>
+#include <f1x/aasdk/Common/LockProfiler.hpp>
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
+#include <f1x/aasdk/IO/ProfilerSignalHandler.hpp>
+#include <f1x/aasdk/IO/StallDetector.hpp>
 #include <f1x/openauto/autoapp/App.hpp>
+#include <f1x/openauto/autoapp/ExecutorGroup.hpp>
 #include <f1x/openauto/autoapp/Configuration/IConfiguration.hpp>
 #include <f1x/openauto/autoapp/Configuration/RecentAddressesList.hpp>
 #include <f1x/openauto/autoapp/Service/AndroidAutoEntityFactory.hpp>
@@ -38,6 +45,7 @@
 namespace aasdk = f1x::aasdk;
 namespace autoapp = f1x::openauto::autoapp;
 using ThreadPool = std::vector<std::thread>;
+using ThreadingPolicy = aasdk::common::DefaultThreadingPolicy;
 
 void startUSBWorkers(boost::asio::io_service& ioService, libusb_context* usbContext, ThreadPool& threadPool)
 {
@@ -50,22 +58,10 @@ void startUSBWorkers(boost::asio::io_service& ioService, libusb_context* usbCont
         }
     };
 
-    threadPool.emplace_back(usbWorker);
-    threadPool.emplace_back(usbWorker);
-    threadPool.emplace_back(usbWorker);
-    threadPool.emplace_back(usbWorker);
-}
-
-void startIOServiceWorkers(boost::asio::io_service& ioService, ThreadPool& threadPool)
-{
-    auto ioServiceWorker = [&ioService]() {
-        ioService.run();
-    };
-
-    threadPool.emplace_back(ioServiceWorker);
-    threadPool.emplace_back(ioServiceWorker);
-    threadPool.emplace_back(ioServiceWorker);
-    threadPool.emplace_back(ioServiceWorker);
+    for(size_t i = 0; i < ThreadingPolicy::cIOThreadsCount; ++i)
+    {
+        threadPool.emplace_back(usbWorker);
+    }
 }
 
 int main(int argc, char* argv[])
@@ -77,17 +73,49 @@ int main(int argc, char* argv[])
         return 1;
     }
 
-    boost::asio::io_service ioService;
-    boost::asio::io_service::work work(ioService);
+    auto configuration = std::make_shared<autoapp::configuration::Configuration>();
+
+    // Buffers are sized before any of them is created, components get less than they ask for once the budget is used up.
+    const auto memoryBudget = configuration->getMemoryBudget();
+    aasdk::common::MemoryBudget::getInstance().setLimit(memoryBudget == 0 ? aasdk::common::MemoryBudget::cUnlimited : memoryBudget * 1024 * 1024);
+
+    // Reports handlers blocking an executor thread long enough to delay input and video.
+    auto& stallDetector = aasdk::io::StallDetector::getInstance();
+    if(configuration->stallDetectorEnabled())
+    {
+        stallDetector.start(std::chrono::milliseconds(100), std::chrono::milliseconds(50));
+    }
+
+    auto controlExecutorSettings = configuration->getControlExecutorSettings();
+    if(ThreadingPolicy::cIOThreadsCount == 1)
+    {
+        // Handlers are not synchronized in single threaded builds, so everything
+        // runs on one thread and media services share the control executor.
+        controlExecutorSettings.threadsCount = 1;
+    }
+
+    autoapp::ExecutorGroup controlExecutor("control", std::move(controlExecutorSettings));
+    autoapp::ExecutorGroup mediaExecutor("media", configuration->getMediaExecutorSettings());
+    auto& ioService = controlExecutor.getIOService();
+    auto& mediaIOService = ThreadingPolicy::cIOThreadsCount == 1 ? ioService : mediaExecutor.getIOService();
+
     std::vector<std::thread> threadPool;
     startUSBWorkers(ioService, usbContext, threadPool);
-    startIOServiceWorkers(ioService, threadPool);
+    controlExecutor.start();
+
+    if(&mediaIOService != &ioService)
+    {
+        mediaExecutor.start();
+    }
+
+    // Memory budget usage is always reported on SIGUSR1, the profilers only when enabled in the configuration and built into aasdk.
+    auto profilerSignalHandler = std::make_shared<aasdk::io::ProfilerSignalHandler>(ioService, SIGUSR1, configuration->profilerSignalEnabled());
+    profilerSignalHandler->start();
 
     QApplication qApplication(argc, argv);
     autoapp::ui::MainWindow mainWindow;
     mainWindow.setWindowFlags(Qt::WindowStaysOnTopHint);
 
-    auto configuration = std::make_shared<autoapp::configuration::Configuration>();
     autoapp::ui::SettingsWindow settingsWindow(configuration);
     settingsWindow.setWindowFlags(Qt::WindowStaysOnTopHint);
 
@@ -113,7 +141,7 @@ int main(int argc, char* argv[])
     aasdk::usb::USBWrapper usbWrapper(usbContext);
     aasdk::usb::AccessoryModeQueryFactory queryFactory(usbWrapper, ioService);
     aasdk::usb::AccessoryModeQueryChainFactory queryChainFactory(usbWrapper, ioService, queryFactory);
-    autoapp::service::ServiceFactory serviceFactory(ioService, configuration);
+    autoapp::service::ServiceFactory serviceFactory(ioService, mediaIOService, configuration);
     autoapp::service::AndroidAutoEntityFactory androidAutoEntityFactory(ioService, configuration, serviceFactory);
 
     auto usbHub(std::make_shared<aasdk::usb::USBHub>(usbWrapper, ioService, queryChainFactory));
@@ -127,6 +155,18 @@ int main(int argc, char* argv[])
     app->waitForUSBDevice();
 
     auto result = qApplication.exec();
+    mediaExecutor.stop();
+    controlExecutor.stop();
+    if(stallDetector.isRunning())
+    {
+        stallDetector.stop();
+        stallDetector.dump();
+    }
+
+    if(aasdk::common::LockProfiler::isEnabled())
+    {
+        aasdk::common::LockProfiler::getInstance().dump();
+    }
     std::for_each(threadPool.begin(), threadPool.end(), std::bind(&std::thread::join, std::placeholders::_1));
 
     libusb_exit(usbContext);